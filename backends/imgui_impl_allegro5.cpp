@@ -63,6 +63,9 @@
 #include "imgui.h"
 #ifndef IMGUI_DISABLE
 #include "imgui_impl_allegro5.h"
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#error "IMGUI_USE_COMPACT_DRAWVERT is not supported by this backend."
+#endif
 #include <stdint.h>     // uint64_t
 #include <cstring>      // memcpy
 
@@ -7,6 +7,9 @@
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture as texture identifier. Read the FAQ about ImTextureID/ImTextureRef!
 //  [x] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset) [Desktop OpenGL only!]
 //  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [X] Renderer: Damage tracking support: only redraw regions listed in ImDrawData::DamageRects[] when io.ConfigDamageTracking is enabled.
+//  [X] Renderer: Compact vertex layout support (IMGUI_USE_COMPACT_DRAWVERT).
+//  [X] Renderer: Signed distance field textures support, for fonts using ImFontFlags_SDF (ImGuiBackendFlags_RendererHasSdfTextures) [Not on ES 2.0!]
 
 // About WebGL/ES:
 // - You need to '#define IMGUI_IMPL_OPENGL_ES2' or '#define IMGUI_IMPL_OPENGL_ES3' to use WebGL or OpenGL ES.
@@ -23,6 +26,9 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2025-08-29: OpenGL: Support for signed distance field textures (ImGuiBackendFlags_RendererHasSdfTextures), used by ImFontFlags_SDF fonts. Not available with GLSL ES 1.00.
+//  2025-08-26: OpenGL: Support for compact vertex layout (IMGUI_USE_COMPACT_DRAWVERT): 16-bit fixed-point positions and 16-bit normalized UV.
+//  2025-08-25: OpenGL: Support for damage tracking (io.ConfigDamageTracking): only redraw regions listed in ImDrawData::DamageRects[], skip rendering when nothing changed.
 //  2025-07-22: OpenGL: Add and call embedded loader shutdown during ImGui_ImplOpenGL3_Shutdown() to facilitate multiple init/shutdown cycles in same process. (#8792)
 //  2025-07-15: OpenGL: Set GL_UNPACK_ALIGNMENT to 1 before updating textures (#8802) + restore non-WebGL/ES update path that doesn't require a CPU-side copy.
 //  2025-06-11: OpenGL: Added support for ImGuiBackendFlags_RendererHasTextures, for dynamic font atlas. Removed ImGui_ImplOpenGL3_CreateFontsTexture() and ImGui_ImplOpenGL3_DestroyFontsTexture().
@@ -217,6 +223,11 @@
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
 #endif
 
+// Compact vertex layout (IMGUI_USE_COMPACT_DRAWVERT) uses GL_SHORT positions, which our embedded loader doesn't define.
+#ifndef GL_SHORT
+#define GL_SHORT                0x1402
+#endif
+
 // [Debugging]
 //#define IMGUI_IMPL_OPENGL_DEBUG
 #ifdef IMGUI_IMPL_OPENGL_DEBUG
@@ -239,6 +250,8 @@ struct ImGui_ImplOpenGL3_Data
     GLuint          ShaderHandle;
     GLint           AttribLocationTex;       // Uniforms location
     GLint           AttribLocationProjMtx;
+    GLint           AttribLocationUseSDF;
+    bool            ShaderUseSDF;            // Current value of UseSDF uniform
     GLuint          AttribLocationVtxPos;    // Vertex attributes location
     GLuint          AttribLocationVtxUV;
     GLuint          AttribLocationVtxColor;
@@ -366,6 +379,8 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
         io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
 #endif
     io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;       // We can honor ImGuiPlatformIO::Textures[] requests during render.
+    if (!bd->GlProfileIsES2)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasSdfTextures; // We can draw textures storing signed distance fields (requires fwidth(), not in GLSL ES 1.00).
 
     ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
     platform_io.Renderer_TextureMaxWidth = platform_io.Renderer_TextureMaxHeight = (int)bd->MaxTextureSize;
@@ -421,7 +436,7 @@ void    ImGui_ImplOpenGL3_Shutdown()
     ImGui_ImplOpenGL3_DestroyDeviceObjects();
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures);
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasSdfTextures);
     IM_DELETE(bd);
 
 #ifdef IMGUI_IMPL_OPENGL_LOADER_IMGL3W
@@ -482,17 +497,24 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     float B = draw_data->DisplayPos.y + draw_data->DisplaySize.y;
 #if defined(GL_CLIP_ORIGIN)
     if (!clip_origin_lower_left) { float tmp = T; T = B; B = tmp; } // Swap top and bottom if origin is upper left
+#endif
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    const float pos_scale = 1.0f / IM_DRAWVERT_COMPACT_POS_SCALE; // Positions are fixed-point integers
+#else
+    const float pos_scale = 1.0f;
 #endif
     const float ortho_projection[4][4] =
     {
-        { 2.0f/(R-L),   0.0f,         0.0f,   0.0f },
-        { 0.0f,         2.0f/(T-B),   0.0f,   0.0f },
-        { 0.0f,         0.0f,        -1.0f,   0.0f },
-        { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
+        { 2.0f/(R-L)*pos_scale, 0.0f,                 0.0f,   0.0f },
+        { 0.0f,                 2.0f/(T-B)*pos_scale, 0.0f,   0.0f },
+        { 0.0f,                 0.0f,                -1.0f,   0.0f },
+        { (R+L)/(L-R),          (T+B)/(B-T),          0.0f,   1.0f },
     };
     glUseProgram(bd->ShaderHandle);
     glUniform1i(bd->AttribLocationTex, 0);
     glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+    glUniform1i(bd->AttribLocationUseSDF, 0);
+    bd->ShaderUseSDF = false;
 
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
     if (bd->GlVersion >= 330 || bd->GlProfileIsES3)
@@ -510,8 +532,13 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxPos));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxUV));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxColor));
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_SHORT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+#else
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+#endif
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, col)));
 }
 
@@ -537,6 +564,12 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
             if (tex->Status != ImTextureStatus_OK)
                 ImGui_ImplOpenGL3_UpdateTexture(tex);
 
+    // Damage tracking (io.ConfigDamageTracking): only redraw damaged regions, nothing to do if nothing changed.
+    // Your app is responsible for preserving framebuffer contents between frames and clearing only damaged regions.
+    if (draw_data->DamageTracked && draw_data->DamageRects.Size == 0)
+        return;
+    const int damage_count = draw_data->DamageTracked ? draw_data->DamageRects.Size : 1;
+
     // Backup GL state
     GLenum last_active_texture; glGetIntegerv(GL_ACTIVE_TEXTURE, (GLint*)&last_active_texture);
     glActiveTexture(GL_TEXTURE0);
@@ -637,23 +670,42 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
             }
             else
             {
-                // Project scissor/clipping rectangles into framebuffer space
-                ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
-                ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
-                if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
-                    continue;
-
-                // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
-                GL_CALL(glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y)));
-
-                // Bind texture, Draw
-                GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
+                // Textures created by dear imgui may store signed distance fields (ImFontFlags_SDF)
+                const bool use_sdf = (pcmd->TexRef._TexData != nullptr && pcmd->TexRef._TexData->UseSDF);
+                if (bd->ShaderUseSDF != use_sdf)
+                {
+                    GL_CALL(glUniform1i(bd->AttribLocationUseSDF, use_sdf ? 1 : 0));
+                    bd->ShaderUseSDF = use_sdf;
+                }
+
+                // When damage tracking is enabled, draw once per damaged region intersecting the clipping rectangle (regions never overlap)
+                for (int damage_n = 0; damage_n < damage_count; damage_n++)
+                {
+                    ImVec4 clip_rect = pcmd->ClipRect;
+                    if (draw_data->DamageTracked)
+                    {
+                        const ImVec4& damage_rect = draw_data->DamageRects[damage_n];
+                        clip_rect = ImVec4(clip_rect.x > damage_rect.x ? clip_rect.x : damage_rect.x, clip_rect.y > damage_rect.y ? clip_rect.y : damage_rect.y, clip_rect.z < damage_rect.z ? clip_rect.z : damage_rect.z, clip_rect.w < damage_rect.w ? clip_rect.w : damage_rect.w);
+                    }
+
+                    // Project scissor/clipping rectangles into framebuffer space
+                    ImVec2 clip_min((clip_rect.x - clip_off.x) * clip_scale.x, (clip_rect.y - clip_off.y) * clip_scale.y);
+                    ImVec2 clip_max((clip_rect.z - clip_off.x) * clip_scale.x, (clip_rect.w - clip_off.y) * clip_scale.y);
+                    if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+                        continue;
+
+                    // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
+                    GL_CALL(glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y)));
+
+                    // Bind texture, Draw
+                    GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
-                if (bd->GlVersion >= 320)
-                    GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset));
-                else
+                    if (bd->GlVersion >= 320)
+                        GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset));
+                    else
 #endif
-                GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx))));
+                    GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx))));
+                }
             }
         }
     }
@@ -905,47 +957,78 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "    gl_Position = ProjMtx * vec4(Position.xy,0,1);\n"
         "}\n";
 
+    // Signed distance fields (UseSDF): alpha is 0.5 on glyph edges, anti-aliased over one pixel.
     const GLchar* fragment_shader_glsl_120 =
         "#ifdef GL_ES\n"
         "    precision mediump float;\n"
         "#endif\n"
         "uniform sampler2D Texture;\n"
+        "uniform bool UseSDF;\n"
         "varying vec2 Frag_UV;\n"
         "varying vec4 Frag_Color;\n"
         "void main()\n"
         "{\n"
-        "    gl_FragColor = Frag_Color * texture2D(Texture, Frag_UV.st);\n"
+        "    vec4 tex_col = texture2D(Texture, Frag_UV.st);\n"
+        "#ifndef GL_ES\n"
+        "    if (UseSDF)\n"
+        "    {\n"
+        "        float w = max(fwidth(tex_col.a) * 0.5, 1.0 / 255.0);\n"
+        "        tex_col.a = smoothstep(0.5 - w, 0.5 + w, tex_col.a);\n"
+        "    }\n"
+        "#endif\n"
+        "    gl_FragColor = Frag_Color * tex_col;\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_130 =
         "uniform sampler2D Texture;\n"
+        "uniform bool UseSDF;\n"
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    vec4 tex_col = texture(Texture, Frag_UV.st);\n"
+        "    if (UseSDF)\n"
+        "    {\n"
+        "        float w = max(fwidth(tex_col.a) * 0.5, 1.0 / 255.0);\n"
+        "        tex_col.a = smoothstep(0.5 - w, 0.5 + w, tex_col.a);\n"
+        "    }\n"
+        "    Out_Color = Frag_Color * tex_col;\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_300_es =
         "precision mediump float;\n"
         "uniform sampler2D Texture;\n"
+        "uniform bool UseSDF;\n"
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "layout (location = 0) out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    vec4 tex_col = texture(Texture, Frag_UV.st);\n"
+        "    if (UseSDF)\n"
+        "    {\n"
+        "        float w = max(fwidth(tex_col.a) * 0.5, 1.0 / 255.0);\n"
+        "        tex_col.a = smoothstep(0.5 - w, 0.5 + w, tex_col.a);\n"
+        "    }\n"
+        "    Out_Color = Frag_Color * tex_col;\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_410_core =
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "uniform sampler2D Texture;\n"
+        "uniform bool UseSDF;\n"
         "layout (location = 0) out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    vec4 tex_col = texture(Texture, Frag_UV.st);\n"
+        "    if (UseSDF)\n"
+        "    {\n"
+        "        float w = max(fwidth(tex_col.a) * 0.5, 1.0 / 255.0);\n"
+        "        tex_col.a = smoothstep(0.5 - w, 0.5 + w, tex_col.a);\n"
+        "    }\n"
+        "    Out_Color = Frag_Color * tex_col;\n"
         "}\n";
 
     // Select shaders matching our GLSL versions
@@ -1004,6 +1087,7 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
 
     bd->AttribLocationTex = glGetUniformLocation(bd->ShaderHandle, "Texture");
     bd->AttribLocationProjMtx = glGetUniformLocation(bd->ShaderHandle, "ProjMtx");
+    bd->AttribLocationUseSDF = glGetUniformLocation(bd->ShaderHandle, "UseSDF");
     bd->AttribLocationVtxPos = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Position");
     bd->AttribLocationVtxUV = (GLuint)glGetAttribLocation(bd->ShaderHandle, "UV");
     bd->AttribLocationVtxColor = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Color");
@@ -5,6 +5,7 @@
 //  [X] Renderer: User texture binding. Use 'SDL_GPUTexture*' as texture identifier. Read the FAQ about ImTextureID/ImTextureRef! **IMPORTANT** Before 2025/08/08, ImTextureID was a reference to a SDL_GPUTextureSamplerBinding struct.
 //  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
 //  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [X] Renderer: Compact vertex layout support (IMGUI_USE_COMPACT_DRAWVERT).
 
 // The aim of imgui_impl_sdlgpu3.h/.cpp is to be usable in your engine without any modification.
 // IF YOU FEEL YOU NEED TO MAKE ANY CHANGE TO THIS CODE, please share them and your feedback at https://github.com/ocornut/imgui/
@@ -22,6 +23,7 @@
 //   Calling the function is MANDATORY, otherwise the ImGui will not upload neither the vertex nor the index buffer for the GPU. See imgui_impl_sdlgpu3.cpp for more info.
 
 // CHANGELOG
+//  2025-08-26: Added support for compact vertex layout (IMGUI_USE_COMPACT_DRAWVERT): 16-bit fixed-point positions and 16-bit normalized UV.
 //  2025-08-20: Added ImGui_ImplSDLGPU3_InitInfo::SwapchainComposition and ImGui_ImplSDLGPU3_InitInfo::PresentMode to configure how secondary viewports are created.
 //  2025-08-08: *BREAKING* Changed ImTextureID type from SDL_GPUTextureSamplerBinding* to SDL_GPUTexture*, which is more natural and easier for user to manage. If you need to change the current sampler, you can access the ImGui_ImplSDLGPU3_RenderState struct. (#8866, #8163, #7998, #7988)
 //  2025-08-08: Expose SamplerDefault and SamplerCurrent in ImGui_ImplSDLGPU3_RenderState. Allow callback to change sampler.
@@ -120,6 +122,11 @@ static void ImGui_ImplSDLGPU3_SetupRenderState(ImDrawData* draw_data, ImGui_Impl
     ubo.scale[1] = 2.0f / draw_data->DisplaySize.y;
     ubo.translation[0] = -1.0f - draw_data->DisplayPos.x * ubo.scale[0];
     ubo.translation[1] = -1.0f - draw_data->DisplayPos.y * ubo.scale[1];
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    // Positions are fixed-point integers read as SDL_GPU_VERTEXELEMENTFORMAT_SHORT2_NORM: [-32767,+32767] -> [-1.0f,+1.0f]
+    ubo.scale[0] *= 32767.0f / IM_DRAWVERT_COMPACT_POS_SCALE;
+    ubo.scale[1] *= 32767.0f / IM_DRAWVERT_COMPACT_POS_SCALE;
+#endif
     SDL_PushGPUVertexUniformData(command_buffer, 0, &ubo, sizeof(UBO));
 }
 
@@ -482,12 +489,20 @@ static void ImGui_ImplSDLGPU3_CreateGraphicsPipeline()
 
     SDL_GPUVertexAttribute vertex_attributes[3];
     vertex_attributes[0].buffer_slot = 0;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    vertex_attributes[0].format = SDL_GPU_VERTEXELEMENTFORMAT_SHORT2_NORM; // Scaled back in uniform data
+#else
     vertex_attributes[0].format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT2;
+#endif
     vertex_attributes[0].location = 0;
     vertex_attributes[0].offset = offsetof(ImDrawVert,pos);
 
     vertex_attributes[1].buffer_slot = 0;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    vertex_attributes[1].format = SDL_GPU_VERTEXELEMENTFORMAT_USHORT2_NORM;
+#else
     vertex_attributes[1].format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT2;
+#endif
     vertex_attributes[1].location = 1;
     vertex_attributes[1].offset = offsetof(ImDrawVert, uv);
 
@@ -14,6 +14,7 @@
 //  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
 //  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
 //  [X] Renderer: Expose selected render state for draw callbacks to use. Access in '(ImGui_ImplXXXX_RenderState*)GetPlatformIO().Renderer_RenderState'.
+//  [X] Renderer: Damage tracking support: only redraw regions listed in ImDrawData::DamageRects[] when io.ConfigDamageTracking is enabled.
 
 // You can copy and use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
 // Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
@@ -24,6 +25,7 @@
 // - Introduction, links and more at the top of imgui.cpp
 
 // CHANGELOG
+//  2025-08-25: Support for damage tracking (io.ConfigDamageTracking): only redraw regions listed in ImDrawData::DamageRects[], skip rendering when nothing changed.
 //  2025-06-11: Added support for ImGuiBackendFlags_RendererHasTextures, for dynamic font atlas. Removed ImGui_ImplSDLRenderer3_CreateFontsTexture() and ImGui_ImplSDLRenderer3_DestroyFontsTexture().
 //  2025-01-18: Use endian-dependent RGBA32 texture format, to match SDL_Color.
 //  2024-10-09: Expose selected render state in ImGui_ImplSDLRenderer3_RenderState, which you can access in 'void* platform_io.Renderer_RenderState' during draw callbacks.
@@ -35,6 +37,9 @@
 #include "imgui.h"
 #ifndef IMGUI_DISABLE
 #include "imgui_impl_sdlrenderer3.h"
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#error "IMGUI_USE_COMPACT_DRAWVERT is not supported by this backend."
+#endif
 #include <stdint.h>     // intptr_t
 
 // Clang warnings with -Weverything
@@ -161,6 +166,12 @@ void ImGui_ImplSDLRenderer3_RenderDrawData(ImDrawData* draw_data, SDL_Renderer*
             if (tex->Status != ImTextureStatus_OK)
                 ImGui_ImplSDLRenderer3_UpdateTexture(tex);
 
+    // Damage tracking (io.ConfigDamageTracking): only redraw damaged regions, nothing to do if nothing changed.
+    // Your app is responsible for preserving render target contents between frames and clearing only damaged regions.
+    if (draw_data->DamageTracked && draw_data->DamageRects.Size == 0)
+        return;
+    const int damage_count = draw_data->DamageTracked ? draw_data->DamageRects.Size : 1;
+
     // Backup SDL_Renderer state that will be modified to restore it afterwards
     struct BackupSDLRendererState
     {
@@ -208,31 +219,42 @@ void ImGui_ImplSDLRenderer3_RenderDrawData(ImDrawData* draw_data, SDL_Renderer*
             }
             else
             {
-                // Project scissor/clipping rectangles into framebuffer space
-                ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
-                ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
-                if (clip_min.x < 0.0f) { clip_min.x = 0.0f; }
-                if (clip_min.y < 0.0f) { clip_min.y = 0.0f; }
-                if (clip_max.x > (float)fb_width) { clip_max.x = (float)fb_width; }
-                if (clip_max.y > (float)fb_height) { clip_max.y = (float)fb_height; }
-                if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
-                    continue;
-
-                SDL_Rect r = { (int)(clip_min.x), (int)(clip_min.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y) };
-                SDL_SetRenderClipRect(renderer, &r);
-
-                const float* xy = (const float*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, pos));
-                const float* uv = (const float*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, uv));
-                const SDL_Color* color = (const SDL_Color*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, col)); // SDL 2.0.19+
-
-                // Bind texture, Draw
-                SDL_Texture* tex = (SDL_Texture*)pcmd->GetTexID();
-                SDL_RenderGeometryRaw8BitColor(renderer, bd->ColorBuffer, tex,
-                    xy, (int)sizeof(ImDrawVert),
-                    color, (int)sizeof(ImDrawVert),
-                    uv, (int)sizeof(ImDrawVert),
-                    draw_list->VtxBuffer.Size - pcmd->VtxOffset,
-                    idx_buffer + pcmd->IdxOffset, pcmd->ElemCount, sizeof(ImDrawIdx));
+                // When damage tracking is enabled, draw once per damaged region intersecting the clipping rectangle (regions never overlap)
+                for (int damage_n = 0; damage_n < damage_count; damage_n++)
+                {
+                    ImVec4 clip_rect = pcmd->ClipRect;
+                    if (draw_data->DamageTracked)
+                    {
+                        const ImVec4& damage_rect = draw_data->DamageRects[damage_n];
+                        clip_rect = ImVec4(clip_rect.x > damage_rect.x ? clip_rect.x : damage_rect.x, clip_rect.y > damage_rect.y ? clip_rect.y : damage_rect.y, clip_rect.z < damage_rect.z ? clip_rect.z : damage_rect.z, clip_rect.w < damage_rect.w ? clip_rect.w : damage_rect.w);
+                    }
+
+                    // Project scissor/clipping rectangles into framebuffer space
+                    ImVec2 clip_min((clip_rect.x - clip_off.x) * clip_scale.x, (clip_rect.y - clip_off.y) * clip_scale.y);
+                    ImVec2 clip_max((clip_rect.z - clip_off.x) * clip_scale.x, (clip_rect.w - clip_off.y) * clip_scale.y);
+                    if (clip_min.x < 0.0f) { clip_min.x = 0.0f; }
+                    if (clip_min.y < 0.0f) { clip_min.y = 0.0f; }
+                    if (clip_max.x > (float)fb_width) { clip_max.x = (float)fb_width; }
+                    if (clip_max.y > (float)fb_height) { clip_max.y = (float)fb_height; }
+                    if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+                        continue;
+
+                    SDL_Rect r = { (int)(clip_min.x), (int)(clip_min.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y) };
+                    SDL_SetRenderClipRect(renderer, &r);
+
+                    const float* xy = (const float*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, pos));
+                    const float* uv = (const float*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, uv));
+                    const SDL_Color* color = (const SDL_Color*)(const void*)((const char*)(vtx_buffer + pcmd->VtxOffset) + offsetof(ImDrawVert, col)); // SDL 2.0.19+
+
+                    // Bind texture, Draw
+                    SDL_Texture* tex = (SDL_Texture*)pcmd->GetTexID();
+                    SDL_RenderGeometryRaw8BitColor(renderer, bd->ColorBuffer, tex,
+                        xy, (int)sizeof(ImDrawVert),
+                        color, (int)sizeof(ImDrawVert),
+                        uv, (int)sizeof(ImDrawVert),
+                        draw_list->VtxBuffer.Size - pcmd->VtxOffset,
+                        idx_buffer + pcmd->IdxOffset, pcmd->ElemCount, sizeof(ImDrawIdx));
+                }
             }
         }
     }
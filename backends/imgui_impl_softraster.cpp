@@ -0,0 +1,992 @@
+// dear imgui: Renderer Backend for CPU software rasterization into a RGBA32 pixel buffer
+// This needs to be used along with a Platform Backend (e.g. Win32, SDL) or your own code to display the output buffer. It may also be used headless (e.g. servers, regression tests).
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftRaster_Texture*' as texture identifier. Read the FAQ about ImTextureID/ImTextureRef!
+//  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [X] Renderer: Expose selected render state for draw callbacks to use. Access in '(ImGui_ImplXXXX_RenderState*)GetPlatformIO().Renderer_RenderState'.
+//  [X] Renderer: Damage tracking support: only redraw regions listed in ImDrawData::DamageRects[] when io.ConfigDamageTracking is enabled.
+//  [X] Renderer: Multi-threaded rasterization, using backend owned threads or your own job system.
+//  [X] Renderer: Compact vertex layout support (IMGUI_USE_COMPACT_DRAWVERT).
+//  [X] Renderer: Signed distance field textures support, for fonts using ImFontFlags_SDF (ImGuiBackendFlags_RendererHasSdfTextures).
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+// CHANGELOG
+//  2025-08-29: Support for signed distance field textures (ImGuiBackendFlags_RendererHasSdfTextures), used by ImFontFlags_SDF fonts.
+//  2025-08-26: Support for compact vertex layout (IMGUI_USE_COMPACT_DRAWVERT).
+//  2025-08-25: Initial version.
+
+// How it works:
+// - Triangles are setup and binned into the screen tiles they overlap (IMGUI_IMPL_SOFTRASTER_TILE_SIZE), in submission order.
+// - Pairs of triangles forming axis-aligned rectangles (most of Dear ImGui geometry: text, filled rectangles, images) are detected
+//   and binned as a single quad primitive, which is filled row by row without edge tests. Quads mapping texels 1:1 (e.g. text) skip filtering.
+// - Tiles are rasterized independently, possibly on multiple threads, each processing its primitives in order.
+//   Other triangles use edge functions evaluated 4 pixels at a time with SSE2, blending is done 4 pixels at a time on quads.
+// - All color math is done in integer with identical SIMD and scalar code paths, so output doesn't depend on threads or SIMD.
+// - Pixels are processed as ImU32 with alpha in the high byte, which assumes a little-endian architecture.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_softraster.h"
+#include <stdint.h>     // intptr_t
+#include <string.h>     // memcpy, memset
+#include <math.h>       // floorf, ceilf, fabsf
+#ifndef IMGUI_IMPL_SOFTRASTER_DISABLE_THREADS
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+// SSE2 is used when available (always the case on x86-64)
+#if !defined(IMGUI_DISABLE_SSE) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define IMGUI_IMPL_SOFTRASTER_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+// Clang warnings with -Weverything
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wsign-conversion"    // warning: implicit conversion changes signedness
+#pragma clang diagnostic ignored "-Wfloat-equal"        // warning: comparing floating-point with '==' or '!=' is unsafe
+#elif defined(__GNUC__)
+#pragma GCC diagnostic ignored "-Wfloat-equal"          // warning: comparing floating-point with '==' or '!=' is unsafe
+#endif
+
+#define IMGUI_IMPL_SOFTRASTER_TILE_SIZE     64      // Width and height of a tile, in pixels
+
+template<typename T> static inline T ImGui_ImplSoftRaster_Min(T a, T b)            { return a < b ? a : b; }
+template<typename T> static inline T ImGui_ImplSoftRaster_Max(T a, T b)            { return a >= b ? a : b; }
+template<typename T> static inline T ImGui_ImplSoftRaster_Clamp(T v, T mn, T mx)   { return (v < mn) ? mn : (v > mx) ? mx : v; }
+template<typename T> static inline void ImGui_ImplSoftRaster_Swap(T& a, T& b)      { T tmp = a; a = b; b = tmp; }
+
+enum ImGui_ImplSoftRaster_PrimType
+{
+    ImGui_ImplSoftRaster_PrimType_Triangle,
+    ImGui_ImplSoftRaster_PrimType_Quad,
+};
+
+struct ImGui_ImplSoftRaster_Rect
+{
+    int     X0, Y0, X1, Y1;                     // X1, Y1 are exclusive
+};
+
+struct ImGui_ImplSoftRaster_Prim
+{
+    ImGui_ImplSoftRaster_PrimType Type;
+    ImGui_ImplSoftRaster_Rect     Bounds;       // Pixels which may be covered, clipped by scissor and framebuffer. Exact coverage for quads.
+    const ImGui_ImplSoftRaster_Texture* Tex;
+    ImVec2  Pos[3];                             // Triangle: vertices with positive area. Quad: Pos[0] = min, Pos[1] = max.
+    ImVec2  Uv[3];                              // Triangle: vertices UV. Quad: Uv[0] at Pos[0], Uv[1] at Pos[1].
+    ImU32   Col[3];                             // Triangle: vertices color. Quad: Col[0]. Always R,G,B,A in memory order.
+    bool    Sdf;                                // Texture alpha stores signed distance fields (ImTextureData::UseSDF)
+};
+
+// Renderer data
+struct ImGui_ImplSoftRaster_Data
+{
+    ImGui_ImplSoftRaster_InitInfo       InitInfo;
+
+    // Current render target
+    ImU8*                               Pixels = nullptr;
+    int                                 Width = 0;
+    int                                 Height = 0;
+    int                                 Stride = 0;
+    ImVector<ImGui_ImplSoftRaster_Rect> Regions;        // Regions to redraw (whole framebuffer, or damaged regions)
+
+    // Primitives and tiles
+    ImVector<ImGui_ImplSoftRaster_Prim> Prims;
+    int                                 TilesX = 0;
+    int                                 TilesY = 0;
+    ImVector<int>                       TileBinOffsets; // Offset into TileBinPrims[] for each tile + 1 terminator
+    ImVector<int>                       TileBinPrims;   // Primitive indices, grouped by tile
+    ImVector<int>                       ActiveTiles;    // Tiles with primitives
+
+#ifndef IMGUI_IMPL_SOFTRASTER_DISABLE_THREADS
+    // Worker threads
+    ImVector<std::thread*>              Threads;
+    std::mutex                          WorkMutex;
+    std::condition_variable             WorkStartCond;
+    std::condition_variable             WorkDoneCond;
+    int                                 WorkGeneration = 0;
+    int                                 WorkPending = 0;
+    bool                                WorkQuit = false;
+    void                                (*WorkFunc)(void* func_user_data, int index) = nullptr;
+    void*                               WorkFuncUserData = nullptr;
+    int                                 WorkCount = 0;
+    std::atomic<int>                    WorkNext;
+#endif
+
+    ImGui_ImplSoftRaster_Data()         {}
+};
+
+// Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
+// It is STRONGLY preferred that you use docking branch with multi-viewports (== single Dear ImGui context + multiple windows) instead of multiple Dear ImGui contexts.
+static ImGui_ImplSoftRaster_Data* ImGui_ImplSoftRaster_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplSoftRaster_Data*)ImGui::GetIO().BackendRendererUserData : nullptr;
+}
+
+//-----------------------------------------------------------------------------
+// Parallel execution
+//-----------------------------------------------------------------------------
+
+#ifndef IMGUI_IMPL_SOFTRASTER_DISABLE_THREADS
+static void ImGui_ImplSoftRaster_RunWork(ImGui_ImplSoftRaster_Data* bd)
+{
+    for (int n = bd->WorkNext++; n < bd->WorkCount; n = bd->WorkNext++)
+        bd->WorkFunc(bd->WorkFuncUserData, n);
+}
+
+static void ImGui_ImplSoftRaster_WorkerThread(ImGui_ImplSoftRaster_Data* bd)
+{
+    int generation = 0;
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(bd->WorkMutex);
+            bd->WorkStartCond.wait(lock, [&]() { return bd->WorkQuit || bd->WorkGeneration != generation; });
+            if (bd->WorkQuit)
+                return;
+            generation = bd->WorkGeneration;
+        }
+        ImGui_ImplSoftRaster_RunWork(bd);
+        {
+            std::lock_guard<std::mutex> lock(bd->WorkMutex);
+            if (--bd->WorkPending == 0)
+                bd->WorkDoneCond.notify_one();
+        }
+    }
+}
+#endif
+
+static void ImGui_ImplSoftRaster_ParallelFor(ImGui_ImplSoftRaster_Data* bd, void (*func)(void* func_user_data, int index), void* func_user_data, int count)
+{
+    if (bd->InitInfo.ParallelFor != nullptr && count > 1)
+    {
+        bd->InitInfo.ParallelFor(func, func_user_data, count, bd->InitInfo.ParallelForUserData);
+        return;
+    }
+#ifndef IMGUI_IMPL_SOFTRASTER_DISABLE_THREADS
+    if (bd->Threads.Size > 0 && count > 1)
+    {
+        {
+            std::lock_guard<std::mutex> lock(bd->WorkMutex);
+            bd->WorkFunc = func;
+            bd->WorkFuncUserData = func_user_data;
+            bd->WorkCount = count;
+            bd->WorkNext = 0;
+            bd->WorkPending = bd->Threads.Size;
+            bd->WorkGeneration++;
+        }
+        bd->WorkStartCond.notify_all();
+        ImGui_ImplSoftRaster_RunWork(bd);
+        std::unique_lock<std::mutex> lock(bd->WorkMutex);
+        bd->WorkDoneCond.wait(lock, [&]() { return bd->WorkPending == 0; });
+        return;
+    }
+#endif
+    for (int n = 0; n < count; n++)
+        func(func_user_data, n);
+}
+
+//-----------------------------------------------------------------------------
+// Pixel operations
+//-----------------------------------------------------------------------------
+// - Mul: per channel (a * b) / 255, rounded.
+// - Blend: per channel (src * src_alpha + dst * (255 - src_alpha)) / 255, rounded. Alpha channel is (src_alpha * 255 + dst_alpha * (255 - src_alpha)) / 255.
+//   This is the usual alpha blending used by other backends (SrcAlpha, OneMinusSrcAlpha for colors, One, OneMinusSrcAlpha for alpha).
+// - SSE2 versions are using the exact same integer operations on 16-bit lanes.
+//-----------------------------------------------------------------------------
+
+static inline ImU32 ImGui_ImplSoftRaster_Div255(ImU32 v)
+{
+    v += 128;
+    return (v + (v >> 8)) >> 8;
+}
+
+static inline ImU32 ImGui_ImplSoftRaster_Mul(ImU32 a, ImU32 b)
+{
+    ImU32 out = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+        out |= ImGui_ImplSoftRaster_Div255(((a >> shift) & 0xFF) * ((b >> shift) & 0xFF)) << shift;
+    return out;
+}
+
+static inline ImU32 ImGui_ImplSoftRaster_Blend(ImU32 src, ImU32 dst)
+{
+    const ImU32 src_a = src >> 24;
+    if (src_a == 0)
+        return dst;
+    if (src_a == 255)
+        return src;
+    ImU32 out = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        const ImU32 src_factor = (shift == 24) ? 255 : src_a;
+        out |= ImGui_ImplSoftRaster_Div255(((src >> shift) & 0xFF) * src_factor + ((dst >> shift) & 0xFF) * (255 - src_a)) << shift;
+    }
+    return out;
+}
+
+#ifdef IMGUI_IMPL_SOFTRASTER_USE_SSE2
+static inline __m128i ImGui_ImplSoftRaster_Div255_SSE2(__m128i v)
+{
+    v = _mm_add_epi16(v, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(v, _mm_srli_epi16(v, 8)), 8);
+}
+
+// Blend 2 pixels stored as 8 x 16-bit lanes
+static inline __m128i ImGui_ImplSoftRaster_Blend16_SSE2(__m128i src, __m128i dst)
+{
+    const __m128i src_a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    const __m128i src_factor = _mm_or_si128(_mm_and_si128(src_a, _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1)), _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0));
+    const __m128i dst_factor = _mm_sub_epi16(_mm_set1_epi16(255), src_a);
+    return ImGui_ImplSoftRaster_Div255_SSE2(_mm_add_epi16(_mm_mullo_epi16(src, src_factor), _mm_mullo_epi16(dst, dst_factor)));
+}
+
+// Blend 4 pixels
+static inline __m128i ImGui_ImplSoftRaster_Blend_SSE2(__m128i src, __m128i dst)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lo = ImGui_ImplSoftRaster_Blend16_SSE2(_mm_unpacklo_epi8(src, zero), _mm_unpacklo_epi8(dst, zero));
+    const __m128i hi = ImGui_ImplSoftRaster_Blend16_SSE2(_mm_unpackhi_epi8(src, zero), _mm_unpackhi_epi8(dst, zero));
+    return _mm_packus_epi16(lo, hi);
+}
+#endif
+
+// Blend a constant color over a span of pixels
+static void ImGui_ImplSoftRaster_BlendSpanConst(ImU32* dst, ImU32 src, int count)
+{
+    const ImU32 src_a = src >> 24;
+    if (src_a == 0)
+        return;
+    if (src_a == 255)
+    {
+        for (int n = 0; n < count; n++)
+            dst[n] = src;
+        return;
+    }
+    int n = 0;
+#ifdef IMGUI_IMPL_SOFTRASTER_USE_SSE2
+    const __m128i src4 = _mm_set1_epi32((int)src);
+    for (; n + 4 <= count; n += 4)
+        _mm_storeu_si128((__m128i*)(void*)(dst + n), ImGui_ImplSoftRaster_Blend_SSE2(src4, _mm_loadu_si128((const __m128i*)(const void*)(dst + n))));
+#endif
+    for (; n < count; n++)
+        dst[n] = ImGui_ImplSoftRaster_Blend(src, dst[n]);
+}
+
+// Blend a span of texels multiplied by a constant color
+static void ImGui_ImplSoftRaster_BlendSpanTexels(ImU32* dst, const ImU32* texels, ImU32 col, int count)
+{
+    int n = 0;
+#ifdef IMGUI_IMPL_SOFTRASTER_USE_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i col16 = _mm_unpacklo_epi8(_mm_set1_epi32((int)col), zero);
+    for (; n + 4 <= count; n += 4)
+    {
+        const __m128i tex = _mm_loadu_si128((const __m128i*)(const void*)(texels + n));
+        const __m128i src_lo = ImGui_ImplSoftRaster_Div255_SSE2(_mm_mullo_epi16(_mm_unpacklo_epi8(tex, zero), col16));
+        const __m128i src_hi = ImGui_ImplSoftRaster_Div255_SSE2(_mm_mullo_epi16(_mm_unpackhi_epi8(tex, zero), col16));
+        const __m128i src = _mm_packus_epi16(src_lo, src_hi);
+        const int src_a_zero = _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_srli_epi32(src, 24), zero));
+        if (src_a_zero == 0xFFFF)
+            continue; // Fully transparent (frequent for text)
+        const __m128i dst4 = _mm_loadu_si128((const __m128i*)(const void*)(dst + n));
+        _mm_storeu_si128((__m128i*)(void*)(dst + n), _mm_packus_epi16(ImGui_ImplSoftRaster_Blend16_SSE2(src_lo, _mm_unpacklo_epi8(dst4, zero)), ImGui_ImplSoftRaster_Blend16_SSE2(src_hi, _mm_unpackhi_epi8(dst4, zero))));
+    }
+#endif
+    for (; n < count; n++)
+        dst[n] = ImGui_ImplSoftRaster_Blend(ImGui_ImplSoftRaster_Mul(texels[n], col), dst[n]);
+}
+
+// Bilinear sampling with clamp-to-edge addressing
+static ImU32 ImGui_ImplSoftRaster_SampleBilinear(const ImGui_ImplSoftRaster_Texture* tex, float u, float v)
+{
+    float s = u * (float)tex->Width - 0.5f;
+    float t = v * (float)tex->Height - 0.5f;
+    s = (s < -1.0f) ? -1.0f : (s > (float)tex->Width) ? (float)tex->Width : s;  // Also catches NaN
+    t = (t < -1.0f) ? -1.0f : (t > (float)tex->Height) ? (float)tex->Height : t;
+    const float s_floor = floorf(s);
+    const float t_floor = floorf(t);
+    const int wx = (int)((s - s_floor) * 256.0f);
+    const int wy = (int)((t - t_floor) * 256.0f);
+    int x0 = (int)s_floor, y0 = (int)t_floor;
+    int x1 = x0 + 1, y1 = y0 + 1;
+    x0 = (x0 < 0) ? 0 : (x0 >= tex->Width) ? tex->Width - 1 : x0;
+    x1 = (x1 < 0) ? 0 : (x1 >= tex->Width) ? tex->Width - 1 : x1;
+    y0 = (y0 < 0) ? 0 : (y0 >= tex->Height) ? tex->Height - 1 : y0;
+    y1 = (y1 < 0) ? 0 : (y1 >= tex->Height) ? tex->Height - 1 : y1;
+    const ImU32 c00 = tex->Pixels[y0 * tex->Width + x0];
+    if (wx == 0 && wy == 0)
+        return c00;
+    const ImU32 c10 = tex->Pixels[y0 * tex->Width + x1];
+    const ImU32 c01 = tex->Pixels[y1 * tex->Width + x0];
+    const ImU32 c11 = tex->Pixels[y1 * tex->Width + x1];
+    ImU32 out = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        const ImU32 top = ((c00 >> shift) & 0xFF) * (ImU32)(256 - wx) + ((c10 >> shift) & 0xFF) * (ImU32)wx;
+        const ImU32 bottom = ((c01 >> shift) & 0xFF) * (ImU32)(256 - wx) + ((c11 >> shift) & 0xFF) * (ImU32)wx;
+        out |= ((top * (ImU32)(256 - wy) + bottom * (ImU32)wy + 32768) >> 16) << shift;
+    }
+    return out;
+}
+
+// Signed distance fields: alpha stores distance to the edge (0.5 on edge). Anti-alias over one pixel, using the change of
+// distance toward neighbor pixels as shaders would do with fwidth(). 'duv_dx'/'duv_dy' are UV steps for one pixel.
+static ImU32 ImGui_ImplSoftRaster_SampleSdf(const ImGui_ImplSoftRaster_Texture* tex, float u, float v, ImVec2 duv_dx, ImVec2 duv_dy)
+{
+    const ImU32 texel = ImGui_ImplSoftRaster_SampleBilinear(tex, u, v);
+    const float d = (float)(texel >> 24);
+    const float d_dx = (float)(ImGui_ImplSoftRaster_SampleBilinear(tex, u + duv_dx.x, v + duv_dx.y) >> 24) - d;
+    const float d_dy = (float)(ImGui_ImplSoftRaster_SampleBilinear(tex, u + duv_dy.x, v + duv_dy.y) >> 24) - d;
+    const float w = ImGui_ImplSoftRaster_Max((fabsf(d_dx) + fabsf(d_dy)) * 0.5f, 1.0f);
+    float a = ImGui_ImplSoftRaster_Clamp((d - (127.5f - w)) / (w * 2.0f), 0.0f, 1.0f);
+    a = a * a * (3.0f - 2.0f * a); // smoothstep()
+    return (texel & 0x00FFFFFF) | ((ImU32)(a * 255.0f + 0.5f) << 24);
+}
+
+//-----------------------------------------------------------------------------
+// Rasterization
+//-----------------------------------------------------------------------------
+
+static void ImGui_ImplSoftRaster_RasterizeQuad(ImGui_ImplSoftRaster_Data* bd, const ImGui_ImplSoftRaster_Prim& prim, const ImGui_ImplSoftRaster_Rect& r)
+{
+    const ImGui_ImplSoftRaster_Texture* tex = prim.Tex;
+    const int width = r.X1 - r.X0;
+    ImU8* dst_row = bd->Pixels + r.Y0 * bd->Stride + r.X0 * 4;
+
+    // Solid color (e.g. filled rectangles use the white pixel)
+    if (prim.Uv[0].x == prim.Uv[1].x && prim.Uv[0].y == prim.Uv[1].y && !prim.Sdf)
+    {
+        const ImU32 src = ImGui_ImplSoftRaster_Mul(ImGui_ImplSoftRaster_SampleBilinear(tex, prim.Uv[0].x, prim.Uv[0].y), prim.Col[0]);
+        for (int y = r.Y0; y < r.Y1; y++, dst_row += bd->Stride)
+            ImGui_ImplSoftRaster_BlendSpanConst((ImU32*)(void*)dst_row, src, width);
+        return;
+    }
+
+    // Texture coordinates are linear over the quad: s(x) = s_at_x0 + (x - x0) * s_step
+    const float s_step = (prim.Uv[1].x - prim.Uv[0].x) * (float)tex->Width / (prim.Pos[1].x - prim.Pos[0].x);
+    const float t_step = (prim.Uv[1].y - prim.Uv[0].y) * (float)tex->Height / (prim.Pos[1].y - prim.Pos[0].y);
+    const float s0 = prim.Uv[0].x * (float)tex->Width + ((float)r.X0 + 0.5f - prim.Pos[0].x) * s_step - 0.5f;
+    const float t0 = prim.Uv[0].y * (float)tex->Height + ((float)r.Y0 + 0.5f - prim.Pos[0].y) * t_step - 0.5f;
+
+    // Texels mapped 1:1 to pixels (e.g. text): copy without filtering
+    const float s0_round = floorf(s0 + 0.5f);
+    const float t0_round = floorf(t0 + 0.5f);
+    if (fabsf(s_step - 1.0f) < 1e-4f && fabsf(t_step - 1.0f) < 1e-4f && fabsf(s0 - s0_round) < 1e-3f && fabsf(t0 - t0_round) < 1e-3f && !prim.Sdf)
+    {
+        const int tex_x = (int)s0_round;
+        const int tex_y = (int)t0_round;
+        if (tex_x >= 0 && tex_y >= 0 && tex_x + width <= tex->Width && tex_y + (r.Y1 - r.Y0) <= tex->Height)
+        {
+            const ImU32* tex_row = tex->Pixels + tex_y * tex->Width + tex_x;
+            for (int y = r.Y0; y < r.Y1; y++, dst_row += bd->Stride, tex_row += tex->Width)
+                ImGui_ImplSoftRaster_BlendSpanTexels((ImU32*)(void*)dst_row, tex_row, prim.Col[0], width);
+            return;
+        }
+    }
+
+    // Generic path: bilinear filtering
+    const float inv_w = 1.0f / (float)tex->Width;
+    const float inv_h = 1.0f / (float)tex->Height;
+    if (prim.Sdf)
+    {
+        const ImVec2 duv_dx(s_step * inv_w, 0.0f);
+        const ImVec2 duv_dy(0.0f, t_step * inv_h);
+        for (int y = r.Y0; y < r.Y1; y++, dst_row += bd->Stride)
+        {
+            ImU32* dst = (ImU32*)(void*)dst_row;
+            const float v = (t0 + (float)(y - r.Y0) * t_step + 0.5f) * inv_h;
+            for (int x = 0; x < width; x++)
+            {
+                const float u = (s0 + (float)x * s_step + 0.5f) * inv_w;
+                dst[x] = ImGui_ImplSoftRaster_Blend(ImGui_ImplSoftRaster_Mul(ImGui_ImplSoftRaster_SampleSdf(tex, u, v, duv_dx, duv_dy), prim.Col[0]), dst[x]);
+            }
+        }
+        return;
+    }
+    for (int y = r.Y0; y < r.Y1; y++, dst_row += bd->Stride)
+    {
+        ImU32* dst = (ImU32*)(void*)dst_row;
+        const float v = (t0 + (float)(y - r.Y0) * t_step + 0.5f) * inv_h;
+        for (int x = 0; x < width; x++)
+        {
+            const float u = (s0 + (float)x * s_step + 0.5f) * inv_w;
+            dst[x] = ImGui_ImplSoftRaster_Blend(ImGui_ImplSoftRaster_Mul(ImGui_ImplSoftRaster_SampleBilinear(tex, u, v), prim.Col[0]), dst[x]);
+        }
+    }
+}
+
+struct ImGui_ImplSoftRaster_TriangleSetup
+{
+    float   EdgeA[3], EdgeB[3], EdgeC[3];   // Edge i is opposite to vertex i: E(x,y) = A*x + (B*y + C), > 0 inside
+    bool    EdgeIncl[3];                    // Include pixels centers lying exactly on the edge (top-left rule), so shared edges are drawn exactly once
+    float   InvArea;
+    float   Col[3][4];
+    bool    SolidCol;
+    bool    SolidUv;
+    ImU32   SolidSrc;                       // Valid when SolidCol && SolidUv
+    ImU32   SolidTexel;                     // Valid when SolidUv
+    ImVec2  DuvDx, DuvDy;                   // UV steps for one pixel, valid when prim.Sdf
+};
+
+static void ImGui_ImplSoftRaster_ShadePixel(const ImGui_ImplSoftRaster_Prim& prim, const ImGui_ImplSoftRaster_TriangleSetup& setup, float e0, float e1, float e2, ImU32* dst)
+{
+    if (setup.SolidCol && setup.SolidUv)
+    {
+        *dst = ImGui_ImplSoftRaster_Blend(setup.SolidSrc, *dst);
+        return;
+    }
+    const float w0 = e0 * setup.InvArea, w1 = e1 * setup.InvArea, w2 = e2 * setup.InvArea;
+    ImU32 col = prim.Col[0];
+    if (!setup.SolidCol)
+    {
+        col = 0;
+        for (int ch = 0; ch < 4; ch++)
+        {
+            const float c = setup.Col[0][ch] * w0 + setup.Col[1][ch] * w1 + setup.Col[2][ch] * w2 + 0.5f;
+            col |= (ImU32)((c < 0.0f) ? 0 : (c > 255.0f) ? 255 : (int)c) << (ch * 8);
+        }
+    }
+    ImU32 texel = setup.SolidTexel;
+    if (!setup.SolidUv)
+    {
+        const float u = prim.Uv[0].x * w0 + prim.Uv[1].x * w1 + prim.Uv[2].x * w2;
+        const float v = prim.Uv[0].y * w0 + prim.Uv[1].y * w1 + prim.Uv[2].y * w2;
+        texel = prim.Sdf ? ImGui_ImplSoftRaster_SampleSdf(prim.Tex, u, v, setup.DuvDx, setup.DuvDy) : ImGui_ImplSoftRaster_SampleBilinear(prim.Tex, u, v);
+    }
+    *dst = ImGui_ImplSoftRaster_Blend(ImGui_ImplSoftRaster_Mul(texel, col), *dst);
+}
+
+static void ImGui_ImplSoftRaster_RasterizeTriangle(ImGui_ImplSoftRaster_Data* bd, const ImGui_ImplSoftRaster_Prim& prim, const ImGui_ImplSoftRaster_Rect& r)
+{
+    ImGui_ImplSoftRaster_TriangleSetup setup;
+    for (int i = 0; i < 3; i++)
+    {
+        // Computed so that the edge shared by two triangles has exactly negated coefficients in each of them.
+        const ImVec2& p = prim.Pos[(i + 1) % 3];
+        const ImVec2& q = prim.Pos[(i + 2) % 3];
+        setup.EdgeA[i] = p.y - q.y;
+        setup.EdgeB[i] = q.x - p.x;
+        setup.EdgeC[i] = p.x * q.y - p.y * q.x;
+        setup.EdgeIncl[i] = setup.EdgeA[i] > 0.0f || (setup.EdgeA[i] == 0.0f && setup.EdgeB[i] > 0.0f);
+        for (int ch = 0; ch < 4; ch++)
+            setup.Col[i][ch] = (float)((prim.Col[i] >> (ch * 8)) & 0xFF);
+    }
+    setup.InvArea = 1.0f / (setup.EdgeA[0] * prim.Pos[0].x + (setup.EdgeB[0] * prim.Pos[0].y + setup.EdgeC[0]));
+    setup.SolidCol = prim.Col[0] == prim.Col[1] && prim.Col[0] == prim.Col[2];
+    setup.SolidUv = prim.Uv[0].x == prim.Uv[1].x && prim.Uv[0].x == prim.Uv[2].x && prim.Uv[0].y == prim.Uv[1].y && prim.Uv[0].y == prim.Uv[2].y && !prim.Sdf;
+    setup.DuvDx = setup.DuvDy = ImVec2(0.0f, 0.0f);
+    if (prim.Sdf)
+        for (int i = 0; i < 3; i++)
+        {
+            // Barycentric weights are linear: dw[i]/dx = EdgeA[i] * InvArea, dw[i]/dy = EdgeB[i] * InvArea
+            setup.DuvDx.x += prim.Uv[i].x * setup.EdgeA[i] * setup.InvArea;
+            setup.DuvDx.y += prim.Uv[i].y * setup.EdgeA[i] * setup.InvArea;
+            setup.DuvDy.x += prim.Uv[i].x * setup.EdgeB[i] * setup.InvArea;
+            setup.DuvDy.y += prim.Uv[i].y * setup.EdgeB[i] * setup.InvArea;
+        }
+    setup.SolidTexel = setup.SolidUv ? ImGui_ImplSoftRaster_SampleBilinear(prim.Tex, prim.Uv[0].x, prim.Uv[0].y) : 0;
+    setup.SolidSrc = ImGui_ImplSoftRaster_Mul(setup.SolidTexel, prim.Col[0]);
+    if (setup.SolidCol && setup.SolidUv && (setup.SolidSrc >> 24) == 0)
+        return;
+
+    ImU8* dst_row = bd->Pixels + r.Y0 * bd->Stride;
+    for (int y = r.Y0; y < r.Y1; y++, dst_row += bd->Stride)
+    {
+        ImU32* dst = (ImU32*)(void*)dst_row;
+        const float py = (float)y + 0.5f;
+        const float ey0 = setup.EdgeB[0] * py + setup.EdgeC[0];
+        const float ey1 = setup.EdgeB[1] * py + setup.EdgeC[1];
+        const float ey2 = setup.EdgeB[2] * py + setup.EdgeC[2];
+        int x = r.X0;
+#ifdef IMGUI_IMPL_SOFTRASTER_USE_SSE2
+        // Evaluate edge functions for 4 pixels at a time
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 a0 = _mm_set1_ps(setup.EdgeA[0]), a1 = _mm_set1_ps(setup.EdgeA[1]), a2 = _mm_set1_ps(setup.EdgeA[2]);
+        const __m128 b0 = _mm_set1_ps(ey0), b1 = _mm_set1_ps(ey1), b2 = _mm_set1_ps(ey2);
+        const __m128 incl0 = _mm_castsi128_ps(_mm_set1_epi32(setup.EdgeIncl[0] ? -1 : 0));
+        const __m128 incl1 = _mm_castsi128_ps(_mm_set1_epi32(setup.EdgeIncl[1] ? -1 : 0));
+        const __m128 incl2 = _mm_castsi128_ps(_mm_set1_epi32(setup.EdgeIncl[2] ? -1 : 0));
+        const __m128 px_offsets = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+        for (; x < r.X1; x += 4)
+        {
+            const __m128 px = _mm_add_ps(_mm_set1_ps((float)x), px_offsets);
+            const __m128 e0 = _mm_add_ps(_mm_mul_ps(a0, px), b0);
+            const __m128 e1 = _mm_add_ps(_mm_mul_ps(a1, px), b1);
+            const __m128 e2 = _mm_add_ps(_mm_mul_ps(a2, px), b2);
+            const __m128 in0 = _mm_or_ps(_mm_cmpgt_ps(e0, zero), _mm_and_ps(_mm_cmpeq_ps(e0, zero), incl0));
+            const __m128 in1 = _mm_or_ps(_mm_cmpgt_ps(e1, zero), _mm_and_ps(_mm_cmpeq_ps(e1, zero), incl1));
+            const __m128 in2 = _mm_or_ps(_mm_cmpgt_ps(e2, zero), _mm_and_ps(_mm_cmpeq_ps(e2, zero), incl2));
+            int mask = _mm_movemask_ps(_mm_and_ps(_mm_and_ps(in0, in1), in2));
+            if (r.X1 - x < 4)
+                mask &= (1 << (r.X1 - x)) - 1;
+            if (mask == 0)
+                continue;
+            float e0_lanes[4], e1_lanes[4], e2_lanes[4];
+            _mm_storeu_ps(e0_lanes, e0);
+            _mm_storeu_ps(e1_lanes, e1);
+            _mm_storeu_ps(e2_lanes, e2);
+            for (int lane = 0; lane < 4; lane++)
+                if (mask & (1 << lane))
+                    ImGui_ImplSoftRaster_ShadePixel(prim, setup, e0_lanes[lane], e1_lanes[lane], e2_lanes[lane], dst + x + lane);
+        }
+#endif
+        for (; x < r.X1; x++)
+        {
+            const float px = (float)x + 0.5f;
+            const float e0 = setup.EdgeA[0] * px + ey0;
+            const float e1 = setup.EdgeA[1] * px + ey1;
+            const float e2 = setup.EdgeA[2] * px + ey2;
+            if ((e0 > 0.0f || (e0 == 0.0f && setup.EdgeIncl[0])) && (e1 > 0.0f || (e1 == 0.0f && setup.EdgeIncl[1])) && (e2 > 0.0f || (e2 == 0.0f && setup.EdgeIncl[2])))
+                ImGui_ImplSoftRaster_ShadePixel(prim, setup, e0, e1, e2, dst + x);
+        }
+    }
+}
+
+static void ImGui_ImplSoftRaster_RasterizeTile(void* user_data, int active_tile_n)
+{
+    ImGui_ImplSoftRaster_Data* bd = (ImGui_ImplSoftRaster_Data*)user_data;
+    const int tile_n = bd->ActiveTiles[active_tile_n];
+    const int tile_x0 = (tile_n % bd->TilesX) * IMGUI_IMPL_SOFTRASTER_TILE_SIZE;
+    const int tile_y0 = (tile_n / bd->TilesX) * IMGUI_IMPL_SOFTRASTER_TILE_SIZE;
+    const int* prim_indices = bd->TileBinPrims.Data + bd->TileBinOffsets[tile_n];
+    const int prim_count = bd->TileBinOffsets[tile_n + 1] - bd->TileBinOffsets[tile_n];
+
+    // Regions never overlap, so pixels are never blended twice
+    for (const ImGui_ImplSoftRaster_Rect& region : bd->Regions)
+    {
+        ImGui_ImplSoftRaster_Rect clip;
+        clip.X0 = ImGui_ImplSoftRaster_Max(region.X0, tile_x0);
+        clip.Y0 = ImGui_ImplSoftRaster_Max(region.Y0, tile_y0);
+        clip.X1 = ImGui_ImplSoftRaster_Min(region.X1, tile_x0 + IMGUI_IMPL_SOFTRASTER_TILE_SIZE);
+        clip.Y1 = ImGui_ImplSoftRaster_Min(region.Y1, tile_y0 + IMGUI_IMPL_SOFTRASTER_TILE_SIZE);
+        if (clip.X0 >= clip.X1 || clip.Y0 >= clip.Y1)
+            continue;
+        for (int n = 0; n < prim_count; n++)
+        {
+            const ImGui_ImplSoftRaster_Prim& prim = bd->Prims[prim_indices[n]];
+            ImGui_ImplSoftRaster_Rect r;
+            r.X0 = ImGui_ImplSoftRaster_Max(prim.Bounds.X0, clip.X0);
+            r.Y0 = ImGui_ImplSoftRaster_Max(prim.Bounds.Y0, clip.Y0);
+            r.X1 = ImGui_ImplSoftRaster_Min(prim.Bounds.X1, clip.X1);
+            r.Y1 = ImGui_ImplSoftRaster_Min(prim.Bounds.Y1, clip.Y1);
+            if (r.X0 >= r.X1 || r.Y0 >= r.Y1)
+                continue;
+            if (prim.Type == ImGui_ImplSoftRaster_PrimType_Quad)
+                ImGui_ImplSoftRaster_RasterizeQuad(bd, prim, r);
+            else
+                ImGui_ImplSoftRaster_RasterizeTriangle(bd, prim, r);
+        }
+    }
+}
+
+// Bin all pending primitives into tiles and rasterize them
+static void ImGui_ImplSoftRaster_Flush(ImGui_ImplSoftRaster_Data* bd)
+{
+    if (bd->Prims.Size == 0)
+        return;
+
+    // Count primitives per tile, then store primitive indices grouped by tile (preserving submission order)
+    const int tiles_count = bd->TilesX * bd->TilesY;
+    bd->TileBinOffsets.resize(tiles_count + 1);
+    memset(bd->TileBinOffsets.Data, 0, (size_t)bd->TileBinOffsets.size_in_bytes());
+    int* counts = bd->TileBinOffsets.Data + 1;
+    for (const ImGui_ImplSoftRaster_Prim& prim : bd->Prims)
+        for (int ty = prim.Bounds.Y0 / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; ty <= (prim.Bounds.Y1 - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; ty++)
+            for (int tx = prim.Bounds.X0 / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; tx <= (prim.Bounds.X1 - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; tx++)
+                counts[ty * bd->TilesX + tx]++;
+    bd->ActiveTiles.resize(0);
+    for (int tile_n = 0; tile_n < tiles_count; tile_n++)
+    {
+        if (counts[tile_n] > 0)
+            bd->ActiveTiles.push_back(tile_n);
+        counts[tile_n] += bd->TileBinOffsets[tile_n]; // Prefix sum: TileBinOffsets[n + 1] = end of tile n
+    }
+    bd->TileBinPrims.resize(bd->TileBinOffsets[tiles_count]);
+    for (int tile_n = tiles_count; tile_n > 0; tile_n--)
+        bd->TileBinOffsets[tile_n] = bd->TileBinOffsets[tile_n - 1]; // Shift to get start offsets, used as write cursors
+    for (int prim_n = 0; prim_n < bd->Prims.Size; prim_n++)
+    {
+        const ImGui_ImplSoftRaster_Prim& prim = bd->Prims[prim_n];
+        for (int ty = prim.Bounds.Y0 / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; ty <= (prim.Bounds.Y1 - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; ty++)
+            for (int tx = prim.Bounds.X0 / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; tx <= (prim.Bounds.X1 - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE; tx++)
+                bd->TileBinPrims[bd->TileBinOffsets[ty * bd->TilesX + tx + 1]++] = prim_n;
+    }
+    bd->TileBinOffsets[0] = 0; // Write cursors ended at start of next tile: TileBinOffsets[n] is now start of tile n again
+
+    ImGui_ImplSoftRaster_ParallelFor(bd, ImGui_ImplSoftRaster_RasterizeTile, bd, bd->ActiveTiles.Size);
+    bd->Prims.resize(0);
+}
+
+static inline ImU32 ImGui_ImplSoftRaster_ConvertColor(ImU32 col)
+{
+#ifdef IMGUI_USE_BGRA_PACKED_COLOR
+    return (col & 0xFF00FF00) | ((col & 0xFF) << 16) | ((col >> 16) & 0xFF);
+#else
+    return col;
+#endif
+}
+
+// Convert triangles of a draw command into primitives
+static void ImGui_ImplSoftRaster_SetupPrims(ImGui_ImplSoftRaster_Data* bd, const ImDrawList* draw_list, const ImDrawCmd* pcmd, const ImGui_ImplSoftRaster_Rect& scissor, ImVec2 clip_off, ImVec2 clip_scale)
+{
+    const ImGui_ImplSoftRaster_Texture* tex = (const ImGui_ImplSoftRaster_Texture*)(intptr_t)pcmd->GetTexID();
+    IM_ASSERT(tex != nullptr && tex->Pixels != nullptr);
+    const bool tex_sdf = (pcmd->TexRef._TexData != nullptr && pcmd->TexRef._TexData->UseSDF); // Only textures created by dear imgui may store signed distance fields
+    const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + pcmd->VtxOffset;
+    const ImDrawIdx* idx_buffer = draw_list->IdxBuffer.Data + pcmd->IdxOffset;
+    const unsigned int elem_count = pcmd->ElemCount;
+    for (unsigned int idx_n = 0; idx_n + 3 <= elem_count; )
+    {
+        const ImDrawVert* v0 = &vtx_buffer[idx_buffer[idx_n + 0]];
+        const ImDrawVert* v1 = &vtx_buffer[idx_buffer[idx_n + 1]];
+        const ImDrawVert* v2 = &vtx_buffer[idx_buffer[idx_n + 2]];
+        const ImVec2 pos0 = ImDrawVertGetPos(*v0), pos1 = ImDrawVertGetPos(*v1), pos2 = ImDrawVertGetPos(*v2); // Using accessors to support IMGUI_USE_COMPACT_DRAWVERT
+        const ImVec2 uv0 = ImDrawVertGetUV(*v0), uv1 = ImDrawVertGetUV(*v1), uv2 = ImDrawVertGetUV(*v2);
+
+        // Detect axis-aligned rectangles as output by ImDrawList::PrimRect()/PrimRectUV(): (a, b, c) + (a, c, d)
+        if (idx_n + 6 <= elem_count && idx_buffer[idx_n + 3] == idx_buffer[idx_n] && idx_buffer[idx_n + 4] == idx_buffer[idx_n + 2])
+        {
+            const ImDrawVert* v3 = &vtx_buffer[idx_buffer[idx_n + 5]];
+            const ImVec2 pos3 = ImDrawVertGetPos(*v3), uv3 = ImDrawVertGetUV(*v3);
+            if (pos0.y == pos1.y && pos1.x == pos2.x && pos2.y == pos3.y && pos3.x == pos0.x &&
+                uv0.y == uv1.y && uv1.x == uv2.x && uv2.y == uv3.y && uv3.x == uv0.x &&
+                v0->col == v1->col && v0->col == v2->col && v0->col == v3->col)
+            {
+                idx_n += 6;
+                const ImVec2 p0((pos0.x - clip_off.x) * clip_scale.x, (pos0.y - clip_off.y) * clip_scale.y);
+                const ImVec2 p2((pos2.x - clip_off.x) * clip_scale.x, (pos2.y - clip_off.y) * clip_scale.y);
+                if ((v0->col & IM_COL32_A_MASK) == 0 || p0.x == p2.x || p0.y == p2.y)
+                    continue;
+                ImGui_ImplSoftRaster_Prim prim;
+                prim.Type = ImGui_ImplSoftRaster_PrimType_Quad;
+                prim.Tex = tex;
+                prim.Sdf = tex_sdf;
+                prim.Pos[0] = ImVec2(ImGui_ImplSoftRaster_Min(p0.x, p2.x), ImGui_ImplSoftRaster_Min(p0.y, p2.y));
+                prim.Pos[1] = ImVec2(ImGui_ImplSoftRaster_Max(p0.x, p2.x), ImGui_ImplSoftRaster_Max(p0.y, p2.y));
+                prim.Uv[0] = ImVec2(p0.x < p2.x ? uv0.x : uv2.x, p0.y < p2.y ? uv0.y : uv2.y);
+                prim.Uv[1] = ImVec2(p0.x < p2.x ? uv2.x : uv0.x, p0.y < p2.y ? uv2.y : uv0.y);
+                prim.Col[0] = ImGui_ImplSoftRaster_ConvertColor(v0->col);
+
+                // Covered pixels have their center in [min, max)
+                const float x0 = ImGui_ImplSoftRaster_Clamp(prim.Pos[0].x - 0.5f, (float)scissor.X0, (float)scissor.X1);
+                const float y0 = ImGui_ImplSoftRaster_Clamp(prim.Pos[0].y - 0.5f, (float)scissor.Y0, (float)scissor.Y1);
+                const float x1 = ImGui_ImplSoftRaster_Clamp(prim.Pos[1].x - 0.5f, (float)scissor.X0, (float)scissor.X1);
+                const float y1 = ImGui_ImplSoftRaster_Clamp(prim.Pos[1].y - 0.5f, (float)scissor.Y0, (float)scissor.Y1);
+                prim.Bounds.X0 = (int)ceilf(x0);
+                prim.Bounds.Y0 = (int)ceilf(y0);
+                prim.Bounds.X1 = (int)ceilf(x1);
+                prim.Bounds.Y1 = (int)ceilf(y1);
+                if (prim.Bounds.X0 < prim.Bounds.X1 && prim.Bounds.Y0 < prim.Bounds.Y1)
+                    bd->Prims.push_back(prim);
+                continue;
+            }
+        }
+        idx_n += 3;
+
+        // Generic triangle
+        if ((v0->col & IM_COL32_A_MASK) == 0 && (v1->col & IM_COL32_A_MASK) == 0 && (v2->col & IM_COL32_A_MASK) == 0)
+            continue;
+        ImGui_ImplSoftRaster_Prim prim;
+        prim.Type = ImGui_ImplSoftRaster_PrimType_Triangle;
+        prim.Tex = tex;
+        prim.Sdf = tex_sdf;
+        prim.Pos[0] = ImVec2((pos0.x - clip_off.x) * clip_scale.x, (pos0.y - clip_off.y) * clip_scale.y);
+        prim.Pos[1] = ImVec2((pos1.x - clip_off.x) * clip_scale.x, (pos1.y - clip_off.y) * clip_scale.y);
+        prim.Pos[2] = ImVec2((pos2.x - clip_off.x) * clip_scale.x, (pos2.y - clip_off.y) * clip_scale.y);
+        prim.Uv[0] = uv0;
+        prim.Uv[1] = uv1;
+        prim.Uv[2] = uv2;
+        prim.Col[0] = ImGui_ImplSoftRaster_ConvertColor(v0->col);
+        prim.Col[1] = ImGui_ImplSoftRaster_ConvertColor(v1->col);
+        prim.Col[2] = ImGui_ImplSoftRaster_ConvertColor(v2->col);
+
+        // Ensure positive area, using same edge function as rasterization
+        const float area = (prim.Pos[1].y - prim.Pos[2].y) * prim.Pos[0].x + ((prim.Pos[2].x - prim.Pos[1].x) * prim.Pos[0].y + (prim.Pos[1].x * prim.Pos[2].y - prim.Pos[1].y * prim.Pos[2].x));
+        if (!(area != 0.0f)) // Also catches NaN
+            continue;
+        if (area < 0.0f)
+        {
+            ImGui_ImplSoftRaster_Swap(prim.Pos[1], prim.Pos[2]);
+            ImGui_ImplSoftRaster_Swap(prim.Uv[1], prim.Uv[2]);
+            ImGui_ImplSoftRaster_Swap(prim.Col[1], prim.Col[2]);
+        }
+
+        // Pixels which may be covered have their center in [min, max]
+        const float x0 = ImGui_ImplSoftRaster_Clamp(ImGui_ImplSoftRaster_Min(ImGui_ImplSoftRaster_Min(prim.Pos[0].x, prim.Pos[1].x), prim.Pos[2].x) - 0.5f, (float)scissor.X0, (float)scissor.X1);
+        const float y0 = ImGui_ImplSoftRaster_Clamp(ImGui_ImplSoftRaster_Min(ImGui_ImplSoftRaster_Min(prim.Pos[0].y, prim.Pos[1].y), prim.Pos[2].y) - 0.5f, (float)scissor.Y0, (float)scissor.Y1);
+        const float x1 = ImGui_ImplSoftRaster_Clamp(ImGui_ImplSoftRaster_Max(ImGui_ImplSoftRaster_Max(prim.Pos[0].x, prim.Pos[1].x), prim.Pos[2].x) - 0.5f, (float)scissor.X0, (float)scissor.X1);
+        const float y1 = ImGui_ImplSoftRaster_Clamp(ImGui_ImplSoftRaster_Max(ImGui_ImplSoftRaster_Max(prim.Pos[0].y, prim.Pos[1].y), prim.Pos[2].y) - 0.5f, (float)scissor.Y0, (float)scissor.Y1);
+        prim.Bounds.X0 = (int)ceilf(x0);
+        prim.Bounds.Y0 = (int)ceilf(y0);
+        prim.Bounds.X1 = ImGui_ImplSoftRaster_Min((int)floorf(x1) + 1, scissor.X1);
+        prim.Bounds.Y1 = ImGui_ImplSoftRaster_Min((int)floorf(y1) + 1, scissor.Y1);
+        if (prim.Bounds.X0 < prim.Bounds.X1 && prim.Bounds.Y0 < prim.Bounds.Y1)
+            bd->Prims.push_back(prim);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------------
+
+bool ImGui_ImplSoftRaster_Init(ImGui_ImplSoftRaster_InitInfo* info)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IMGUI_CHECKVERSION();
+    IM_ASSERT(io.BackendRendererUserData == nullptr && "Already initialized a renderer backend!");
+
+    // Setup backend capabilities flags
+    ImGui_ImplSoftRaster_Data* bd = IM_NEW(ImGui_ImplSoftRaster_Data)();
+    io.BackendRendererUserData = (void*)bd;
+    io.BackendRendererName = "imgui_impl_softraster";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;   // We can honor ImGuiPlatformIO::Textures[] requests during render.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasSdfTextures; // We can draw textures storing signed distance fields (ImFontFlags_SDF).
+
+    if (info != nullptr)
+        bd->InitInfo = *info;
+
+#ifndef IMGUI_IMPL_SOFTRASTER_DISABLE_THREADS
+    // Create worker threads (calling thread also participates)
+    int threads_count = bd->InitInfo.ThreadsCount;
+    if (threads_count <= 0)
+        threads_count = (int)std::thread::hardware_concurrency();
+    if (bd->InitInfo.ParallelFor == nullptr)
+        for (int n = 1; n < threads_count; n++)
+            bd->Threads.push_back(IM_NEW(std::thread)(ImGui_ImplSoftRaster_WorkerThread, bd));
+#endif
+
+    ImGui_ImplSoftRaster_CreateDeviceObjects();
+    return true;
+}
+
+void ImGui_ImplSoftRaster_Shutdown()
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    IM_ASSERT(bd != nullptr && "No renderer backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    ImGui_ImplSoftRaster_DestroyDeviceObjects();
+
+#ifndef IMGUI_IMPL_SOFTRASTER_DISABLE_THREADS
+    {
+        std::lock_guard<std::mutex> lock(bd->WorkMutex);
+        bd->WorkQuit = true;
+    }
+    bd->WorkStartCond.notify_all();
+    for (std::thread* thread : bd->Threads)
+    {
+        thread->join();
+        IM_DELETE(thread);
+    }
+    bd->Threads.clear();
+#endif
+
+    io.BackendRendererName = nullptr;
+    io.BackendRendererUserData = nullptr;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasSdfTextures);
+    IM_DELETE(bd);
+}
+
+void ImGui_ImplSoftRaster_NewFrame()
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplSoftRaster_Init()?");
+    IM_UNUSED(bd);
+}
+
+void ImGui_ImplSoftRaster_RenderDrawData(ImDrawData* draw_data, void* pixels, int width, int height, int stride)
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    IM_ASSERT(pixels != nullptr && stride >= width * 4);
+
+    // Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
+    const int fb_width = ImGui_ImplSoftRaster_Min(width, (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x));
+    const int fb_height = ImGui_ImplSoftRaster_Min(height, (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y));
+    if (fb_width <= 0 || fb_height <= 0)
+        return;
+
+    // Catch up with texture updates. Most of the times, the list will have 1 element with an OK status, aka nothing to do.
+    // (This almost always points to ImGui::GetPlatformIO().Textures[] but is part of ImDrawData to allow overriding or disabling texture updates).
+    if (draw_data->Textures != nullptr)
+        for (ImTextureData* tex : *draw_data->Textures)
+            if (tex->Status != ImTextureStatus_OK)
+                ImGui_ImplSoftRaster_UpdateTexture(tex);
+
+    // Will project scissor/clipping rectangles into framebuffer space
+    ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
+    ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+
+    // Regions to redraw. Damage tracking (io.ConfigDamageTracking): only redraw damaged regions, nothing to do if nothing changed.
+    bd->Regions.resize(0);
+    if (draw_data->DamageTracked)
+    {
+        for (const ImVec4& damage_rect : draw_data->DamageRects)
+        {
+            ImGui_ImplSoftRaster_Rect r;
+            r.X0 = ImGui_ImplSoftRaster_Max(0, (int)floorf((damage_rect.x - clip_off.x) * clip_scale.x));
+            r.Y0 = ImGui_ImplSoftRaster_Max(0, (int)floorf((damage_rect.y - clip_off.y) * clip_scale.y));
+            r.X1 = ImGui_ImplSoftRaster_Min(fb_width, (int)ceilf((damage_rect.z - clip_off.x) * clip_scale.x));
+            r.Y1 = ImGui_ImplSoftRaster_Min(fb_height, (int)ceilf((damage_rect.w - clip_off.y) * clip_scale.y));
+            if (r.X0 < r.X1 && r.Y0 < r.Y1)
+                bd->Regions.push_back(r);
+        }
+        if (bd->Regions.Size == 0)
+            return;
+    }
+    else
+    {
+        ImGui_ImplSoftRaster_Rect r = { 0, 0, fb_width, fb_height };
+        bd->Regions.push_back(r);
+    }
+
+    // Setup render target
+    bd->Pixels = (ImU8*)pixels;
+    bd->Width = fb_width;
+    bd->Height = fb_height;
+    bd->Stride = stride;
+    bd->TilesX = (fb_width + IMGUI_IMPL_SOFTRASTER_TILE_SIZE - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE;
+    bd->TilesY = (fb_height + IMGUI_IMPL_SOFTRASTER_TILE_SIZE - 1) / IMGUI_IMPL_SOFTRASTER_TILE_SIZE;
+    bd->Prims.resize(0);
+
+    // Setup render state structure (for callbacks and custom texture bindings)
+    ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+    ImGui_ImplSoftRaster_RenderState render_state;
+    render_state.Pixels = pixels;
+    render_state.Width = fb_width;
+    render_state.Height = fb_height;
+    render_state.Stride = stride;
+    platform_io.Renderer_RenderState = &render_state;
+
+    // Render command lists
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != nullptr)
+            {
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+                if (pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                {
+                    ImGui_ImplSoftRaster_Flush(bd);
+                    pcmd->UserCallback(draw_list, pcmd);
+                }
+            }
+            else
+            {
+                // Project scissor/clipping rectangles into framebuffer space
+                ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
+                ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+                if (clip_min.x < 0.0f) { clip_min.x = 0.0f; }
+                if (clip_min.y < 0.0f) { clip_min.y = 0.0f; }
+                if (clip_max.x > (float)fb_width) { clip_max.x = (float)fb_width; }
+                if (clip_max.y > (float)fb_height) { clip_max.y = (float)fb_height; }
+                if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+                    continue;
+
+                ImGui_ImplSoftRaster_Rect scissor = { (int)clip_min.x, (int)clip_min.y, (int)clip_max.x, (int)clip_max.y };
+                ImGui_ImplSoftRaster_SetupPrims(bd, draw_list, pcmd, scissor, clip_off, clip_scale);
+            }
+        }
+    }
+    ImGui_ImplSoftRaster_Flush(bd);
+
+    platform_io.Renderer_RenderState = nullptr;
+    bd->Pixels = nullptr;
+}
+
+static void ImGui_ImplSoftRaster_CopyTexturePixels(ImGui_ImplSoftRaster_Texture* backend_tex, ImTextureData* tex, int x, int y, int w, int h)
+{
+    for (int row = y; row < y + h; row++)
+    {
+        ImU32* dst = backend_tex->Pixels + row * backend_tex->Width + x;
+        if (tex->Format == ImTextureFormat_RGBA32)
+        {
+            memcpy(dst, tex->GetPixelsAt(x, row), (size_t)w * 4);
+        }
+        else
+        {
+            const ImU8* src = (const ImU8*)tex->GetPixelsAt(x, row);
+            for (int n = 0; n < w; n++)
+                dst[n] = ((ImU32)src[n] << 24) | 0x00FFFFFF;
+        }
+    }
+}
+
+void ImGui_ImplSoftRaster_UpdateTexture(ImTextureData* tex)
+{
+    if (tex->Status == ImTextureStatus_WantCreate)
+    {
+        // Create texture and copy pixels (converting from Alpha8 if needed)
+        //IMGUI_DEBUG_LOG("UpdateTexture #%03d: WantCreate %dx%d\n", tex->UniqueID, tex->Width, tex->Height);
+        IM_ASSERT(tex->TexID == ImTextureID_Invalid && tex->BackendUserData == nullptr);
+        ImGui_ImplSoftRaster_Texture* backend_tex = IM_NEW(ImGui_ImplSoftRaster_Texture)();
+        backend_tex->Width = tex->Width;
+        backend_tex->Height = tex->Height;
+        backend_tex->Pixels = (ImU32*)IM_ALLOC((size_t)tex->Width * (size_t)tex->Height * 4);
+        ImGui_ImplSoftRaster_CopyTexturePixels(backend_tex, tex, 0, 0, tex->Width, tex->Height);
+
+        // Store identifiers
+        tex->SetTexID((ImTextureID)(intptr_t)backend_tex);
+        tex->SetStatus(ImTextureStatus_OK);
+    }
+    else if (tex->Status == ImTextureStatus_WantUpdates)
+    {
+        // Update selected blocks. We only ever write to textures regions which have never been used before!
+        // This backend choose to use tex->Updates[] but you can use tex->UpdateRect to upload a single region.
+        ImGui_ImplSoftRaster_Texture* backend_tex = (ImGui_ImplSoftRaster_Texture*)(intptr_t)tex->TexID;
+        for (ImTextureRect& r : tex->Updates)
+            ImGui_ImplSoftRaster_CopyTexturePixels(backend_tex, tex, r.x, r.y, r.w, r.h);
+        tex->SetStatus(ImTextureStatus_OK);
+    }
+    else if (tex->Status == ImTextureStatus_WantDestroy)
+    {
+        ImGui_ImplSoftRaster_Texture* backend_tex = (ImGui_ImplSoftRaster_Texture*)(intptr_t)tex->TexID;
+        if (backend_tex == nullptr)
+            return;
+        IM_FREE(backend_tex->Pixels);
+        IM_DELETE(backend_tex);
+
+        // Clear identifiers and mark as destroyed (in order to allow e.g. calling InvalidateDeviceObjects while running)
+        tex->SetTexID(ImTextureID_Invalid);
+        tex->SetStatus(ImTextureStatus_Destroyed);
+    }
+}
+
+void ImGui_ImplSoftRaster_CreateDeviceObjects()
+{
+}
+
+void ImGui_ImplSoftRaster_DestroyDeviceObjects()
+{
+    // Destroy all textures
+    for (ImTextureData* tex : ImGui::GetPlatformIO().Textures)
+        if (tex->RefCount == 1)
+        {
+            tex->SetStatus(ImTextureStatus_WantDestroy);
+            ImGui_ImplSoftRaster_UpdateTexture(tex);
+        }
+}
+
+//-----------------------------------------------------------------------------
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,76 @@
+// dear imgui: Renderer Backend for CPU software rasterization into a RGBA32 pixel buffer
+// This needs to be used along with a Platform Backend (e.g. Win32, SDL) or your own code to display the output buffer. It may also be used headless (e.g. servers, regression tests).
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftRaster_Texture*' as texture identifier. Read the FAQ about ImTextureID/ImTextureRef!
+//  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [X] Renderer: Expose selected render state for draw callbacks to use. Access in '(ImGui_ImplXXXX_RenderState*)GetPlatformIO().Renderer_RenderState'.
+//  [X] Renderer: Damage tracking support: only redraw regions listed in ImDrawData::DamageRects[] when io.ConfigDamageTracking is enabled.
+//  [X] Renderer: Multi-threaded rasterization, using backend owned threads or your own job system.
+//  [X] Renderer: Compact vertex layout support (IMGUI_USE_COMPACT_DRAWVERT).
+//  [X] Renderer: Signed distance field textures support, for fonts using ImFontFlags_SDF (ImGuiBackendFlags_RendererHasSdfTextures).
+
+// About output:
+// - Output buffer is RGBA32: R,G,B,A bytes in memory order (== IM_COL32() on little-endian architectures). Stride is specified in bytes.
+// - Primitives are alpha-blended over existing contents (same blending as other backends): clear your buffer before rendering (only damaged regions when using io.ConfigDamageTracking).
+// - Textures are sampled with bilinear filtering and clamp-to-edge addressing.
+// - Output is deterministic: it doesn't depend on number of threads or on SIMD support, making it suitable for pixel-exact regression tests.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+#pragma once
+#ifndef IMGUI_DISABLE
+#include "imgui.h"      // IMGUI_IMPL_API
+
+// Initialization data, for ImGui_ImplSoftRaster_Init()
+// - ThreadsCount: number of threads rasterizing tiles, including the calling thread. 0 == use std::thread::hardware_concurrency().
+//   Additional threads are created by the backend, unless you provide your own ParallelFor function.
+//   '#define IMGUI_IMPL_SOFTRASTER_DISABLE_THREADS' to compile without <thread> support (e.g. some embedded platforms).
+// - ParallelFor: optional, to use your own job system. Needs to call 'func(func_user_data, n)' for all n in [0..count) from any thread and return when all calls have completed.
+struct ImGui_ImplSoftRaster_InitInfo
+{
+    int                 ThreadsCount = 1;
+    void                (*ParallelFor)(void (*func)(void* func_user_data, int index), void* func_user_data, int count, void* user_data) = nullptr;
+    void*               ParallelForUserData = nullptr;
+};
+
+// Follow "Getting Started" link and check examples/ folder to learn about using backends!
+IMGUI_IMPL_API bool     ImGui_ImplSoftRaster_Init(ImGui_ImplSoftRaster_InitInfo* info = nullptr);
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_NewFrame();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_RenderDrawData(ImDrawData* draw_data, void* pixels, int width, int height, int stride);
+
+// Called by Init/NewFrame/Shutdown
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_CreateDeviceObjects();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_DestroyDeviceObjects();
+
+// (Advanced) Use e.g. if you need to precisely control the timing of texture updates (e.g. for staged rendering), by setting ImDrawData::Textures = NULL to handle this manually.
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_UpdateTexture(ImTextureData* tex);
+
+// Texture used by this backend. Use '(ImTextureID)(intptr_t)my_texture' to display your own textures.
+struct ImGui_ImplSoftRaster_Texture
+{
+    int                 Width;
+    int                 Height;
+    ImU32*              Pixels;         // RGBA32, Width * Height, no padding
+};
+
+// [BETA] Selected render state data shared with callbacks.
+// This is temporarily stored in GetPlatformIO().Renderer_RenderState during the ImGui_ImplSoftRaster_RenderDrawData() call.
+// All primitives submitted before a callback have been rasterized when it is called. Callbacks are always called from the thread calling ImGui_ImplSoftRaster_RenderDrawData().
+struct ImGui_ImplSoftRaster_RenderState
+{
+    void*               Pixels;
+    int                 Width;
+    int                 Height;
+    int                 Stride;
+};
+
+#endif // #ifndef IMGUI_DISABLE
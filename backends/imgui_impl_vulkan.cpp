@@ -5,7 +5,9 @@
 //  [!] Renderer: User texture binding. Use 'VkDescriptorSet' as texture identifier. Call ImGui_ImplVulkan_AddTexture() to register one. Read the FAQ about ImTextureID/ImTextureRef + https://github.com/ocornut/imgui/pull/914 for discussions.
 //  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
 //  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [X] Renderer: Signed distance field textures support, for fonts using ImFontFlags_SDF (ImGuiBackendFlags_RendererHasSdfTextures).
 //  [X] Renderer: Expose selected render state for draw callbacks to use. Access in '(ImGui_ImplXXXX_RenderState*)GetPlatformIO().Renderer_RenderState'.
+//  [X] Renderer: Compact vertex layout support (IMGUI_USE_COMPACT_DRAWVERT).
 
 // The aim of imgui_impl_vulkan.h/.cpp is to be usable in your engine without any modification.
 // IF YOU FEEL YOU NEED TO MAKE ANY CHANGE TO THIS CODE, please share them and your feedback at https://github.com/ocornut/imgui/
@@ -27,6 +29,8 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2025-08-29: Vulkan: Support for signed distance field textures (ImGuiBackendFlags_RendererHasSdfTextures), used by ImFontFlags_SDF fonts. Pipeline layout has an additional fragment push constant range.
+//  2025-08-26: Vulkan: Support for compact vertex layout (IMGUI_USE_COMPACT_DRAWVERT): 16-bit fixed-point positions and 16-bit normalized UV.
 //  2025-07-27: Vulkan: Fixed texture update corruption introduced on 2025-06-11. (#8801, #8755, #8840)
 //  2025-07-07: Vulkan: Fixed texture synchronization issue introduced on 2025-06-11. (#8772)
 //  2025-06-27: Vulkan: Fixed validation errors during texture upload/update by aligning upload size to 'nonCoherentAtomSize'. (#8743, #8744)
@@ -347,39 +351,68 @@ static uint32_t __glsl_shader_vert_spv[] =
 #version 450 core
 layout(location = 0) out vec4 fColor;
 layout(set=0, binding=0) uniform sampler2D sTexture;
+layout(push_constant) uniform uPushConstant { layout(offset = 16) int uUseSDF; } pc;
 layout(location = 0) in struct { vec4 Color; vec2 UV; } In;
 void main()
 {
-    fColor = In.Color * texture(sTexture, In.UV.st);
+    vec4 tex_col = texture(sTexture, In.UV.st);
+    if (pc.uUseSDF != 0)
+    {
+        float w = max(fwidth(tex_col.a) * 0.5, 1.0 / 255.0);
+        tex_col.a = smoothstep(0.5 - w, 0.5 + w, tex_col.a);
+    }
+    fColor = In.Color * tex_col;
 }
 */
 static uint32_t __glsl_shader_frag_spv[] =
 {
-    0x07230203,0x00010000,0x00080001,0x0000001e,0x00000000,0x00020011,0x00000001,0x0006000b,
+    0x07230203,0x00010000,0x00080001,0x0000003e,0x00000000,0x00020011,0x00000001,0x0006000b,
     0x00000001,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,0x00000000,0x00000001,
-    0x0007000f,0x00000004,0x00000004,0x6e69616d,0x00000000,0x00000009,0x0000000d,0x00030010,
-    0x00000004,0x00000007,0x00030003,0x00000002,0x000001c2,0x00040005,0x00000004,0x6e69616d,
-    0x00000000,0x00040005,0x00000009,0x6c6f4366,0x0000726f,0x00030005,0x0000000b,0x00000000,
-    0x00050006,0x0000000b,0x00000000,0x6f6c6f43,0x00000072,0x00040006,0x0000000b,0x00000001,
-    0x00005655,0x00030005,0x0000000d,0x00006e49,0x00050005,0x00000016,0x78655473,0x65727574,
-    0x00000000,0x00040047,0x00000009,0x0000001e,0x00000000,0x00040047,0x0000000d,0x0000001e,
-    0x00000000,0x00040047,0x00000016,0x00000022,0x00000000,0x00040047,0x00000016,0x00000021,
-    0x00000000,0x00020013,0x00000002,0x00030021,0x00000003,0x00000002,0x00030016,0x00000006,
-    0x00000020,0x00040017,0x00000007,0x00000006,0x00000004,0x00040020,0x00000008,0x00000003,
-    0x00000007,0x0004003b,0x00000008,0x00000009,0x00000003,0x00040017,0x0000000a,0x00000006,
-    0x00000002,0x0004001e,0x0000000b,0x00000007,0x0000000a,0x00040020,0x0000000c,0x00000001,
-    0x0000000b,0x0004003b,0x0000000c,0x0000000d,0x00000001,0x00040015,0x0000000e,0x00000020,
-    0x00000001,0x0004002b,0x0000000e,0x0000000f,0x00000000,0x00040020,0x00000010,0x00000001,
-    0x00000007,0x00090019,0x00000013,0x00000006,0x00000001,0x00000000,0x00000000,0x00000000,
-    0x00000001,0x00000000,0x0003001b,0x00000014,0x00000013,0x00040020,0x00000015,0x00000000,
-    0x00000014,0x0004003b,0x00000015,0x00000016,0x00000000,0x0004002b,0x0000000e,0x00000018,
-    0x00000001,0x00040020,0x00000019,0x00000001,0x0000000a,0x00050036,0x00000002,0x00000004,
-    0x00000000,0x00000003,0x000200f8,0x00000005,0x00050041,0x00000010,0x00000011,0x0000000d,
-    0x0000000f,0x0004003d,0x00000007,0x00000012,0x00000011,0x0004003d,0x00000014,0x00000017,
-    0x00000016,0x00050041,0x00000019,0x0000001a,0x0000000d,0x00000018,0x0004003d,0x0000000a,
-    0x0000001b,0x0000001a,0x00050057,0x00000007,0x0000001c,0x00000017,0x0000001b,0x00050085,
-    0x00000007,0x0000001d,0x00000012,0x0000001c,0x0003003e,0x00000009,0x0000001d,0x000100fd,
-    0x00010038
+    0x0007000f,0x00000004,0x00000002,0x6e69616d,0x00000000,0x00000003,0x00000004,0x00030010,
+    0x00000002,0x00000007,0x00030003,0x00000002,0x000001c2,0x00040005,0x00000002,0x6e69616d,
+    0x00000000,0x00040005,0x00000005,0x5f786574,0x006c6f63,0x00050005,0x00000006,0x78655473,
+    0x65727574,0x00000000,0x00030005,0x00000007,0x00000000,0x00050006,0x00000007,0x00000000,
+    0x6f6c6f43,0x00000072,0x00040006,0x00000007,0x00000001,0x00005655,0x00030005,0x00000003,
+    0x00006e49,0x00060005,0x00000008,0x73755075,0x6e6f4368,0x6e617473,0x00000074,0x00050006,
+    0x00000008,0x00000000,0x65735575,0x00464453,0x00030005,0x00000009,0x00006370,0x00030005,
+    0x0000000a,0x00000077,0x00040005,0x00000004,0x6c6f4366,0x0000726f,0x00040047,0x00000006,
+    0x00000022,0x00000000,0x00040047,0x00000006,0x00000021,0x00000000,0x00040047,0x00000003,
+    0x0000001e,0x00000000,0x00050048,0x00000008,0x00000000,0x00000023,0x00000010,0x00030047,
+    0x00000008,0x00000002,0x00040047,0x00000004,0x0000001e,0x00000000,0x00020013,0x0000000b,
+    0x00030021,0x0000000c,0x0000000b,0x00030016,0x0000000d,0x00000020,0x00040017,0x0000000e,
+    0x0000000d,0x00000004,0x00040020,0x0000000f,0x00000007,0x0000000e,0x00090019,0x00000010,
+    0x0000000d,0x00000001,0x00000000,0x00000000,0x00000000,0x00000001,0x00000000,0x0003001b,
+    0x00000011,0x00000010,0x00040020,0x00000012,0x00000000,0x00000011,0x0004003b,0x00000012,
+    0x00000006,0x00000000,0x00040017,0x00000013,0x0000000d,0x00000002,0x0004001e,0x00000007,
+    0x0000000e,0x00000013,0x00040020,0x00000014,0x00000001,0x00000007,0x0004003b,0x00000014,
+    0x00000003,0x00000001,0x00040015,0x00000015,0x00000020,0x00000001,0x0004002b,0x00000015,
+    0x00000016,0x00000001,0x00040020,0x00000017,0x00000001,0x00000013,0x0003001e,0x00000008,
+    0x00000015,0x00040020,0x00000018,0x00000009,0x00000008,0x0004003b,0x00000018,0x00000009,
+    0x00000009,0x0004002b,0x00000015,0x00000019,0x00000000,0x00040020,0x0000001a,0x00000009,
+    0x00000015,0x00020014,0x0000001b,0x00040020,0x0000001c,0x00000007,0x0000000d,0x00040015,
+    0x0000001d,0x00000020,0x00000000,0x0004002b,0x0000001d,0x0000001e,0x00000003,0x0004002b,
+    0x0000000d,0x0000001f,0x3f000000,0x0004002b,0x0000000d,0x00000020,0x3b808081,0x00040020,
+    0x00000021,0x00000003,0x0000000e,0x0004003b,0x00000021,0x00000004,0x00000003,0x00040020,
+    0x00000022,0x00000001,0x0000000e,0x00050036,0x0000000b,0x00000002,0x00000000,0x0000000c,
+    0x000200f8,0x00000023,0x0004003b,0x0000000f,0x00000005,0x00000007,0x0004003b,0x0000001c,
+    0x0000000a,0x00000007,0x0004003d,0x00000011,0x00000024,0x00000006,0x00050041,0x00000017,
+    0x00000025,0x00000003,0x00000016,0x0004003d,0x00000013,0x00000026,0x00000025,0x00050057,
+    0x0000000e,0x00000027,0x00000024,0x00000026,0x0003003e,0x00000005,0x00000027,0x00050041,
+    0x0000001a,0x00000028,0x00000009,0x00000019,0x0004003d,0x00000015,0x00000029,0x00000028,
+    0x000500ab,0x0000001b,0x0000002a,0x00000029,0x00000019,0x000300f7,0x0000002b,0x00000000,
+    0x000400fa,0x0000002a,0x0000002c,0x0000002b,0x000200f8,0x0000002c,0x00050041,0x0000001c,
+    0x0000002d,0x00000005,0x0000001e,0x0004003d,0x0000000d,0x0000002e,0x0000002d,0x000400d1,
+    0x0000000d,0x0000002f,0x0000002e,0x00050085,0x0000000d,0x00000030,0x0000002f,0x0000001f,
+    0x0007000c,0x0000000d,0x00000031,0x00000001,0x00000028,0x00000030,0x00000020,0x0003003e,
+    0x0000000a,0x00000031,0x0004003d,0x0000000d,0x00000032,0x0000000a,0x00050083,0x0000000d,
+    0x00000033,0x0000001f,0x00000032,0x0004003d,0x0000000d,0x00000034,0x0000000a,0x00050081,
+    0x0000000d,0x00000035,0x0000001f,0x00000034,0x00050041,0x0000001c,0x00000036,0x00000005,
+    0x0000001e,0x0004003d,0x0000000d,0x00000037,0x00000036,0x0008000c,0x0000000d,0x00000038,
+    0x00000001,0x00000031,0x00000033,0x00000035,0x00000037,0x00050041,0x0000001c,0x00000039,
+    0x00000005,0x0000001e,0x0003003e,0x00000039,0x00000038,0x000200f9,0x0000002b,0x000200f8,
+    0x0000002b,0x00050041,0x00000022,0x0000003a,0x00000003,0x00000019,0x0004003d,0x0000000e,
+    0x0000003b,0x0000003a,0x0004003d,0x0000000e,0x0000003c,0x00000005,0x00050085,0x0000000e,
+    0x0000003d,0x0000003b,0x0000003c,0x0003003e,0x00000004,0x0000003d,0x000100fd,0x00010038
 };
 
 //-----------------------------------------------------------------------------
@@ -495,9 +528,20 @@ static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline
         float translate[2];
         translate[0] = -1.0f - draw_data->DisplayPos.x * scale[0];
         translate[1] = -1.0f - draw_data->DisplayPos.y * scale[1];
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        // Positions are fixed-point integers read as VK_FORMAT_R16G16_SNORM: [-32767,+32767] -> [-1.0f,+1.0f]
+        scale[0] *= 32767.0f / IM_DRAWVERT_COMPACT_POS_SCALE;
+        scale[1] *= 32767.0f / IM_DRAWVERT_COMPACT_POS_SCALE;
+#endif
         vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, sizeof(float) * 0, sizeof(float) * 2, scale);
         vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, sizeof(float) * 2, sizeof(float) * 2, translate);
     }
+
+    // Setup signed distance field mode (updated per draw command)
+    {
+        int use_sdf = 0;
+        vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_FRAGMENT_BIT, sizeof(float) * 4, sizeof(int), &use_sdf);
+    }
 }
 
 // Render function
@@ -589,6 +633,7 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
     // Render command lists
     // (Because we merged all buffers into a single one, we maintain our own offset into them)
     VkDescriptorSet last_desc_set = VK_NULL_HANDLE;
+    int last_use_sdf = 0;
     int global_vtx_offset = 0;
     int global_idx_offset = 0;
     for (const ImDrawList* draw_list : draw_data->CmdLists)
@@ -605,6 +650,7 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
                 else
                     pcmd->UserCallback(draw_list, pcmd);
                 last_desc_set = VK_NULL_HANDLE;
+                last_use_sdf = -1;
             }
             else
             {
@@ -634,6 +680,12 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
                     vkCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, bd->PipelineLayout, 0, 1, &desc_set, 0, nullptr);
                 last_desc_set = desc_set;
 
+                // Textures created by dear imgui may store signed distance fields (ImFontFlags_SDF)
+                const int use_sdf = (pcmd->TexRef._TexData != nullptr && pcmd->TexRef._TexData->UseSDF) ? 1 : 0;
+                if (use_sdf != last_use_sdf)
+                    vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_FRAGMENT_BIT, sizeof(float) * 4, sizeof(int), &use_sdf);
+                last_use_sdf = use_sdf;
+
                 // Draw
                 vkCmdDrawIndexed(command_buffer, pcmd->ElemCount, 1, pcmd->IdxOffset + global_idx_offset, pcmd->VtxOffset + global_vtx_offset, 0);
             }
@@ -928,11 +980,19 @@ static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationC
     VkVertexInputAttributeDescription attribute_desc[3] = {};
     attribute_desc[0].location = 0;
     attribute_desc[0].binding = binding_desc[0].binding;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    attribute_desc[0].format = VK_FORMAT_R16G16_SNORM; // Scaled back in push constants
+#else
     attribute_desc[0].format = VK_FORMAT_R32G32_SFLOAT;
+#endif
     attribute_desc[0].offset = offsetof(ImDrawVert, pos);
     attribute_desc[1].location = 1;
     attribute_desc[1].binding = binding_desc[0].binding;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    attribute_desc[1].format = VK_FORMAT_R16G16_UNORM;
+#else
     attribute_desc[1].format = VK_FORMAT_R32G32_SFLOAT;
+#endif
     attribute_desc[1].offset = offsetof(ImDrawVert, uv);
     attribute_desc[2].location = 2;
     attribute_desc[2].binding = binding_desc[0].binding;
@@ -1077,16 +1137,20 @@ bool ImGui_ImplVulkan_CreateDeviceObjects()
     if (!bd->PipelineLayout)
     {
         // Constants: we are using 'vec2 offset' and 'vec2 scale' instead of a full 3d projection matrix
-        VkPushConstantRange push_constants[1] = {};
+        // + 'int UseSDF' for the fragment shader (signed distance field textures)
+        VkPushConstantRange push_constants[2] = {};
         push_constants[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
         push_constants[0].offset = sizeof(float) * 0;
         push_constants[0].size = sizeof(float) * 4;
+        push_constants[1].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+        push_constants[1].offset = sizeof(float) * 4;
+        push_constants[1].size = sizeof(int);
         VkDescriptorSetLayout set_layout[1] = { bd->DescriptorSetLayout };
         VkPipelineLayoutCreateInfo layout_info = {};
         layout_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
         layout_info.setLayoutCount = 1;
         layout_info.pSetLayouts = set_layout;
-        layout_info.pushConstantRangeCount = 1;
+        layout_info.pushConstantRangeCount = 2;
         layout_info.pPushConstantRanges = push_constants;
         err = vkCreatePipelineLayout(v->Device, &layout_info, v->Allocator, &bd->PipelineLayout);
         check_vk_result(err);
@@ -1228,6 +1292,7 @@ bool    ImGui_ImplVulkan_Init(ImGui_ImplVulkan_InitInfo* info)
     io.BackendRendererName = "imgui_impl_vulkan";
     io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
     io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;   // We can honor ImGuiPlatformIO::Textures[] requests during render.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasSdfTextures; // We can draw textures storing signed distance fields.
 
     IM_ASSERT(info->Instance != VK_NULL_HANDLE);
     IM_ASSERT(info->PhysicalDevice != VK_NULL_HANDLE);
@@ -1278,7 +1343,7 @@ void ImGui_ImplVulkan_Shutdown()
 
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures);
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasSdfTextures);
     IM_DELETE(bd);
 }
 
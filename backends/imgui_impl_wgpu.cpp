@@ -59,6 +59,9 @@
 
 #ifndef IMGUI_DISABLE
 #include "imgui_impl_wgpu.h"
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#error "IMGUI_USE_COMPACT_DRAWVERT is not supported by this backend."
+#endif
 #include <limits.h>
 #include <webgpu/webgpu.h>
 
@@ -3,12 +3,23 @@ layout(location = 0) out vec4 fColor;
 
 layout(set=0, binding=0) uniform sampler2D sTexture;
 
+layout(push_constant) uniform uPushConstant {
+    layout(offset = 16) int uUseSDF;
+} pc;
+
 layout(location = 0) in struct {
     vec4 Color;
     vec2 UV;
 } In;
 
+// Signed distance fields (uUseSDF): alpha is 0.5 on glyph edges, anti-aliased over one pixel.
 void main()
 {
-    fColor = In.Color * texture(sTexture, In.UV.st);
+    vec4 tex_col = texture(sTexture, In.UV.st);
+    if (pc.uUseSDF != 0)
+    {
+        float w = max(fwidth(tex_col.a) * 0.5, 1.0 / 255.0);
+        tex_col.a = smoothstep(0.5 - w, 0.5 + w, tex_col.a);
+    }
+    fColor = In.Color * tex_col;
 }
@@ -0,0 +1,3 @@
+@REM Build for Visual Studio compiler. Run your copy of vcvars32.bat or vcvarsall.bat to setup command-line compiler.
+mkdir Release
+cl /nologo /O2 /Zi /MD /utf-8 /I ..\.. /D IMGUI_DEBUG_ALLOC_OWNER_THREAD_ONLY %* *.cpp ..\..\*.cpp /FeRelease/example_benchmark.exe /FoRelease/ /link gdi32.lib shell32.lib imm32.lib
@@ -0,0 +1,853 @@
+// dear imgui: "null" benchmark application
+// (compile and link imgui, create context, run headless with NO INPUTS, NO GRAPHICS OUTPUT)
+// This is used to measure the CPU cost of the library over reproducible scenarios, and catch performance regressions.
+// Build with optimizations enabled! Results are written as JSON (to stdout by default).
+// Compare implementations by building with different settings, e.g. 'make WITH_STORAGE_HASHMAP=1'.
+//
+// Usage:
+//   example_benchmark [--frames N] [--warmup N] [--filter substring] [--output file.json] [--cjk-font file.ttf]
+// Each scenario runs in a new context, with 'warmup' frames excluded from measurements.
+// Reported per scenario:
+//   - ns/frame (mean, median, min) measured from NewFrame() to Render() included.
+//   - allocations/frame (from ImGuiDebugAllocInfo, mean over measured frames).
+//   - vertices, indices, draw lists and draw calls of the last measured frame.
+// Checks compare optimized code paths against reference code: the application returns 1 if any check fails.
+
+#include "imgui.h"
+#include "imgui_internal.h"     // ImGuiDebugAllocInfo
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <thread>               // std::thread for multi-threaded ImDrawList recording
+
+static double GetTimeInNs()
+{
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Deterministic pseudo-random keys (xorshift32), so runs can be compared.
+static ImU32 NextRandom(ImU32* state)
+{
+    ImU32 x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark settings and output
+//-----------------------------------------------------------------------------
+
+struct BenchmarkSettings
+{
+    int             Frames = 100;
+    int             WarmupFrames = 10;
+    const char*     Filter = nullptr;
+    const char*     CjkFontFilename = nullptr;
+    FILE*           Output = nullptr;
+    bool            FirstEntry = true;  // JSON separator state
+};
+
+struct BenchmarkResult
+{
+    double          NsPerFrameMean = 0.0;
+    double          NsPerFrameMedian = 0.0;
+    double          NsPerFrameMin = 0.0;
+    double          AllocsPerFrame = 0.0;
+    int             Vertices = 0;
+    int             Indices = 0;
+    int             DrawLists = 0;
+    int             DrawCalls = 0;
+    double          DamagedAreaRatio = 1.0;     // Average ratio of display area to redraw per frame (always 1.0 when io.ConfigDamageTracking is disabled)
+};
+
+static void OutputBeginEntry(BenchmarkSettings* settings)
+{
+    fprintf(settings->Output, settings->FirstEntry ? "\n    " : ",\n    ");
+    settings->FirstEntry = false;
+}
+
+//-----------------------------------------------------------------------------
+// Scenarios
+//-----------------------------------------------------------------------------
+
+struct BenchmarkScenario
+{
+    const char*     Name;
+    void            (*Init)(BenchmarkSettings* settings);       // Called after creating context, may be NULL.
+    void            (*Frame)(int frame);                        // Submit contents for one frame.
+    void            (*Shutdown)();                              // Called before destroying context, may be NULL.
+};
+
+static void FullscreenWindowBegin(const char* name)
+{
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+    ImGui::Begin(name, nullptr, ImGuiWindowFlags_NoSavedSettings);
+}
+
+// 10k buttons laid out in a 100x100 grid, mostly visible.
+static void Scenario_Buttons10k_Frame(int)
+{
+    FullscreenWindowBegin("Buttons");
+    ImGui::PushStyleVarY(ImGuiStyleVar_ItemSpacing, 1.0f);
+    ImGui::PushStyleVarY(ImGuiStyleVar_FramePadding, 0.0f);
+    for (int n = 0; n < 10000; n++)
+    {
+        ImGui::PushID(n);
+        if ((n % 100) != 0)
+            ImGui::SameLine(0.0f, 1.0f);
+        ImGui::Button("B", ImVec2(18.0f, 0.0f));
+        ImGui::PopID();
+    }
+    ImGui::PopStyleVar(2);
+    ImGui::End();
+}
+
+// 1M rows table, coarse clipped with ImGuiListClipper, scrolling every frame.
+static void Scenario_Table1MRows_Frame(int frame)
+{
+    FullscreenWindowBegin("Table");
+    const ImGuiTableFlags flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable;
+    if (ImGui::BeginTable("table", 4, flags))
+    {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("ID");
+        ImGui::TableSetupColumn("Name");
+        ImGui::TableSetupColumn("Value");
+        ImGui::TableSetupColumn("Action");
+        ImGui::TableHeadersRow();
+        ImGuiListClipper clipper;
+        clipper.Begin(1000000);
+        while (clipper.Step())
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+            {
+                ImGui::PushID(row);
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%07d", row);
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted("Item name");
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", row * 0.001f);
+                ImGui::TableNextColumn();
+                ImGui::SmallButton("Edit");
+                ImGui::PopID();
+            }
+        ImGui::SetScrollY((float)((frame * 977) % 1000000) * ImGui::GetTextLineHeightWithSpacing());
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+// Large InputTextMultiline() buffer (~1 MB), active and scrolling.
+static ImVector<char> g_LargeTextBuffer;
+static void Scenario_InputTextMultiline_Init(BenchmarkSettings*)
+{
+    ImGuiTextBuffer buf;
+    for (int line = 0; line < 20000; line++)
+        buf.appendf("%05d: The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.\n", line);
+    g_LargeTextBuffer.resize(buf.size() + 1024 + 1);
+    memcpy(g_LargeTextBuffer.Data, buf.c_str(), (size_t)buf.size() + 1);
+}
+static void Scenario_InputTextMultiline_Frame(int frame)
+{
+    FullscreenWindowBegin("InputText");
+    if (frame == 0)
+        ImGui::SetKeyboardFocusHere();
+    ImGui::InputTextMultiline("##text", g_LargeTextBuffer.Data, (size_t)g_LargeTextBuffer.Size, ImVec2(-FLT_MIN, -FLT_MIN));
+    ImGui::End();
+}
+static void Scenario_InputTextMultiline_Shutdown()
+{
+    g_LargeTextBuffer.clear();
+}
+
+// Heavy text wrapping, with the wrap width changing every frame.
+static void Scenario_TextWrapping_Frame(int frame)
+{
+    ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(600.0f + (float)(frame % 20) * 30.0f, ImGui::GetIO().DisplaySize.y));
+    ImGui::Begin("Wrapping", nullptr, ImGuiWindowFlags_NoSavedSettings);
+    static const char* paragraph =
+        "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. "
+        "Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea commodo consequat. "
+        "Duis aute irure dolor in reprehenderit in voluptate velit esse cillum dolore eu fugiat nulla pariatur. "
+        "Excepteur sint occaecat cupidatat non proident, sunt in culpa qui officia deserunt mollit anim id est laborum.";
+    for (int n = 0; n < 200; n++)
+        ImGui::TextWrapped("%d: %s %s", n, paragraph, paragraph);
+    ImGui::End();
+}
+
+// Many windows, each with a few widgets.
+static void Scenario_ManyWindows_Frame(int)
+{
+    static float value = 0.5f;
+    const ImVec2 display_size = ImGui::GetIO().DisplaySize;
+    for (int n = 0; n < 1000; n++)
+    {
+        char name[32];
+        snprintf(name, IM_ARRAYSIZE(name), "Window %04d", n);
+        ImGui::SetNextWindowPos(ImVec2((float)((n * 37) % (int)(display_size.x - 200.0f)), (float)((n * 53) % (int)(display_size.y - 100.0f))), ImGuiCond_Once);
+        ImGui::SetNextWindowSize(ImVec2(200.0f, 100.0f), ImGuiCond_Once);
+        ImGui::Begin(name, nullptr, ImGuiWindowFlags_NoSavedSettings);
+        ImGui::Text("Window %d", n);
+        ImGui::SliderFloat("Value", &value, 0.0f, 1.0f);
+        ImGui::Button("OK");
+        ImGui::End();
+    }
+}
+
+// Many small windows with a child window each, while mouse is moving and regularly clicking (focusing) windows.
+// Exercise hovered window lookup and display order changes.
+static void Scenario_ManyWindowsMouse_Frame(int frame)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    const ImVec2 display_size = io.DisplaySize;
+    for (int n = 0; n < 4000; n++)
+    {
+        char name[32];
+        snprintf(name, IM_ARRAYSIZE(name), "Window %04d", n);
+        ImGui::SetNextWindowPos(ImVec2((float)((n * 37) % (int)(display_size.x - 120.0f)), (float)((n * 53) % (int)(display_size.y - 80.0f))), ImGuiCond_Once);
+        ImGui::SetNextWindowSize(ImVec2(120.0f, 80.0f), ImGuiCond_Once);
+        ImGui::Begin(name, nullptr, ImGuiWindowFlags_NoSavedSettings);
+        ImGui::BeginChild("child", ImVec2(0.0f, 0.0f), ImGuiChildFlags_Borders);
+        ImGui::Text("%d", n);
+        ImGui::EndChild();
+        ImGui::End();
+    }
+    io.AddMousePosEvent((float)((frame * 97) % (int)display_size.x), (float)((frame * 61) % (int)display_size.y));
+    io.AddMouseButtonEvent(0, (frame % 30) == 15);
+}
+
+// Dashboard: 16 windows displaying tables of mostly static data. Each frame the data of one window changes.
+// Submitted every frame, or using retained windows which only refresh when marked dirty (see ImGuiWindowFlags_Retained), or with damage tracking, or with text layout cache (see ImFontAtlasFlags_TextLayoutCache).
+static bool g_DashboardRetained = false;
+static void Scenario_Dashboard_Init(BenchmarkSettings*)
+{
+    g_DashboardRetained = false;
+}
+static void Scenario_DashboardRetained_Init(BenchmarkSettings*)
+{
+    g_DashboardRetained = true;
+}
+static void Scenario_DashboardDamageTracking_Init(BenchmarkSettings*)
+{
+    g_DashboardRetained = false;
+    ImGui::GetIO().ConfigDamageTracking = true;
+}
+static void Scenario_DashboardTextLayoutCache_Init(BenchmarkSettings*)
+{
+    g_DashboardRetained = false;
+    ImGui::GetIO().Fonts->Flags |= ImFontAtlasFlags_TextLayoutCache;
+}
+static void Scenario_Dashboard_Frame(int frame)
+{
+    const int windows_count = 16;
+    for (int window_n = 0; window_n < windows_count; window_n++)
+    {
+        char name[32];
+        snprintf(name, IM_ARRAYSIZE(name), "Dashboard %02d", window_n);
+        const int data_version = (frame + windows_count - window_n) / windows_count; // Changes for one window every frame
+        if (g_DashboardRetained && (frame % windows_count) == window_n)
+            ImGui::SetWindowDirty(name);
+        ImGui::SetNextWindowPos(ImVec2((float)(window_n % 4) * 480.0f, (float)(window_n / 4) * 270.0f), ImGuiCond_Once);
+        ImGui::SetNextWindowSize(ImVec2(470.0f, 260.0f), ImGuiCond_Once);
+        if (ImGui::Begin(name, nullptr, ImGuiWindowFlags_NoSavedSettings | (g_DashboardRetained ? ImGuiWindowFlags_Retained : 0)))
+        {
+            ImGui::Text("Data version %d", data_version);
+            ImGui::ProgressBar((float)(data_version % 100) / 100.0f);
+            if (ImGui::BeginTable("table", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+            {
+                for (int row = 0; row < 12; row++)
+                {
+                    ImGui::TableNextRow();
+                    for (int column = 0; column < 4; column++)
+                    {
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%d.%02d", row * 4 + column, (data_version * 7 + row) % 100);
+                    }
+                }
+                ImGui::EndTable();
+            }
+        }
+        ImGui::End();
+    }
+}
+
+// Tree heavy UI: thousands of tree nodes, all storing their open state in the window storage.
+static void Scenario_TreeNodes20k_Frame(int)
+{
+    FullscreenWindowBegin("Tree");
+    for (int n = 0; n < 20000; n++)
+    {
+        ImGui::SetNextItemOpen((n % 3) == 0, ImGuiCond_Once);
+        if (ImGui::TreeNode((void*)(intptr_t)n, "Node %d", n))
+            ImGui::TreePop();
+    }
+    ImGui::End();
+}
+
+// Keyboard navigation in a long list without clipping, holding Down arrow so a move request is submitted (and scrolls) every frame.
+// Compare against item count, and against the same list without navigation.
+static int  g_NavListItemsCount = 0;
+static bool g_NavListMoving = false;
+static void Scenario_NavList_Init(int items_count, bool moving)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
+    io.KeyRepeatDelay = 0.0f;
+    io.KeyRepeatRate = io.DeltaTime * 0.5f; // Repeat every frame
+    g_NavListItemsCount = items_count;
+    g_NavListMoving = moving;
+}
+static void Scenario_NavList1kMoving_Init(BenchmarkSettings*)   { Scenario_NavList_Init(1000, true); }
+static void Scenario_NavList10kMoving_Init(BenchmarkSettings*)  { Scenario_NavList_Init(10000, true); }
+static void Scenario_NavList50kMoving_Init(BenchmarkSettings*)  { Scenario_NavList_Init(50000, true); }
+static void Scenario_NavList50kIdle_Init(BenchmarkSettings*)    { Scenario_NavList_Init(50000, false); }
+static void Scenario_NavList_Frame(int frame)
+{
+    if (frame == 0 && g_NavListMoving)
+        ImGui::GetIO().AddKeyEvent(ImGuiKey_DownArrow, true);
+    FullscreenWindowBegin("List");
+    for (int n = 0; n < g_NavListItemsCount; n++)
+    {
+        ImGui::PushID(n);
+        ImGui::Selectable("Item");
+        ImGui::PopID();
+    }
+    ImGui::End();
+}
+
+// Glyph baking: use a new font size every frame, so each frame bakes all visible glyphs again.
+static void Scenario_GlyphBaking_Frame(int frame)
+{
+    FullscreenWindowBegin("Glyphs");
+    ImGui::PushFont(nullptr, 10.0f + (float)(frame % 500) * 0.25f);
+    for (int line = 0; line < 10; line++)
+        ImGui::TextUnformatted("ABCDEFGHIJKLMNOPQRSTUVWXYZ abcdefghijklmnopqrstuvwxyz 0123456789 !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~");
+    ImGui::PopFont();
+    ImGui::End();
+}
+
+// CJK glyph baking: display 1000 CJK codepoints never displayed before every frame. Requires a CJK font (see --cjk-font).
+static ImFont* g_CjkFont = nullptr;
+static void Scenario_CjkGlyphBaking_Init(BenchmarkSettings* settings)
+{
+    g_CjkFont = ImGui::GetIO().Fonts->AddFontFromFileTTF(settings->CjkFontFilename);
+}
+static void Scenario_CjkGlyphBaking_Frame(int frame)
+{
+    FullscreenWindowBegin("CJK");
+    ImGui::PushFont(g_CjkFont, 20.0f);
+    const unsigned int codepoint_base = 0x4E00 + (unsigned int)((frame * 1000) % (0x9FFF - 0x4E00 - 1000));
+    char line[50 * 4 + 1];
+    for (int line_n = 0; line_n < 20; line_n++)
+    {
+        char* p = line;
+        for (int n = 0; n < 50; n++)
+        {
+            const unsigned int c = codepoint_base + (unsigned int)(line_n * 50 + n);
+            *p++ = (char)(0xE0 + (c >> 12));
+            *p++ = (char)(0x80 + ((c >> 6) & 0x3F));
+            *p++ = (char)(0x80 + (c & 0x3F));
+        }
+        *p = 0;
+        ImGui::TextUnformatted(line);
+    }
+    ImGui::PopFont();
+    ImGui::End();
+}
+static void Scenario_CjkGlyphBaking_Shutdown()
+{
+    g_CjkFont = nullptr;
+}
+
+// Custom canvas: 100k primitives recorded on the main thread into the window draw list,
+// or recorded concurrently into standalone draw lists on worker threads and then appended in order (see ImDrawList::AddDrawList()).
+static const int            CANVAS_PRIMITIVES_COUNT = 100000;
+static int                  g_CanvasThreadsCount = 1;
+static ImVector<ImDrawList*> g_CanvasDrawLists;
+static void Scenario_Canvas_Init(BenchmarkSettings*)
+{
+    g_CanvasThreadsCount = 1;
+}
+static void Scenario_CanvasThreaded_Init(BenchmarkSettings*)
+{
+    g_CanvasThreadsCount = ImClamp((int)std::thread::hardware_concurrency(), 2, 16);
+    for (int n = 0; n < g_CanvasThreadsCount; n++)
+        g_CanvasDrawLists.push_back(IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData()));
+}
+static void Scenario_Canvas_Shutdown()
+{
+    for (ImDrawList* draw_list : g_CanvasDrawLists)
+        IM_DELETE(draw_list);
+    g_CanvasDrawLists.clear();
+}
+static void RecordCanvasPrimitives(ImDrawList* draw_list, ImVec2 origin, int prim_begin, int prim_end, int frame)
+{
+    for (int n = prim_begin; n < prim_end; n++)
+    {
+        const ImVec2 p(origin.x + (float)(n % 400) * 4.5f, origin.y + (float)((n / 400) % 200) * 4.5f);
+        const ImU32 col = IM_COL32((n * 7) & 255, (n + frame) & 255, 128, 255);
+        switch (n & 3)
+        {
+        case 0: draw_list->AddRectFilled(p, ImVec2(p.x + 3.0f, p.y + 3.0f), col); break;
+        case 1: draw_list->AddCircleFilled(ImVec2(p.x + 1.5f, p.y + 1.5f), 1.5f, col); break;
+        case 2: draw_list->AddLine(p, ImVec2(p.x + 3.0f, p.y + 3.0f), col); break;
+        case 3: draw_list->AddTriangleFilled(p, ImVec2(p.x + 3.0f, p.y), ImVec2(p.x, p.y + 3.0f), col); break;
+        }
+    }
+}
+static void Scenario_Canvas_Frame(int frame)
+{
+    FullscreenWindowBegin("Canvas");
+    ImDrawList* window_draw_list = ImGui::GetWindowDrawList();
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    if (g_CanvasThreadsCount == 1)
+    {
+        RecordCanvasPrimitives(window_draw_list, origin, 0, CANVAS_PRIMITIVES_COUNT, frame);
+    }
+    else
+    {
+        // Fork: each thread owns one draw list, the main thread records the first one.
+        // Lists are kept alive across frames so their buffers stop growing after the first frames. Allocations made on worker threads are not included in allocs_per_frame.
+        const int prims_per_list = CANVAS_PRIMITIVES_COUNT / g_CanvasThreadsCount;
+        auto record_func = [=](int list_n)
+        {
+            ImDrawList* draw_list = g_CanvasDrawLists[list_n];
+            const int prim_end = (list_n + 1 == g_CanvasThreadsCount) ? CANVAS_PRIMITIVES_COUNT : (list_n + 1) * prims_per_list;
+            draw_list->Reset();
+            RecordCanvasPrimitives(draw_list, origin, list_n * prims_per_list, prim_end, frame);
+        };
+        ImVector<std::thread*> threads;
+        for (int n = 1; n < g_CanvasThreadsCount; n++)
+            threads.push_back(new std::thread(record_func, n));
+        record_func(0);
+
+        // Join, then append in a deterministic order
+        for (std::thread* thread : threads)
+        {
+            thread->join();
+            delete thread;
+        }
+        for (ImDrawList* draw_list : g_CanvasDrawLists)
+            window_draw_list->AddDrawList(draw_list);
+    }
+    ImGui::End();
+}
+
+// Plot lines: 100 anti-aliased polylines of 1000 points each, alternating thicknesses so all tessellation paths are used.
+static void Scenario_Polylines_Frame(int frame)
+{
+    FullscreenWindowBegin("Polylines");
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    ImVec2 points[1000];
+    for (int line_n = 0; line_n < 100; line_n++)
+    {
+        for (int n = 0; n < IM_ARRAYSIZE(points); n++)
+            points[n] = ImVec2(origin.x + (float)n * 1.8f, origin.y + 500.0f + ImSin((float)(n + frame + line_n * 10) * 0.05f) * (float)(100 + line_n * 3));
+        const float thickness = (line_n % 3 == 0) ? 1.0f : (line_n % 3 == 1) ? 1.5f : 4.0f;
+        draw_list->AddPolyline(points, IM_ARRAYSIZE(points), IM_COL32(255, line_n * 2, 0, 255), ImDrawFlags_None, thickness);
+    }
+    ImGui::End();
+}
+
+// Scatter plot: 50k rects, lines and circles with per-item colors, half of them outside the window.
+// Submitted one by one, or with the batch functions (see ImDrawList::AddRectFilledBatch()) culling against the clipping rectangle.
+static const int            SCATTER_ITEMS_COUNT = 50000;
+static bool                 g_ScatterBatched = false;
+static ImVector<ImVec2>     g_ScatterPoints;
+static ImVector<ImU32>      g_ScatterColors;
+static void Scenario_Scatter_Init(BenchmarkSettings*)
+{
+    g_ScatterBatched = false;
+}
+static void Scenario_ScatterBatched_Init(BenchmarkSettings*)
+{
+    g_ScatterBatched = true;
+}
+static void Scenario_Scatter_Shutdown()
+{
+    g_ScatterPoints.clear();
+    g_ScatterColors.clear();
+}
+static void Scenario_Scatter_Frame(int frame)
+{
+    FullscreenWindowBegin("Scatter");
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const ImVec2 origin = ImGui::GetCursorScreenPos();
+    g_ScatterPoints.resize(SCATTER_ITEMS_COUNT * 2);
+    g_ScatterColors.resize(SCATTER_ITEMS_COUNT);
+    ImU32 rng = 0x12345678 + (ImU32)frame;
+    for (int n = 0; n < SCATTER_ITEMS_COUNT; n++)
+    {
+        const ImVec2 p(origin.x + (float)(NextRandom(&rng) % 3840), origin.y + (float)(NextRandom(&rng) % 1080));
+        g_ScatterPoints[n * 2 + 0] = p;
+        g_ScatterPoints[n * 2 + 1] = ImVec2(p.x + 4.0f, p.y + 3.0f);
+        g_ScatterColors[n] = IM_COL32(n & 255, (n >> 8) & 255, frame & 255, 255);
+    }
+    const ImVec2* points = g_ScatterPoints.Data;
+    const ImU32* cols = g_ScatterColors.Data;
+    if (g_ScatterBatched)
+    {
+        draw_list->AddRectFilledBatch(points, SCATTER_ITEMS_COUNT, 0, cols, ImDrawFlags_CullToClipRect);
+        draw_list->AddLineBatch(points, SCATTER_ITEMS_COUNT, 0, 1.0f, cols, ImDrawFlags_CullToClipRect);
+        draw_list->AddCircleFilledBatch(points, SCATTER_ITEMS_COUNT, 2.0f, 0, 0, cols, ImDrawFlags_CullToClipRect);
+    }
+    else
+    {
+        for (int n = 0; n < SCATTER_ITEMS_COUNT; n++)
+            draw_list->AddRectFilled(points[n * 2 + 0], points[n * 2 + 1], cols[n]);
+        for (int n = 0; n < SCATTER_ITEMS_COUNT; n++)
+            draw_list->AddLine(points[n * 2 + 0], points[n * 2 + 1], cols[n]);
+        for (int n = 0; n < SCATTER_ITEMS_COUNT; n++)
+            draw_list->AddCircleFilled(points[n * 2 + 0], 2.0f, cols[n]);
+    }
+    ImGui::End();
+}
+
+static const BenchmarkScenario g_Scenarios[] =
+{
+    { "buttons_10k",                nullptr,                            Scenario_Buttons10k_Frame,          nullptr },
+    { "table_1m_rows_clipped",      nullptr,                            Scenario_Table1MRows_Frame,         nullptr },
+    { "input_text_multiline_large", Scenario_InputTextMultiline_Init,   Scenario_InputTextMultiline_Frame,  Scenario_InputTextMultiline_Shutdown },
+    { "text_wrapping",              nullptr,                            Scenario_TextWrapping_Frame,        nullptr },
+    { "many_windows_1k",            nullptr,                            Scenario_ManyWindows_Frame,         nullptr },
+    { "many_windows_4k_mouse",      nullptr,                            Scenario_ManyWindowsMouse_Frame,    nullptr },
+    { "dashboard_16_windows",       Scenario_Dashboard_Init,            Scenario_Dashboard_Frame,           nullptr },
+    { "dashboard_16_windows_retained", Scenario_DashboardRetained_Init, Scenario_Dashboard_Frame,           nullptr },
+    { "dashboard_16_windows_damage", Scenario_DashboardDamageTracking_Init, Scenario_Dashboard_Frame,           nullptr },
+    { "dashboard_16_windows_text_cache", Scenario_DashboardTextLayoutCache_Init, Scenario_Dashboard_Frame,   nullptr },
+    { "tree_nodes_20k",             nullptr,                            Scenario_TreeNodes20k_Frame,        nullptr },
+    { "nav_list_1k_moving",         Scenario_NavList1kMoving_Init,      Scenario_NavList_Frame,             nullptr },
+    { "nav_list_10k_moving",        Scenario_NavList10kMoving_Init,     Scenario_NavList_Frame,             nullptr },
+    { "nav_list_50k_moving",        Scenario_NavList50kMoving_Init,     Scenario_NavList_Frame,             nullptr },
+    { "nav_list_50k_idle",          Scenario_NavList50kIdle_Init,       Scenario_NavList_Frame,             nullptr },
+    { "glyph_baking",               nullptr,                            Scenario_GlyphBaking_Frame,         nullptr },
+    { "canvas_100k",                Scenario_Canvas_Init,               Scenario_Canvas_Frame,              Scenario_Canvas_Shutdown },
+    { "canvas_100k_threaded",       Scenario_CanvasThreaded_Init,       Scenario_Canvas_Frame,              Scenario_Canvas_Shutdown },
+    { "polylines_100x1000",         nullptr,                            Scenario_Polylines_Frame,           nullptr },
+    { "scatter_50k",                Scenario_Scatter_Init,              Scenario_Scatter_Frame,             Scenario_Scatter_Shutdown },
+    { "scatter_50k_batched",        Scenario_ScatterBatched_Init,       Scenario_Scatter_Frame,             Scenario_Scatter_Shutdown },
+    { "cjk_glyph_baking",           Scenario_CjkGlyphBaking_Init,       Scenario_CjkGlyphBaking_Frame,      Scenario_CjkGlyphBaking_Shutdown },
+};
+
+//-----------------------------------------------------------------------------
+// Scenario runner
+//-----------------------------------------------------------------------------
+
+// Honor texture requests as a renderer backend would, so atlas updates don't accumulate.
+static void NullRendererUpdateTextures()
+{
+    for (ImTextureData* tex : ImGui::GetPlatformIO().Textures)
+    {
+        if (tex->Status == ImTextureStatus_WantCreate)
+        {
+            tex->SetTexID((ImTextureID)(intptr_t)tex->UniqueID);
+            tex->SetStatus(ImTextureStatus_OK);
+        }
+        else if (tex->Status == ImTextureStatus_WantUpdates)
+        {
+            tex->SetStatus(ImTextureStatus_OK);
+        }
+        else if (tex->Status == ImTextureStatus_WantDestroy && tex->UnusedFrames > 0)
+        {
+            tex->SetTexID(ImTextureID_Invalid);
+            tex->SetStatus(ImTextureStatus_Destroyed);
+        }
+    }
+}
+
+static int IMGUI_CDECL CompareDouble(const void* lhs, const void* rhs)
+{
+    const double a = *(const double*)lhs;
+    const double b = *(const double*)rhs;
+    return (a > b) ? +1 : (a < b) ? -1 : 0;
+}
+
+static BenchmarkResult RunScenario(BenchmarkSettings* settings, const BenchmarkScenario* scenario)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasVtxOffset;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    ImGuiContext& g = *GImGui;
+    if (scenario->Init)
+        scenario->Init(settings);
+
+    ImVector<double> frame_times;
+    int allocs_total = 0;
+    double damaged_area_total = 0.0;
+    for (int frame = 0; frame < settings->WarmupFrames + settings->Frames; frame++)
+    {
+        const int allocs_before = g.DebugAllocInfo.TotalAllocCount;
+        const double t0 = GetTimeInNs();
+        ImGui::NewFrame();
+        scenario->Frame(frame);
+        ImGui::Render();
+        const double t1 = GetTimeInNs();
+        NullRendererUpdateTextures();
+        if (frame < settings->WarmupFrames)
+            continue;
+        frame_times.push_back(t1 - t0);
+        allocs_total += g.DebugAllocInfo.TotalAllocCount - allocs_before;
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        double damaged_area = draw_data->DamageTracked ? 0.0 : (double)(io.DisplaySize.x * io.DisplaySize.y);
+        for (const ImVec4& rect : draw_data->DamageRects)
+            damaged_area += (double)((rect.z - rect.x) * (rect.w - rect.y));
+        damaged_area_total += damaged_area / (double)(io.DisplaySize.x * io.DisplaySize.y);
+    }
+
+    BenchmarkResult result;
+    double sum = 0.0;
+    for (double t : frame_times)
+        sum += t;
+    ImQsort(frame_times.Data, (size_t)frame_times.Size, sizeof(double), CompareDouble);
+    result.NsPerFrameMean = sum / frame_times.Size;
+    result.NsPerFrameMedian = frame_times[frame_times.Size / 2];
+    result.NsPerFrameMin = frame_times[0];
+    result.AllocsPerFrame = (double)allocs_total / frame_times.Size;
+    result.DamagedAreaRatio = damaged_area_total / frame_times.Size;
+    ImDrawData* draw_data = ImGui::GetDrawData();
+    result.Vertices = draw_data->TotalVtxCount;
+    result.Indices = draw_data->TotalIdxCount;
+    result.DrawLists = draw_data->CmdListsCount;
+    for (ImDrawList* draw_list : draw_data->CmdLists)
+        result.DrawCalls += draw_list->CmdBuffer.Size;
+
+    if (scenario->Shutdown)
+        scenario->Shutdown();
+    ImGui::DestroyContext();
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+// Microbenchmarks
+//-----------------------------------------------------------------------------
+
+static void Microbenchmark_Storage(BenchmarkSettings* settings, int keys_count)
+{
+    ImVector<ImGuiID> keys;
+    keys.resize(keys_count);
+    ImU32 rng = 0x12345678;
+    for (int n = 0; n < keys_count; n++)
+        keys[n] = NextRandom(&rng);
+
+    ImGuiStorage storage;
+    const double t0 = GetTimeInNs();
+    for (int n = 0; n < keys_count; n++)
+        storage.SetInt(keys[n], n);
+    const double t1 = GetTimeInNs();
+    ImU32 checksum = 0;
+    for (int n = 0; n < keys_count; n++)
+        checksum += (ImU32)storage.GetInt(keys[n], 0);
+    const double t2 = GetTimeInNs();
+    for (int n = 0; n < keys_count; n++)
+        *storage.GetIntRef(keys[n] ^ 1, 0) += 1; // Half of these are misses + insertions
+    const double t3 = GetTimeInNs();
+
+    const char* names[] = { "storage_insert", "storage_lookup", "storage_lookup_or_insert" };
+    const double times[] = { t1 - t0, t2 - t1, t3 - t2 };
+    for (int n = 0; n < IM_ARRAYSIZE(names); n++)
+    {
+        OutputBeginEntry(settings);
+        fprintf(settings->Output, "{ \"name\": \"%s\", \"count\": %d, \"ns_per_op\": %.2f, \"checksum\": %u }", names[n], keys_count, times[n] / keys_count, checksum);
+    }
+}
+
+// Measure text with ImFont::CalcTextSizeA(), which unlike ImGui::CalcTextSize() doesn't memoize results.
+// Uses a context to load the default font. Text is ~40 bytes long: mostly ASCII (with a line break), UTF-8 (Greek), or wrapped ASCII.
+static void Microbenchmark_TextMeasure(BenchmarkSettings* settings, int iterations)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+    io.DisplaySize = ImVec2(1920, 1080);
+    ImGui::NewFrame();
+
+    struct TextMeasureCase { const char* Name; const char* Text; float WrapWidth; };
+    const TextMeasureCase cases[] =
+    {
+        { "text_measure_ascii",   "Frame time: 16.67 ms\nVisible windows: 12", 0.0f },
+        { "text_measure_utf8",    "\xCE\x91\xCF\x81\xCF\x87\xCE\xB5\xCE\xAF\xCE\xBF \xCE\xBA\xCE\xB5\xCE\xB9\xCE\xBC\xCE\xAD\xCE\xBD\xCE\xBF\xCF\x85 \xCE\xB1\xCE\xBD\xCE\xBF\xCE\xB9\xCF\x87\xCF\x84\xCF\x8C", 0.0f },
+        { "text_measure_wrapped", "The quick brown fox jumps over the lazy dog", 100.0f },
+    };
+    ImFont* font = ImGui::GetFont();
+    const float font_size = ImGui::GetFontSize();
+    for (const TextMeasureCase& measure_case : cases)
+    {
+        const char* text_end = measure_case.Text + strlen(measure_case.Text);
+        float checksum = 0.0f;
+        const double t0 = GetTimeInNs();
+        for (int n = 0; n < iterations; n++)
+            checksum += font->CalcTextSizeA(font_size, FLT_MAX, measure_case.WrapWidth, measure_case.Text, text_end).x;
+        const double t1 = GetTimeInNs();
+        OutputBeginEntry(settings);
+        fprintf(settings->Output, "{ \"name\": \"%s\", \"count\": %d, \"ns_per_op\": %.2f, \"ns_per_byte\": %.3f, \"checksum\": %.0f }", measure_case.Name, iterations, (t1 - t0) / iterations, (t1 - t0) / iterations / (double)(text_end - measure_case.Text), checksum);
+    }
+
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+}
+
+//-----------------------------------------------------------------------------
+// Checks
+//-----------------------------------------------------------------------------
+
+// Tessellate polylines with SIMD code and scalar code (see ImDrawListSharedData::DebugPolylineNoSimd): output must be identical bit for bit.
+// Covers all anti-aliased paths (texture, thin, thick), open and closed lines, odd and even point counts and degenerate segments.
+static bool Check_PolylineSimd(BenchmarkSettings* settings)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasVtxOffset; // Large lists with 16-bit indices
+    io.DisplaySize = ImVec2(1920, 1080);
+    ImGui::NewFrame();
+
+    ImDrawListSharedData* shared_data = ImGui::GetDrawListSharedData();
+    ImDrawList* draw_lists[2] = { IM_NEW(ImDrawList)(shared_data), IM_NEW(ImDrawList)(shared_data) };
+    const float thicknesses[] = { 0.5f, 1.0f, 1.5f, 2.0f, 3.0f, 4.7f };
+    const int points_counts[] = { 2, 3, 4, 5, 6, 7, 8, 9, 16, 17, 33, 1000 };
+    ImVector<ImVec2> points;
+    int polylines_count = 0;
+    for (int pass = 0; pass < 2; pass++)
+    {
+        shared_data->DebugPolylineNoSimd = (pass == 1);
+        ImDrawList* draw_list = draw_lists[pass];
+        draw_list->Reset();
+        ImU32 rng = 0x12345678;
+        polylines_count = 0;
+        for (int use_tex = 0; use_tex < 2; use_tex++)
+            for (float thickness : thicknesses)
+                for (int points_count : points_counts)
+                    for (int closed = 0; closed < 2; closed++)
+                    {
+                        draw_list->Flags = use_tex ? (draw_list->Flags | ImDrawListFlags_AntiAliasedLinesUseTex) : (draw_list->Flags & ~ImDrawListFlags_AntiAliasedLinesUseTex);
+                        points.resize(points_count);
+                        for (int n = 0; n < points_count; n++)
+                        {
+                            const ImU32 r = NextRandom(&rng);
+                            if (n > 0 && (r & 7) == 0)
+                                points[n] = points[n - 1]; // Zero-length segment
+                            else
+                                points[n] = ImVec2((float)(r & 0xFFFF) * (1000.0f / 0xFFFF), (float)(r >> 16) * (1000.0f / 0xFFFF));
+                        }
+                        draw_list->AddPolyline(points.Data, points_count, IM_COL32(255, 128, 0, 200), closed ? ImDrawFlags_Closed : ImDrawFlags_None, thickness);
+                        polylines_count++;
+                    }
+    }
+    shared_data->DebugPolylineNoSimd = false;
+
+    const ImDrawList* a = draw_lists[0];
+    const ImDrawList* b = draw_lists[1];
+    const bool pass = a->VtxBuffer.Size == b->VtxBuffer.Size && a->IdxBuffer.Size == b->IdxBuffer.Size
+        && memcmp(a->VtxBuffer.Data, b->VtxBuffer.Data, (size_t)a->VtxBuffer.size_in_bytes()) == 0
+        && memcmp(a->IdxBuffer.Data, b->IdxBuffer.Data, (size_t)a->IdxBuffer.size_in_bytes()) == 0;
+    OutputBeginEntry(settings);
+    fprintf(settings->Output, "{ \"name\": \"polyline_simd\", \"polylines\": %d, \"vertices\": %d, \"indices\": %d, \"pass\": %s }", polylines_count, a->VtxBuffer.Size, a->IdxBuffer.Size, pass ? "true" : "false");
+
+    IM_DELETE(draw_lists[0]);
+    IM_DELETE(draw_lists[1]);
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return pass;
+}
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+static bool PassFilter(const BenchmarkSettings* settings, const char* name)
+{
+    return settings->Filter == nullptr || strstr(name, settings->Filter) != nullptr;
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+
+    BenchmarkSettings settings;
+    const char* output_filename = nullptr;
+    for (int n = 1; n < argc; n++)
+    {
+        const bool has_value = (n + 1 < argc);
+        if (strcmp(argv[n], "--frames") == 0 && has_value)          { settings.Frames = ImMax(atoi(argv[++n]), 1); }
+        else if (strcmp(argv[n], "--warmup") == 0 && has_value)     { settings.WarmupFrames = ImMax(atoi(argv[++n]), 0); }
+        else if (strcmp(argv[n], "--filter") == 0 && has_value)     { settings.Filter = argv[++n]; }
+        else if (strcmp(argv[n], "--output") == 0 && has_value)     { output_filename = argv[++n]; }
+        else if (strcmp(argv[n], "--cjk-font") == 0 && has_value)   { settings.CjkFontFilename = argv[++n]; }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--frames N] [--warmup N] [--filter substring] [--output file.json] [--cjk-font file.ttf]\n", argv[0]);
+            return 1;
+        }
+    }
+    settings.Output = output_filename ? fopen(output_filename, "wt") : stdout;
+    if (settings.Output == nullptr)
+    {
+        fprintf(stderr, "Could not open '%s' for writing.\n", output_filename);
+        return 1;
+    }
+
+    // Compile-time configuration
+    bool storage_hashmap = false;
+#ifdef IMGUI_ENABLE_STORAGE_HASHMAP
+    storage_hashmap = true;
+#endif
+    fprintf(settings.Output, "{\n  \"imgui_version\": \"%s\",\n  \"imgui_version_num\": %d,\n", IMGUI_VERSION, IMGUI_VERSION_NUM);
+    fprintf(settings.Output, "  \"config\": { \"frames\": %d, \"warmup_frames\": %d, \"hardware_threads\": %d, \"sizeof_drawvert\": %d, \"sizeof_drawidx\": %d, \"storage_hashmap\": %s },\n",
+        settings.Frames, settings.WarmupFrames, (int)std::thread::hardware_concurrency(), (int)sizeof(ImDrawVert), (int)sizeof(ImDrawIdx), storage_hashmap ? "true" : "false");
+
+    // Scenarios
+    fprintf(settings.Output, "  \"scenarios\": [");
+    settings.FirstEntry = true;
+    for (const BenchmarkScenario& scenario : g_Scenarios)
+    {
+        if (!PassFilter(&settings, scenario.Name))
+            continue;
+        OutputBeginEntry(&settings);
+        if (scenario.Init == Scenario_CjkGlyphBaking_Init && settings.CjkFontFilename == nullptr)
+        {
+            fprintf(settings.Output, "{ \"name\": \"%s\", \"skipped\": \"requires --cjk-font\" }", scenario.Name);
+            continue;
+        }
+        BenchmarkResult r = RunScenario(&settings, &scenario);
+        fprintf(settings.Output, "{ \"name\": \"%s\", \"ns_per_frame_mean\": %.0f, \"ns_per_frame_median\": %.0f, \"ns_per_frame_min\": %.0f, \"allocs_per_frame\": %.2f, \"vertices\": %d, \"indices\": %d, \"draw_lists\": %d, \"draw_calls\": %d, \"damaged_area_ratio\": %.4f }",
+            scenario.Name, r.NsPerFrameMean, r.NsPerFrameMedian, r.NsPerFrameMin, r.AllocsPerFrame, r.Vertices, r.Indices, r.DrawLists, r.DrawCalls, r.DamagedAreaRatio);
+        fflush(settings.Output);
+    }
+    fprintf(settings.Output, "\n  ],\n");
+
+    // Microbenchmarks
+    fprintf(settings.Output, "  \"microbenchmarks\": [");
+    settings.FirstEntry = true;
+    if (PassFilter(&settings, "storage"))
+    {
+        Microbenchmark_Storage(&settings, 1000);
+        Microbenchmark_Storage(&settings, 10000);
+        Microbenchmark_Storage(&settings, 100000);
+    }
+    if (PassFilter(&settings, "text_measure"))
+        Microbenchmark_TextMeasure(&settings, 1000000);
+    fprintf(settings.Output, "\n  ],\n");
+
+    // Checks
+    fprintf(settings.Output, "  \"checks\": [");
+    settings.FirstEntry = true;
+    bool checks_pass = true;
+    if (PassFilter(&settings, "polyline_simd"))
+        checks_pass &= Check_PolylineSimd(&settings);
+    fprintf(settings.Output, "\n  ]\n}\n");
+
+    if (settings.Output != stdout)
+        fclose(settings.Output);
+    return checks_pass ? 0 : 1;
+}
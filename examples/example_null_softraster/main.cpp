@@ -0,0 +1,80 @@
+// dear imgui: headless example application using the software rasterizer
+// (compile and link imgui, create context, run headless with NO INPUTS, render into a memory buffer and save it as a .tga file)
+// This is useful to test rendering on machines without a GPU, or to create pixel-exact regression tests.
+#include "imgui.h"
+#include "imgui_impl_softraster.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Write a RGBA32 buffer into an uncompressed .tga file
+static bool SaveTGA(const char* filename, const unsigned char* pixels, int width, int height)
+{
+    FILE* f = fopen(filename, "wb");
+    if (f == nullptr)
+        return false;
+    const unsigned char header[18] = { 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, (unsigned char)width, (unsigned char)(width >> 8), (unsigned char)height, (unsigned char)(height >> 8), 32, 0x28 };
+    fwrite(header, 1, sizeof(header), f);
+    for (int n = 0; n < width * height; n++)
+    {
+        const unsigned char* p = pixels + n * 4;
+        const unsigned char bgra[4] = { p[2], p[1], p[0], p[3] };
+        fwrite(bgra, 1, 4, f);
+    }
+    fclose(f);
+    return true;
+}
+
+// Usage: example_null_softraster [output.tga]
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr; // Don't write imgui.ini: output only depends on this code
+
+    // Setup Dear ImGui style
+    ImGui::StyleColorsDark();
+
+    // Setup renderer backend (0 == use all hardware threads)
+    ImGui_ImplSoftRaster_InitInfo init_info;
+    init_info.ThreadsCount = 0;
+    ImGui_ImplSoftRaster_Init(&init_info);
+
+    // Our output buffer
+    const int width = 1280, height = 720;
+    unsigned char* pixels = (unsigned char*)malloc((size_t)width * height * 4);
+    ImVec4 clear_color = ImVec4(0.45f, 0.55f, 0.60f, 1.00f);
+
+    for (int n = 0; n < 20; n++)
+    {
+        printf("NewFrame() %d\n", n);
+        io.DisplaySize = ImVec2((float)width, (float)height);
+        io.DeltaTime = 1.0f / 60.0f;
+        ImGui_ImplSoftRaster_NewFrame();
+        ImGui::NewFrame();
+
+        static float f = 0.0f;
+        ImGui::Text("Hello, world!");
+        ImGui::SliderFloat("float", &f, 0.0f, 1.0f);
+        ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
+        ImGui::ShowDemoWindow(nullptr);
+
+        // Rendering
+        ImGui::Render();
+        const unsigned char clear_rgba[4] = { (unsigned char)(clear_color.x * 255), (unsigned char)(clear_color.y * 255), (unsigned char)(clear_color.z * 255), 255 };
+        for (int i = 0; i < width * height; i++)
+            memcpy(pixels + i * 4, clear_rgba, 4);
+        ImGui_ImplSoftRaster_RenderDrawData(ImGui::GetDrawData(), pixels, width, height, width * 4);
+    }
+
+    if (argc > 1)
+        printf("SaveTGA(\"%s\") %s\n", argv[1], SaveTGA(argv[1], pixels, width, height) ? "OK" : "failed");
+
+    // Cleanup
+    printf("DestroyContext()\n");
+    ImGui_ImplSoftRaster_Shutdown();
+    ImGui::DestroyContext();
+    free(pixels);
+    return 0;
+}
@@ -156,6 +156,13 @@ int main(int, char**)
         // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application, or clear/overwrite your copy of the mouse data.
         // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application, or clear/overwrite your copy of the keyboard data.
         // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
+        // To save power, we wait for the next event when dear imgui doesn't need to redraw (io.WantRedraw == false),
+        // for no longer than io.WantRedrawTimeout (e.g. blinking text cursor, tooltip delay). Remove this if you render continuously.
+        // If your own application code animates or receives data from elsewhere, call ImGui::RequestRedraw() to keep frames coming.
+#ifndef __EMSCRIPTEN__
+        if (!io.WantRedraw)
+            SDL_WaitEventTimeout(nullptr, (io.WantRedrawTimeout < 1000000.0f) ? (int)(io.WantRedrawTimeout * 1000.0f) + 1 : -1);
+#endif
         SDL_Event event;
         while (SDL_PollEvent(&event))
         {
@@ -50,6 +50,7 @@
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
 //#define IMGUI_DISABLE_DEFAULT_FONT                        // Disable default embedded font (ProggyClean.ttf), remove ~9.5 KB from output binary. AddFontDefault() will assert.
 //#define IMGUI_DISABLE_SSE                                 // Disable use of SSE intrinsics even if available
+//#define IMGUI_DISABLE_NEON                                // Disable use of NEON intrinsics even if available (AArch64 only)
 
 //---- Enable Test Engine / Automation features.
 //#define IMGUI_ENABLE_TEST_ENGINE                          // Enable imgui_test_engine hooks. Generally set automatically by include "imgui_te_config.h", see Test Engine for details.
@@ -68,6 +69,14 @@
 //---- Use 32-bit for ImWchar (default is 16-bit) to support Unicode planes 1-16. (e.g. point beyond 0xFFFF like emoticons, dingbats, symbols, shapes, ancient languages, etc...)
 //#define IMGUI_USE_WCHAR32
 
+//---- Use an open-addressing hash table index for ImGuiStorage (amortized O(1) lookup and insertion) instead of a sorted array (O(log N) lookup, O(N) insertion).
+// Useful when a context holds tens of thousands of tree node states/IDs and inserts many of them per frame. Pairs in ImGuiStorage::Data are no longer sorted by key.
+//#define IMGUI_ENABLE_STORAGE_HASHMAP
+
+//---- Store the current context pointer (GImGui) in thread local storage, so N threads can each run their own context with SetCurrentContext().
+// A font atlas may be shared by those contexts with ImFontAtlasFlags_SharedAcrossThreads. Not compatible with building Dear ImGui as a DLL: thread_local variables cannot be exported.
+//#define IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+
 //---- Avoid multiple STB libraries implementations, or redefine path/filenames to prioritize another version
 // By default the embedded implementations are declared static and not available outside of Dear ImGui sources files.
 //#define IMGUI_STB_TRUETYPE_FILENAME   "my_folder/stb_truetype.h"
@@ -118,6 +127,10 @@
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
 //#define ImDrawIdx unsigned int
 
+//---- Use compact 12 bytes ImDrawVert (16-bit fixed-point positions, 16-bit normalized UV) instead of 20 bytes, to reduce vertex upload bandwidth.
+// Needs support from your renderer backend (OpenGL3, Vulkan, SDL_GPU, software rasterizer). Read comments above ImDrawVert in imgui.h for limitations.
+//#define IMGUI_USE_COMPACT_DRAWVERT
+
 //---- Override ImDrawCallback signature (will need to modify renderer backends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
@@ -133,6 +146,15 @@
 // (THIS WILL SLOW DOWN DEAR IMGUI. Only use occasionally and disable after use)
 //#define IMGUI_DEBUG_HIGHLIGHT_ALL_ID_CONFLICTS
 
+//---- Debug Tools: Enable built-in frame profiler, recording hierarchical timing zones in hot paths (NewFrame, Begin/End, tables, text rendering, Render).
+// Recording is toggled at runtime in 'Metrics->Profiler', which displays per-zone and per-window timings and can export captures to Chrome trace JSON format.
+// (compiled out by default: when not defined, the profiling macros are empty and there is no runtime cost)
+//#define IMGUI_ENABLE_PROFILER
+
+//---- Debug Tools: Only record allocation statistics (Metrics->Memory allocations) on the thread owning the context, so standalone ImDrawList may grow on worker threads.
+// Costs a thread-local lookup in every MemAlloc()/MemFree(). Not needed with IMGUI_ENABLE_THREAD_LOCAL_CONTEXT, where worker threads have no current context.
+//#define IMGUI_DEBUG_ALLOC_OWNER_THREAD_ONLY
+
 //---- Debug Tools: Enable slower asserts
 //#define IMGUI_DEBUG_PARANOID
 
@@ -95,6 +95,7 @@ CODE
 // [SECTION] LOCALIZATION
 // [SECTION] VIEWPORTS, PLATFORM WINDOWS
 // [SECTION] PLATFORM DEPENDENT HELPERS
+// [SECTION] PROFILER
 // [SECTION] METRICS/DEBUGGER WINDOW
 // [SECTION] DEBUG LOG WINDOW
 // [SECTION] OTHER DEBUG TOOLS (ITEM PICKER, ID STACK TOOL)
@@ -1145,6 +1146,9 @@ IMPLEMENTING SUPPORT for ImGuiBackendFlags_RendererHasTextures:
 // System includes
 #include <stdio.h>      // vsnprintf, sscanf, printf
 #include <stdint.h>     // intptr_t
+#ifdef IMGUI_ENABLE_PROFILER
+#include <chrono>       // std::chrono::steady_clock (only used by the optional profiler)
+#endif
 
 // [Windows] On non-Visual Studio compilers, we default to IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS unless explicitly enabled
 #if defined(_WIN32) && !defined(_MSC_VER) && !defined(IMGUI_ENABLE_WIN32_DEFAULT_IME_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS)
@@ -1256,6 +1260,8 @@ static ImGuiWindow*     CreateNewWindow(const char* name, ImGuiWindowFlags flags
 static ImVec2           CalcNextScrollFromScrollTargetAndClamp(ImGuiWindow* window);
 
 static void             AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window);
+static void             UpdateWindowInHoverGrid(ImGuiWindow* window);
+static void             ClearWindowsHoverGrid();
 
 // Settings
 static void             WindowSettingsHandler_ClearAll(ImGuiContext*, ImGuiSettingsHandler*);
@@ -1293,6 +1299,10 @@ static void             NavUpdateCreateWrappingRequest();
 static void             NavEndFrame();
 static bool             NavScoreItem(ImGuiNavItemData* result, const ImRect& nav_bb);
 static void             NavApplyItemToResult(ImGuiNavItemData* result);
+static bool             NavMoveCandidatesProcessItem(ImGuiID id, ImGuiItemFlags item_flags, const ImRect& nav_bb);
+static void             NavMoveCandidatesBegin(ImGuiWindow* window);
+static void             NavMoveCandidatesFlush();
+static void             NavMoveCandidatesEndFrame();
 static void             NavProcessItem();
 static void             NavProcessItemForTabbingRequest(ImGuiID id, ImGuiItemFlags item_flags, ImGuiNavMoveFlags move_flags);
 static ImGuiInputSource NavCalcPreferredRefPosSource();
@@ -1317,11 +1327,15 @@ static void             UpdateMouseWheel();
 static void             UpdateKeyRoutingTable(ImGuiKeyRoutingTable* rt);
 
 // Misc
+static ImGuiID          CalcStyleHash(const ImGuiStyle* style);
+static ImGuiTextSizeMemoEntry* CalcTextSizeMemoFindSlot(ImU64 key);
+static ImGuiTextSizeMemoEntry* CalcTextSizeMemoGrow(ImU64 key);
 static void             UpdateFontsNewFrame();
 static void             UpdateFontsEndFrame();
 static void             UpdateTexturesNewFrame();
 static void             UpdateTexturesEndFrame();
 static void             UpdateSettings();
+static void             UpdateWantRedrawEndFrame();
 static int              UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& size_auto_fit, int* border_hovered, int* border_held, int resize_grip_count, ImU32 resize_grip_col[4], const ImRect& visibility_rect);
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
 static void             RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar_rect, bool title_bar_is_highlight, bool handle_borders_and_resize_grips, int resize_grip_count, const ImU32 resize_grip_col[4], float resize_grip_draw_size);
@@ -1353,7 +1367,10 @@ static void             UpdateViewportsNewFrame();
 //   Change to a different context by calling ImGui::SetCurrentContext().
 // - Important: Dear ImGui functions are not thread-safe because of this pointer.
 //   If you want thread-safety to allow N threads to access N different contexts:
-//   - Change this variable to use thread local storage so each thread can refer to a different context, in your imconfig.h:
+//   - Enable '#define IMGUI_ENABLE_THREAD_LOCAL_CONTEXT' in your imconfig.h so each thread can refer to a different context.
+//     SetCurrentContext() only affects the calling thread, and ImGui::CreateContext() sets the pointer of the calling thread if it is NULL.
+//     Contexts may share a font atlas if it has ImFontAtlasFlags_SharedAcrossThreads set (see comments there).
+//   - Alternatively, change this variable to use your own thread local storage, in your imconfig.h:
 //         struct ImGuiContext;
 //         extern thread_local ImGuiContext* MyImGuiTLS;
 //         #define GImGui MyImGuiTLS
@@ -1362,8 +1379,24 @@ static void             UpdateViewportsNewFrame();
 //   - If you need a finite number of contexts, you may compile and use multiple instances of the ImGui code from a different namespace.
 // - DLL users: read comments above.
 #ifndef GImGui
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+thread_local ImGuiContext* GImGui = NULL;
+#else
 ImGuiContext*   GImGui = NULL;
 #endif
+#endif
+
+// Debug allocation hooks are not thread-safe: with IMGUI_DEBUG_ALLOC_OWNER_THREAD_ONLY, allocations made on other threads than the one owning the context are not recorded.
+// The address of this thread-local variable identifies the calling thread, see ImGuiDebugAllocInfo::OwnerThread.
+// (not needed with IMGUI_ENABLE_THREAD_LOCAL_CONTEXT, as worker threads have no current context)
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+#ifdef IMGUI_DEBUG_ALLOC_OWNER_THREAD_ONLY
+static thread_local char GImDebugAllocThreadMarker = 0;
+static inline bool DebugAllocIsOwnerThread(ImGuiContext* ctx) { return ctx->DebugAllocInfo.OwnerThread == &GImDebugAllocThreadMarker; }
+#else
+static inline bool DebugAllocIsOwnerThread(ImGuiContext*) { return true; }
+#endif
+#endif
 
 // Memory Allocator functions. Use SetAllocatorFunctions() to change them.
 // - You probably don't want to modify that mid-program, and if you use global/static e.g. ImVector<> instances you may need to keep them accessible during program destruction.
@@ -1550,6 +1583,7 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsCopyContentsWithCtrlC = false;
     ConfigScrollbarScrollByPage = true;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigDamageTracking = false;
     ConfigDebugIsDebuggerPresent = false;
     ConfigDebugHighlightIdConflicts = true;
     ConfigDebugHighlightIdConflictsShowItemPicker = true;
@@ -1580,6 +1614,9 @@ ImGuiIO::ImGuiIO()
     for (int i = 0; i < IM_ARRAYSIZE(MouseDownDuration); i++) MouseDownDuration[i] = MouseDownDurationPrev[i] = -1.0f;
     for (int i = 0; i < IM_ARRAYSIZE(KeysData); i++) { KeysData[i].DownDuration = KeysData[i].DownDurationPrev = -1.0f; }
     AppAcceptingEvents = true;
+
+    // Output
+    WantRedraw = true;
 }
 
 // Pass in translated ASCII characters for text input.
@@ -1649,12 +1686,16 @@ void ImGuiIO::AddInputCharactersUTF8(const char* utf8_chars)
     }
 }
 
+static bool PopPostedInputEvent(ImGuiContext* ctx, ImGuiInputEventPosted* out_event);
+
 // Clear all incoming events.
 void ImGuiIO::ClearEventsQueue()
 {
     IM_ASSERT(Ctx != NULL);
     ImGuiContext& g = *Ctx;
     g.InputEventsQueue.clear();
+    ImGuiInputEventPosted e;
+    while (PopPostedInputEvent(&g, &e)) {}
 }
 
 // Clear current keyboard/gamepad state + current frame text input buffer. Equivalent to releasing all keys/buttons.
@@ -1915,6 +1956,84 @@ void ImGuiIO::AddFocusEvent(bool focused)
     g.InputEventsQueue.push_back(e);
 }
 
+// Thread-safe input events: io.PostXXX() functions may be called from any thread.
+// This is a bounded multiple-producers single-consumer queue (Dmitry Vyukov's algorithm), see ImGuiInputEventsPostQueue.
+static bool PostInputEvent(ImGuiContext* ctx, ImGuiInputEventType type, int arg, bool down, float x, float y)
+{
+    IM_ASSERT(ctx != NULL);
+    ImGuiContext& g = *ctx;
+    ImGuiInputEventsPostQueue* q = (ImGuiInputEventsPostQueue*)ImAtomicLoadPtr((void* volatile*)&g.InputEventsPostQueue);
+    if (q == NULL)
+    {
+        // Allocate on first use, bypassing MemAlloc() which records allocations into the context of calling thread.
+        // If another thread allocated concurrently, use theirs.
+        ImGuiInputEventsPostQueue* new_q = (ImGuiInputEventsPostQueue*)(*GImAllocatorAllocFunc)(sizeof(ImGuiInputEventsPostQueue), GImAllocatorUserData);
+        memset(new_q, 0, sizeof(*new_q));
+        for (ImU32 n = 0; n < IMGUI_INPUT_EVENTS_POSTED_CAPACITY; n++)
+            new_q->Slots[n].Sequence = n;
+        if (ImAtomicCompareExchangePtr((void* volatile*)&g.InputEventsPostQueue, NULL, new_q))
+        {
+            q = new_q;
+        }
+        else
+        {
+            (*GImAllocatorFreeFunc)(new_q, GImAllocatorUserData);
+            q = (ImGuiInputEventsPostQueue*)ImAtomicLoadPtr((void* volatile*)&g.InputEventsPostQueue);
+        }
+    }
+
+    // Reserve a slot: it is free when its sequence number matches our position.
+    ImU32 pos = ImAtomicLoad(&q->EnqueuePos);
+    ImGuiInputEventPosted* slot;
+    while (true)
+    {
+        slot = &q->Slots[pos & (IMGUI_INPUT_EVENTS_POSTED_CAPACITY - 1)];
+        const int diff = (int)(ImAtomicLoad(&slot->Sequence) - pos);
+        if (diff == 0 && ImAtomicCompareExchange(&q->EnqueuePos, pos, pos + 1))
+            break;
+        if (diff < 0) // Slot still holds an event from previous lap: queue is full.
+        {
+            ImAtomicAdd(&q->DroppedCount, 1);
+            return false;
+        }
+        pos = ImAtomicLoad(&q->EnqueuePos);
+    }
+
+    // Write and publish
+    slot->Type = type;
+    slot->Arg = arg;
+    slot->Down = down;
+    slot->X = x;
+    slot->Y = y;
+    ImAtomicStore(&slot->Sequence, pos + 1);
+    return true;
+}
+
+// Consumer side, called by NewFrame()
+static bool PopPostedInputEvent(ImGuiContext* ctx, ImGuiInputEventPosted* out_event)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiInputEventsPostQueue* q = (ImGuiInputEventsPostQueue*)ImAtomicLoadPtr((void* volatile*)&g.InputEventsPostQueue);
+    if (q == NULL)
+        return false;
+    ImGuiInputEventPosted* slot = &q->Slots[q->DequeuePos & (IMGUI_INPUT_EVENTS_POSTED_CAPACITY - 1)];
+    if (ImAtomicLoad(&slot->Sequence) != q->DequeuePos + 1)
+        return false;
+    *out_event = *slot;
+    ImAtomicStore(&slot->Sequence, q->DequeuePos + IMGUI_INPUT_EVENTS_POSTED_CAPACITY); // Free for next lap
+    q->DequeuePos++;
+    return true;
+}
+
+bool ImGuiIO::PostKeyEvent(ImGuiKey key, bool down)                 { return PostInputEvent(Ctx, ImGuiInputEventType_Key, (int)key, down, down ? 1.0f : 0.0f, 0.0f); }
+bool ImGuiIO::PostKeyAnalogEvent(ImGuiKey key, bool down, float v)  { return PostInputEvent(Ctx, ImGuiInputEventType_Key, (int)key, down, v, 0.0f); }
+bool ImGuiIO::PostMousePosEvent(float x, float y)                   { return PostInputEvent(Ctx, ImGuiInputEventType_MousePos, 0, false, x, y); }
+bool ImGuiIO::PostMouseButtonEvent(int button, bool down)           { return PostInputEvent(Ctx, ImGuiInputEventType_MouseButton, button, down, 0.0f, 0.0f); }
+bool ImGuiIO::PostMouseWheelEvent(float wheel_x, float wheel_y)     { return PostInputEvent(Ctx, ImGuiInputEventType_MouseWheel, 0, false, wheel_x, wheel_y); }
+bool ImGuiIO::PostMouseSourceEvent(ImGuiMouseSource source)         { return PostInputEvent(Ctx, ImGuiInputEventType_None, (int)source, false, 0.0f, 0.0f); }
+bool ImGuiIO::PostFocusEvent(bool focused)                          { return PostInputEvent(Ctx, ImGuiInputEventType_Focus, 0, focused, 0.0f, 0.0f); }
+bool ImGuiIO::PostInputCharacter(unsigned int c)                    { return PostInputEvent(Ctx, ImGuiInputEventType_Text, (int)c, false, 0.0f, 0.0f); }
+
 ImGuiPlatformIO::ImGuiPlatformIO()
 {
     // Most fields are initialized with zero
@@ -2343,6 +2462,34 @@ ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
 #endif
 }
 
+// Known size hash, processing 8 bytes at a time
+// Much faster than ImHashData() on long data, used where the hash doesn't need to match ImHashData() (e.g. memoizing text measurement).
+ImU64 ImHashData64(const void* data_p, size_t data_size, ImU64 seed)
+{
+    const ImU64 k = 0x9E3779B97F4A7C15ULL;
+    const unsigned char* data = (const unsigned char*)data_p;
+    ImU64 h = (seed ^ data_size) * k;
+    for (; data_size >= 8; data += 8, data_size -= 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        h = (h ^ v) * k;
+        h ^= h >> 29;
+    }
+    if (data_size > 0)
+    {
+        // Fixed size copies for the remaining 1-7 bytes: compilers emit a call to memcpy() for variable sizes.
+        ImU64 v = 0;
+        int shift = 0;
+        if (data_size & 4) { ImU32 v4; memcpy(&v4, data, 4); v = v4; data += 4; shift = 32; }
+        if (data_size & 2) { ImU16 v2; memcpy(&v2, data, 2); v |= (ImU64)v2 << shift; data += 2; shift += 16; }
+        if (data_size & 1) { v |= (ImU64)*data << shift; }
+        h = (h ^ v) * k;
+        h ^= h >> 29;
+    }
+    return h;
+}
+
 // Zero-terminated string hash, with support for ### to reset back to seed value
 // We support a syntax of "label###id" where only "###id" is included in the hash, and only "label" gets displayed.
 // Because this syntax is rarely used we are optimizing for the common case.
@@ -2670,6 +2817,37 @@ int ImTextCountLines(const char* in_text, const char* in_text_end)
     return count;
 }
 
+// Used by text measurement to process runs of ASCII characters without decoding UTF-8 nor checking for line breaks.
+// - Check 16 bytes at a time with SSE2/NEON, or 8 bytes at a time otherwise, then locate the first non-matching byte one byte at a time.
+const char* ImTextSkipPrintableAscii(const char* in_text, const char* in_text_end)
+{
+    const char* s = in_text;
+#if defined(IMGUI_ENABLE_SSE2)
+    const __m128i v_space = _mm_set1_epi8(0x20);
+    for (; in_text_end - s >= 16; s += 16)
+        if (_mm_movemask_epi8(_mm_cmplt_epi8(_mm_loadu_si128((const __m128i*)(const void*)s), v_space)) != 0) // Signed comparison: also true for bytes >= 0x80
+            break;
+#elif defined(IMGUI_ENABLE_NEON)
+    const int8x16_t v_space = vdupq_n_s8(0x20);
+    for (; in_text_end - s >= 16; s += 16)
+        if (vmaxvq_u8(vcltq_s8(vld1q_s8((const int8_t*)(const void*)s), v_space)) != 0) // Signed comparison: also true for bytes >= 0x80
+            break;
+#else
+    // Bytes < 0x20 borrow when subtracting 0x20 and set their high bit (borrows may also flag following bytes, which is harmless here).
+    const ImU64 k20 = 0x2020202020202020ULL, k80 = 0x8080808080808080ULL;
+    for (; in_text_end - s >= 8; s += 8)
+    {
+        ImU64 v;
+        memcpy(&v, s, 8);
+        if (((v - k20) | v) & k80)
+            break;
+    }
+#endif
+    while (s < in_text_end && (unsigned int)((unsigned char)*s - 0x20) < 0x60)
+        s++;
+    return s;
+}
+
 IM_MSVC_RUNTIME_CHECKS_RESTORE
 
 //-----------------------------------------------------------------------------
@@ -2792,18 +2970,92 @@ static int IMGUI_CDECL PairComparerByID(const void* lhs, const void* rhs)
     return (lhs_v > rhs_v ? +1 : lhs_v < rhs_v ? -1 : 0);
 }
 
+#ifdef IMGUI_ENABLE_STORAGE_HASHMAP
+// Hash index: open-addressing with linear probing, storing (index + 1) into Data, max load factor 0.5.
+// Keys are often already hashes (ImGuiID) but may also be small sequential values (e.g. codepoints in ImFont::RemapPairs), so we mix them.
+static inline ImU32 ImGuiStorage_HashKey(ImGuiID key)
+{
+    ImU32 h = key * 0x9E3779B1u;
+    return h ^ (h >> 15);
+}
+
+static void ImGuiStorage_RebuildHashIndex(ImGuiStorage* storage)
+{
+    int capacity = 16;
+    while (capacity < storage->Data.Size * 2)
+        capacity <<= 1;
+    storage->HashIndex.resize(capacity);
+    memset(storage->HashIndex.Data, 0, (size_t)capacity * sizeof(int));
+    const ImU32 mask = (ImU32)capacity - 1;
+    for (int n = 0; n < storage->Data.Size; n++)
+    {
+        ImU32 slot = ImGuiStorage_HashKey(storage->Data.Data[n].key) & mask;
+        while (storage->HashIndex.Data[slot] != 0)
+            slot = (slot + 1) & mask;
+        storage->HashIndex.Data[slot] = n + 1;
+    }
+    storage->HashIndexCount = storage->Data.Size;
+}
+
+static ImGuiStoragePair* ImGuiStorage_FindPair(const ImGuiStorage* storage_const, ImGuiID key)
+{
+    ImGuiStorage* storage = const_cast<ImGuiStorage*>(storage_const); // Index is lazily rebuilt, which is not a logical change of the storage.
+    if (storage->Data.Size == 0)
+        return NULL;
+    if (storage->HashIndexCount != storage->Data.Size)
+        ImGuiStorage_RebuildHashIndex(storage);
+    const ImU32 mask = (ImU32)storage->HashIndex.Size - 1;
+    for (ImU32 slot = ImGuiStorage_HashKey(key) & mask; ; slot = (slot + 1) & mask)
+    {
+        const int idx = storage->HashIndex.Data[slot];
+        if (idx == 0)
+            return NULL;
+        if (storage->Data.Data[idx - 1].key == key)
+            return &storage->Data.Data[idx - 1];
+    }
+}
+
+// Caller is expected to have called ImGuiStorage_FindPair() first, so the index is up to date and the key is not already present.
+static ImGuiStoragePair* ImGuiStorage_AddPair(ImGuiStorage* storage, const ImGuiStoragePair& pair)
+{
+    storage->Data.push_back(pair);
+    if (storage->Data.Size * 2 > storage->HashIndex.Size || storage->HashIndexCount + 1 != storage->Data.Size)
+    {
+        ImGuiStorage_RebuildHashIndex(storage);
+    }
+    else
+    {
+        const ImU32 mask = (ImU32)storage->HashIndex.Size - 1;
+        ImU32 slot = ImGuiStorage_HashKey(pair.key) & mask;
+        while (storage->HashIndex.Data[slot] != 0)
+            slot = (slot + 1) & mask;
+        storage->HashIndex.Data[slot] = storage->Data.Size;
+        storage->HashIndexCount++;
+    }
+    return &storage->Data.back();
+}
+#endif // #ifdef IMGUI_ENABLE_STORAGE_HASHMAP
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
     ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), PairComparerByID);
+#ifdef IMGUI_ENABLE_STORAGE_HASHMAP
+    ImGuiStorage_RebuildHashIndex(this);
+#endif
 }
 
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
+#ifdef IMGUI_ENABLE_STORAGE_HASHMAP
+    ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key);
+    return it ? it->val_i : default_val;
+#else
     ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
     if (it == Data.Data + Data.Size || it->key != key)
         return default_val;
     return it->val_i;
+#endif
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -2813,26 +3065,42 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
+#ifdef IMGUI_ENABLE_STORAGE_HASHMAP
+    ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key);
+    return it ? it->val_f : default_val;
+#else
     ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
     if (it == Data.Data + Data.Size || it->key != key)
         return default_val;
     return it->val_f;
+#endif
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
+#ifdef IMGUI_ENABLE_STORAGE_HASHMAP
+    ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key);
+    return it ? it->val_p : NULL;
+#else
     ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
     if (it == Data.Data + Data.Size || it->key != key)
         return NULL;
     return it->val_p;
+#endif
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
+#ifdef IMGUI_ENABLE_STORAGE_HASHMAP
+    ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key);
+    if (it == NULL)
+        it = ImGuiStorage_AddPair(this, ImGuiStoragePair(key, default_val));
+#else
     ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
     if (it == Data.Data + Data.Size || it->key != key)
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
+#endif
     return &it->val_i;
 }
 
@@ -2843,28 +3111,47 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
+#ifdef IMGUI_ENABLE_STORAGE_HASHMAP
+    ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key);
+    if (it == NULL)
+        it = ImGuiStorage_AddPair(this, ImGuiStoragePair(key, default_val));
+#else
     ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
     if (it == Data.Data + Data.Size || it->key != key)
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
+#endif
     return &it->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
+#ifdef IMGUI_ENABLE_STORAGE_HASHMAP
+    ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key);
+    if (it == NULL)
+        it = ImGuiStorage_AddPair(this, ImGuiStoragePair(key, default_val));
+#else
     ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
     if (it == Data.Data + Data.Size || it->key != key)
         it = Data.insert(it, ImGuiStoragePair(key, default_val));
+#endif
     return &it->val_p;
 }
 
 // FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
+#ifdef IMGUI_ENABLE_STORAGE_HASHMAP
+    if (ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key))
+        it->val_i = val;
+    else
+        ImGuiStorage_AddPair(this, ImGuiStoragePair(key, val));
+#else
     ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
     if (it == Data.Data + Data.Size || it->key != key)
         Data.insert(it, ImGuiStoragePair(key, val));
     else
         it->val_i = val;
+#endif
 }
 
 void ImGuiStorage::SetBool(ImGuiID key, bool val)
@@ -2874,20 +3161,34 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
+#ifdef IMGUI_ENABLE_STORAGE_HASHMAP
+    if (ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key))
+        it->val_f = val;
+    else
+        ImGuiStorage_AddPair(this, ImGuiStoragePair(key, val));
+#else
     ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
     if (it == Data.Data + Data.Size || it->key != key)
         Data.insert(it, ImGuiStoragePair(key, val));
     else
         it->val_f = val;
+#endif
 }
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
+#ifdef IMGUI_ENABLE_STORAGE_HASHMAP
+    if (ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key))
+        it->val_p = val;
+    else
+        ImGuiStorage_AddPair(this, ImGuiStoragePair(key, val));
+#else
     ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
     if (it == Data.Data + Data.Size || it->key != key)
         Data.insert(it, ImGuiStoragePair(key, val));
     else
         it->val_p = val;
+#endif
 }
 
 void ImGuiStorage::SetAllInt(int v)
@@ -3700,6 +4001,7 @@ const char* ImGui::FindRenderedTextEnd(const char* text, const char* text_end)
 // RenderText***() functions calls ImDrawList::AddText() calls ImBitmapFont::RenderText()
 void ImGui::RenderText(ImVec2 pos, const char* text, const char* text_end, bool hide_text_after_hash)
 {
+    IMGUI_PROFILER_SCOPE("RenderText");
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = g.CurrentWindow;
 
@@ -3726,6 +4028,7 @@ void ImGui::RenderText(ImVec2 pos, const char* text, const char* text_end, bool
 
 void ImGui::RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end, float wrap_width)
 {
+    IMGUI_PROFILER_SCOPE("RenderText");
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = g.CurrentWindow;
 
@@ -3747,6 +4050,7 @@ void ImGui::RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end
 // better advantage of the render function taking size into account for coarse clipping.
 void ImGui::RenderTextClippedEx(ImDrawList* draw_list, const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_display_end, const ImVec2* text_size_if_known, const ImVec2& align, const ImRect* clip_rect)
 {
+    IMGUI_PROFILER_SCOPE("RenderText");
     // Perform CPU side clipping for single clipped element to avoid using scissor state
     ImVec2 pos = pos_min;
     const ImVec2 text_size = text_size_if_known ? *text_size_if_known : CalcTextSize(text, text_display_end, false, 0.0f);
@@ -4016,6 +4320,7 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     Initialized = false;
     Font = NULL;
     FontBaked = NULL;
+    StyleHash = 0;
     FontSize = FontSizeBase = FontBakedScale = CurrentDpiScale = 0.0f;
     FontRasterizerDensity = 1.0f;
     IO.Fonts = shared_font_atlas ? shared_font_atlas : IM_NEW(ImFontAtlas)();
@@ -4033,9 +4338,13 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
 
     InputEventsNextMouseSource = ImGuiMouseSource_Mouse;
     InputEventsNextEventId = 1;
+    InputEventsPostQueue = NULL;
 
     WindowsActiveCount = 0;
     WindowsBorderHoverPadding = 0.0f;
+    WindowsHoverGridGeneration = 1;
+    WindowsHoverGridValidFrame = 0;
+    WindowsHoverGridReady = false;
     CurrentWindow = NULL;
     HoveredWindow = NULL;
     HoveredWindowUnderMovingWindow = NULL;
@@ -4157,7 +4466,6 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     MouseCursor = ImGuiMouseCursor_Arrow;
     MouseStationaryTimer = 0.0f;
 
-    InputTextPasswordFontBackupFlags = ImFontFlags_None;
     TempInputId = 0;
     memset(&DataTypeZeroValue, 0, sizeof(DataTypeZeroValue));
     BeginMenuDepth = BeginComboDepth = 0;
@@ -4230,12 +4538,20 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     FramerateSecPerFrameAccum = 0.0f;
     WantCaptureMouseNextFrame = WantCaptureKeyboardNextFrame = WantTextInputNextFrame = -1;
     memset(TempKeychordName, 0, sizeof(TempKeychordName));
+    WantRedrawDelay = FLT_MAX;
+    WantRedrawDebugReason = WantRedrawDebugReasonLastFrame = NULL;
+    WantRedrawFramesAfterInputs = 2;
+    TextSizeMemoCount = TextSizeMemoLastClearFrame = 0;
+    TextSizeMemoHits = TextSizeMemoMisses = TextSizeMemoHitsLastFrame = TextSizeMemoMissesLastFrame = 0;
 }
 
 void ImGui::Initialize()
 {
     ImGuiContext& g = *GImGui;
     IM_ASSERT(!g.Initialized && !g.SettingsLoaded);
+#if !defined(IMGUI_DISABLE_DEBUG_TOOLS) && defined(IMGUI_DEBUG_ALLOC_OWNER_THREAD_ONLY)
+    g.DebugAllocInfo.OwnerThread = &GImDebugAllocThreadMarker;
+#endif
 
     // Add .ini handle for ImGuiWindow and ImGuiTable types
     {
@@ -4309,7 +4625,13 @@ void ImGui::Shutdown()
             IM_DELETE(atlas);
         }
     }
-    g.DrawListSharedData.TempBuffer.clear();
+
+    // Allocated directly with allocator functions (see PostInputEvent())
+    if (g.InputEventsPostQueue != NULL)
+    {
+        (*GImAllocatorFreeFunc)(g.InputEventsPostQueue, GImAllocatorUserData);
+        g.InputEventsPostQueue = NULL;
+    }
 
     // Cleanup of other data are conditional on actually having initialized Dear ImGui.
     if (!g.Initialized)
@@ -4325,6 +4647,7 @@ void ImGui::Shutdown()
     g.Windows.clear_delete();
     g.WindowsFocusOrder.clear();
     g.WindowsTempSortBuffer.clear();
+    ClearWindowsHoverGrid();
     g.CurrentWindow = NULL;
     g.CurrentWindowStack.clear();
     g.WindowsById.Clear();
@@ -4477,6 +4800,13 @@ void ImGui::GcCompactTransientMiscBuffers()
     g.GroupStack.clear();
     g.MultiSelectTempDataStacked = 0;
     g.MultiSelectTempData.clear_destruct();
+    g.TextSizeMemo.clear();
+    g.TextSizeMemoCount = 0;
+    ClearWindowsHoverGrid();
+    g.NavMoveCandidates.Items.clear();
+    g.NavMoveCandidates.ItemsNext.clear();
+    g.NavMoveCandidates.SortedByMinY.clear();
+    g.NavMoveCandidates.WindowID = 0;
     TableGcCompactSettings();
     for (ImFontAtlas* atlas : g.FontAtlases)
         atlas->CompactCache();
@@ -4751,10 +5081,16 @@ bool ImGui::IsItemHovered(ImGuiHoveredFlags flags)
         // but once unlocked on a given item we also moving.
         //if (g.HoverDelayTimer >= delay && (g.HoverDelayTimer - g.IO.DeltaTime < delay || g.MouseStationaryTimer - g.IO.DeltaTime < g.Style.HoverStationaryDelay)) { IMGUI_DEBUG_LOG("HoverDelayTimer = %f/%f, MouseStationaryTimer = %f\n", g.HoverDelayTimer, delay, g.MouseStationaryTimer); }
         if ((flags & ImGuiHoveredFlags_Stationary) != 0 && g.HoverItemUnlockedStationaryId != hover_delay_id)
+        {
+            RequestRedrawEx(g.Style.HoverStationaryDelay - g.MouseStationaryTimer, "Hover stationary delay");
             return false;
+        }
 
         if (g.HoverItemDelayTimer < delay)
+        {
+            RequestRedrawEx(delay - g.HoverItemDelayTimer, "Hover delay");
             return false;
+        }
     }
 
     return true;
@@ -4923,7 +5259,8 @@ void* ImGui::MemAlloc(size_t size)
     void* ptr = (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     if (ImGuiContext* ctx = GImGui)
-        DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, size);
+        if (DebugAllocIsOwnerThread(ctx))
+            DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, size);
 #endif
     return ptr;
 }
@@ -4934,7 +5271,8 @@ void ImGui::MemFree(void* ptr)
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     if (ptr != NULL)
         if (ImGuiContext* ctx = GImGui)
-            DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, (size_t)-1);
+            if (DebugAllocIsOwnerThread(ctx))
+                DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, (size_t)-1);
 #endif
     return (*GImAllocatorFreeFunc)(ptr, GImAllocatorUserData);
 }
@@ -5027,6 +5365,29 @@ int ImGui::GetFrameCount()
     return GImGui->FrameCount;
 }
 
+void ImGui::RequestRedraw(float delay)
+{
+    RequestRedrawEx(delay, "RequestRedraw()");
+}
+
+// Keep the smallest requested delay. Reflected in io.WantRedraw/io.WantRedrawTimeout by EndFrame().
+// When called between frames, also update the last output so the application doesn't go idle.
+void ImGui::RequestRedrawEx(float delay, const char* debug_reason)
+{
+    ImGuiContext& g = *GImGui;
+    delay = ImMax(delay, 0.0f);
+    if (delay < g.WantRedrawDelay)
+    {
+        g.WantRedrawDelay = delay;
+        g.WantRedrawDebugReason = debug_reason;
+    }
+    if (!g.WithinFrameScope && delay < g.IO.WantRedrawTimeout)
+    {
+        g.IO.WantRedraw = (delay <= 0.0f);
+        g.IO.WantRedrawTimeout = delay;
+    }
+}
+
 static ImDrawList* GetViewportBgFgDrawList(ImGuiViewportP* viewport, size_t drawlist_no, const char* drawlist_name)
 {
     // Create the draw list on demand, because they are not frequently used for all viewports
@@ -5331,6 +5692,13 @@ void ImGui::NewFrame()
 {
     IM_ASSERT(GImGui != NULL && "No current context. Did you call ImGui::CreateContext() and ImGui::SetCurrentContext() ?");
     ImGuiContext& g = *GImGui;
+#if !defined(IMGUI_DISABLE_DEBUG_TOOLS) && defined(IMGUI_DEBUG_ALLOC_OWNER_THREAD_ONLY)
+    g.DebugAllocInfo.OwnerThread = &GImDebugAllocThreadMarker; // Context may be moved to another thread between frames
+#endif
+#ifdef IMGUI_ENABLE_PROFILER
+    ProfilerNewFrame();
+#endif
+    IMGUI_PROFILER_SCOPE("NewFrame");
 
     // Remove pending delete hooks before frame start.
     // This deferred removal avoid issues of removal while iterating the hook vector
@@ -5361,8 +5729,13 @@ void ImGui::NewFrame()
 
     // Process input queue (trickle as many events as possible), turn events into writes to IO structure
     g.InputEventsTrail.resize(0);
+    UpdateInputEventsPosted();
     UpdateInputEvents(g.IO.ConfigInputTrickleEventQueue);
 
+    // Keep running a few frames after processing inputs or display changes, so their effects can settle (see io.WantRedraw)
+    if (g.InputEventsTrail.Size > 0 || g.IO.MousePos != g.IO.MousePosPrev || g.IO.DisplaySize != g.Viewports[0]->Size || g.IO.DisplayFramebufferScale != g.Viewports[0]->FramebufferScale)
+        g.WantRedrawFramesAfterInputs = 2;
+
     // Update viewports (after processing input queue, so io.MouseHoveredViewport is set)
     UpdateViewportsNewFrame();
 
@@ -5372,6 +5745,9 @@ void ImGui::NewFrame()
     // Setup current font and draw list shared data
     SetupDrawListSharedData();
     UpdateFontsNewFrame();
+    g.TextSizeMemoHitsLastFrame = g.TextSizeMemoHits;
+    g.TextSizeMemoMissesLastFrame = g.TextSizeMemoMisses;
+    g.TextSizeMemoHits = g.TextSizeMemoMisses = 0;
 
     g.WithinFrameScope = true;
 
@@ -5491,8 +5867,10 @@ void ImGui::NewFrame()
     // Mark all windows as not visible and compact unused memory.
     IM_ASSERT(g.WindowsFocusOrder.Size <= g.Windows.Size);
     const float memory_compact_start_time = (g.GcCompactAll || g.IO.ConfigMemoryCompactTimer < 0.0f) ? FLT_MAX : (float)g.Time - g.IO.ConfigMemoryCompactTimer;
+    int display_order = 0;
     for (ImGuiWindow* window : g.Windows)
     {
+        window->DisplayOrder = display_order++;
         window->WasActive = window->Active;
         window->Active = false;
         window->WriteAccessed = false;
@@ -5507,7 +5885,21 @@ void ImGui::NewFrame()
     // Find hovered window
     // (needs to be before UpdateMouseMovingWindowNewFrame so we fill g.HoveredWindowUnderMovingWindow on the mouse release frame)
     // (currently needs to be done after the WasActive=Active loop and FindHoveredWindowEx uses ->Active)
+    // (can use the hover grid if all windows submitted during last frame have been added to it)
+    g.WindowsHoverGridReady = (g.FrameCount >= g.WindowsHoverGridValidFrame);
     UpdateHoveredWindowAndCaptureFlags(g.IO.MousePos);
+    g.WindowsHoverGridReady = false;
+
+    // Clear hover grid when its layout changes (e.g. display size)
+    const ImRect hover_grid_rect = g.Viewports[0]->GetMainRect();
+    const ImVec2 hover_grid_padding = ImMax(g.Style.TouchExtraPadding, ImVec2(g.Style.WindowBorderHoverPadding, g.Style.WindowBorderHoverPadding));
+    if (hover_grid_rect.Min != g.WindowsHoverGridRect.Min || hover_grid_rect.Max != g.WindowsHoverGridRect.Max || hover_grid_padding != g.WindowsHoverGridPadding)
+    {
+        ClearWindowsHoverGrid();
+        g.WindowsHoverGridRect = hover_grid_rect;
+        g.WindowsHoverGridPadding = hover_grid_padding;
+        g.WindowsHoverGridValidFrame = g.FrameCount + 1;
+    }
 
     // Handle user moving window with mouse (at the beginning of the frame to avoid input lag or sheering)
     UpdateMouseMovingWindowNewFrame();
@@ -5570,6 +5962,9 @@ void ImGui::NewFrame()
     }
 #endif
 
+    // Hash style once per frame for retained windows (rather than on every Begin() call)
+    g.StyleHash = CalcStyleHash(&g.Style);
+
     // Create implicit/fallback window - which we will only render it if the user has added something to it.
     // We don't use "Debug" to avoid colliding with user trying to create a "Debug" window with custom flags.
     // This fallback is particularly important as it prevents ImGui:: calls from crashing.
@@ -5682,6 +6077,8 @@ static void InitViewportDrawData(ImGuiViewportP* viewport)
     draw_data->FramebufferScale = io.DisplayFramebufferScale;
     draw_data->OwnerViewport = viewport;
     draw_data->Textures = &ImGui::GetPlatformIO().Textures;
+    draw_data->DamageTracked = false;
+    draw_data->DamageRects.resize(0);
 }
 
 // Push a clipping rectangle for both ImGui logic (hit-testing etc.) and low-level ImDrawList rendering.
@@ -5788,6 +6185,78 @@ static void ImGui::RenderDimmedBackgrounds()
     }
 }
 
+// Gather remaining reasons for processing another frame without new inputs, and output them to io.WantRedraw/io.WantRedrawTimeout.
+// Windows, popups and widgets with transient state also call RequestRedrawEx() while being submitted.
+static void ImGui::UpdateWantRedrawEndFrame()
+{
+    ImGuiContext& g = *GImGui;
+    if (g.InputEventsQueue.Size > 0)
+        RequestRedrawEx(0.0f, "Input queue");
+    if (ImGuiInputEventsPostQueue* post_queue = (ImGuiInputEventsPostQueue*)ImAtomicLoadPtr((void* volatile*)&g.InputEventsPostQueue))
+        if (ImAtomicLoad(&post_queue->EnqueuePos) != post_queue->DequeuePos)
+            RequestRedrawEx(0.0f, "Posted input queue");
+    if (g.WantRedrawFramesAfterInputs > 0)
+    {
+        g.WantRedrawFramesAfterInputs--;
+        RequestRedrawEx(0.0f, "Inputs");
+    }
+
+    // Held mouse buttons and keys (dragging, key repeat, etc.)
+    if (IsAnyMouseDown())
+        RequestRedrawEx(0.0f, "Mouse button down");
+    for (ImGuiKey key = ImGuiKey_NamedKey_BEGIN; key < ImGuiKey_Aliases_BEGIN; key = (ImGuiKey)(key + 1))
+        if (!IsLRModKey(key) && GetKeyData(key)->Down)
+        {
+            RequestRedrawEx(0.0f, "Key down");
+            break;
+        }
+
+    // Active item, drag and drop, hover timers (an active InputText() requests its own cursor blink timing)
+    if (g.ActiveId != 0 && g.ActiveId != g.InputTextState.ID)
+        RequestRedrawEx(0.0f, "ActiveId");
+    if (g.DragDropActive)
+        RequestRedrawEx(0.0f, "Drag and drop");
+    if (g.HoveredId != 0 && g.HoveredIdTimer < 1.0f) // Menu open delay, separator and tab hover feedback
+        RequestRedrawEx(0.0f, "HoveredId timer");
+
+    // Navigation
+    if (g.NavAnyRequest || g.NavInitRequest || g.NavMoveSubmitted || g.NavMoveForwardToNextFrame || g.NavNextActivateId != 0)
+        RequestRedrawEx(0.0f, "Nav request");
+    if (g.NavWindowingTarget != NULL || g.NavWindowingHighlightAlpha > 0.0f)
+        RequestRedrawEx(0.0f, "Nav windowing");
+    if (g.NavHighlightActivatedTimer > 0.0f)
+        RequestRedrawEx(g.NavHighlightActivatedTimer, "Nav activated highlight");
+
+    // Animations
+    const float dim_bg_ratio_target = (GetTopMostPopupModal() != NULL || (g.NavWindowingTarget != NULL && g.NavWindowingHighlightAlpha > 0.0f)) ? 1.0f : 0.0f;
+    if (g.DimBgRatio != dim_bg_ratio_target)
+        RequestRedrawEx(0.0f, "Dim background");
+    if (g.DebugFlashStyleColorTime > 0.0f)
+        RequestRedrawEx(0.0f, "Debug flash color");
+    for (ImGuiViewportP* viewport : g.Viewports)
+        if (viewport->BuildWorkInsetMin != viewport->WorkInsetMin || viewport->BuildWorkInsetMax != viewport->WorkInsetMax)
+            RequestRedrawEx(0.0f, "Viewport work area");
+
+    // Glyphs queued or being rasterized are committed by a next frame (ImFontAtlasFlags_AsyncGlyphLoading)
+    for (ImFontAtlas* atlas : g.FontAtlases)
+        if (ImFontAtlasBuilder* builder = atlas->Builder)
+            if (builder->AsyncTaskRunning || builder->AsyncGlyphsQueued.Size > 0 || builder->AsyncGlyphsRunning.Size > 0)
+            {
+                RequestRedrawEx(0.0f, "Async glyphs");
+                break;
+            }
+
+    // Delayed .ini saving
+    if (g.SettingsDirtyTimer > 0.0f)
+        RequestRedrawEx(g.SettingsDirtyTimer, "Settings saving");
+
+    g.IO.WantRedraw = (g.WantRedrawDelay <= 0.0f);
+    g.IO.WantRedrawTimeout = g.WantRedrawDelay;
+    g.WantRedrawDebugReasonLastFrame = g.WantRedrawDebugReason;
+    g.WantRedrawDelay = FLT_MAX;
+    g.WantRedrawDebugReason = NULL;
+}
+
 // This is normally called by Render(). You may want to call it directly if you want to avoid calling Render() but the gain will be very minimal.
 void ImGui::EndFrame()
 {
@@ -5802,6 +6271,7 @@ void ImGui::EndFrame()
         IM_ASSERT_USER_ERROR(g.WithinFrameScope, "Forgot to call ImGui::NewFrame()?");
         return;
     }
+    IMGUI_PROFILER_SCOPE("EndFrame");
 
     CallContextHooks(&g, ImGuiContextHookType_EndFramePre);
 
@@ -5852,6 +6322,9 @@ void ImGui::EndFrame()
         g.DragDropWithinSource = false;
     }
 
+    // Output io.WantRedraw/io.WantRedrawTimeout
+    UpdateWantRedrawEndFrame();
+
     // End frame
     g.WithinFrameScope = false;
     g.FrameCountEnded = g.FrameCount;
@@ -5879,8 +6352,9 @@ void ImGui::EndFrame()
     UpdateTexturesEndFrame();
 
     // Unlock font atlas
-    for (ImFontAtlas* atlas : g.FontAtlases)
-        atlas->Locked = false;
+    if ((g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures) == 0)
+        for (ImFontAtlas* atlas : g.FontAtlases)
+            atlas->Locked = false;
 
     // Clear Input data for next frame
     g.IO.MousePosPrev = g.IO.MousePos;
@@ -5904,6 +6378,7 @@ void ImGui::Render()
     if (g.FrameCountRendered == g.FrameCount)
         return;
     g.FrameCountRendered = g.FrameCount;
+    IMGUI_PROFILER_SCOPE("Render");
 
     g.IO.MetricsRenderWindows = 0;
     CallContextHooks(&g, ImGuiContextHookType_RenderPre);
@@ -5953,6 +6428,12 @@ void ImGui::Render()
         for (ImDrawList* draw_list : draw_data->CmdLists)
             draw_list->_PopUnusedDrawCmd();
 
+        // Compare with last frame to output damaged regions
+        if (g.IO.ConfigDamageTracking)
+            viewport->DamageTracker.Update(draw_data);
+        else if (viewport->DamageTracker.HasLastFrame)
+            viewport->DamageTracker.Clear();
+
         g.IO.MetricsRenderVertices += draw_data->TotalVtxCount;
         g.IO.MetricsRenderIndices += draw_data->TotalIdxCount;
     }
@@ -5960,7 +6441,8 @@ void ImGui::Render()
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures)
         for (ImFontAtlas* atlas : g.FontAtlases)
-            ImFontAtlasDebugLogTextureRequests(atlas);
+            if ((atlas->Flags & ImFontAtlasFlags_SharedAcrossThreads) == 0) // Textures may be updated by another thread
+                ImFontAtlasDebugLogTextureRequests(atlas);
 #endif
 
     CallContextHooks(&g, ImGuiContextHookType_RenderPost);
@@ -5982,6 +6464,30 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
+    if (text_display_end == NULL)
+        text_display_end = text + ImStrlen(text);
+
+    // Lookup text measured earlier
+    // (Using font pointer and density rather than baked font: baked fonts may be discarded but glyphs advances won't change, see ImFontAtlasBuildNotifyBakedChanged())
+    ImU32 font_size_bits, density_bits, wrap_width_bits;
+    if (wrap_width < 0.0f)
+        wrap_width = 0.0f;
+    memcpy(&font_size_bits, &font_size, 4);
+    memcpy(&density_bits, &font->CurrentRasterizerDensity, 4);
+    memcpy(&wrap_width_bits, &wrap_width, 4);
+    const ImU64 seed = (ImU64)(uintptr_t)font ^ ((((ImU64)font_size_bits << 32) | density_bits) * 0x9E3779B97F4A7C15ULL) ^ (wrap_width_bits * 0xC2B2AE3D27D4EB4FULL);
+    ImU64 key = ImHashData64(text, (size_t)(text_display_end - text), seed);
+    if (key == 0)
+        key = 1;
+    const bool use_memo = (font != &g.InputTextPasswordFont); // Password font substitutes '*' glyph of whichever font was current, key wouldn't be unique (see PushPasswordFont()).
+    ImGuiTextSizeMemoEntry* entry = (use_memo && g.TextSizeMemo.Size) ? CalcTextSizeMemoFindSlot(key) : NULL;
+    if (entry && entry->Key == key)
+    {
+        g.TextSizeMemoHits++;
+        return entry->Size;
+    }
+    g.TextSizeMemoMisses++;
+
     ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
 
     // Round
@@ -5990,10 +6496,155 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     // - https://git.musl-libc.org/cgit/musl/tree/src/math/ceilf.c
     // - https://embarkstudios.github.io/rust-gpu/api/src/libm/math/ceilf.rs.html
     text_size.x = IM_TRUNC(text_size.x + 0.99999f);
+    if (!use_memo)
+        return text_size;
 
+    // Store. When full, start over (at most once every IM_TEXTSIZEMEMO_CLEAR_FRAMES frames) so that text which isn't displayed anymore doesn't stay forever.
+    if (g.TextSizeMemoCount >= IM_TEXTSIZEMEMO_MAX_COUNT && g.FrameCount >= g.TextSizeMemoLastClearFrame + IM_TEXTSIZEMEMO_CLEAR_FRAMES)
+    {
+        g.TextSizeMemoLastClearFrame = g.FrameCount;
+        ClearTextSizeMemo(&g);
+        entry = CalcTextSizeMemoFindSlot(key);
+    }
+    if (g.TextSizeMemoCount < IM_TEXTSIZEMEMO_MAX_COUNT)
+    {
+        if ((g.TextSizeMemoCount + 1) * 2 > g.TextSizeMemo.Size)
+            entry = CalcTextSizeMemoGrow(key);
+        entry->Key = key;
+        entry->Size = text_size;
+        g.TextSizeMemoCount++;
+    }
     return text_size;
 }
 
+// Return slot storing size of text with given key, or empty slot where it may be added.
+ImGuiTextSizeMemoEntry* ImGui::CalcTextSizeMemoFindSlot(ImU64 key)
+{
+    ImGuiContext& g = *GImGui;
+    const ImU32 mask = (ImU32)g.TextSizeMemo.Size - 1;
+    for (ImU32 slot = (ImU32)key & mask; ; slot = (slot + 1) & mask)
+    {
+        ImGuiTextSizeMemoEntry* entry = &g.TextSizeMemo.Data[slot];
+        if (entry->Key == 0 || entry->Key == key)
+            return entry;
+    }
+}
+
+// Double size of table and return empty slot for given key
+ImGuiTextSizeMemoEntry* ImGui::CalcTextSizeMemoGrow(ImU64 key)
+{
+    ImGuiContext& g = *GImGui;
+    ImVector<ImGuiTextSizeMemoEntry> old_table;
+    old_table.swap(g.TextSizeMemo);
+    g.TextSizeMemo.resize(ImMax(old_table.Size * 2, 256));
+    memset(g.TextSizeMemo.Data, 0, (size_t)g.TextSizeMemo.size_in_bytes());
+    for (const ImGuiTextSizeMemoEntry& old_entry : old_table)
+        if (old_entry.Key != 0)
+            *CalcTextSizeMemoFindSlot(old_entry.Key) = old_entry;
+    return CalcTextSizeMemoFindSlot(key);
+}
+
+// Called when full, and by font atlas when glyphs advances may have changed (e.g. discarded or reloaded fonts)
+void ImGui::ClearTextSizeMemo(ImGuiContext* ctx)
+{
+    ImGuiContext& g = *ctx;
+    if (g.TextSizeMemoCount > 0)
+        memset(g.TextSizeMemo.Data, 0, (size_t)g.TextSizeMemo.size_in_bytes());
+    g.TextSizeMemoCount = 0;
+}
+
+// Free grid memory. Windows will be added again on their next Begin().
+static void ClearWindowsHoverGrid()
+{
+    ImGuiContext& g = *GImGui;
+    for (ImVector<ImGuiWindowHoverGridEntry>& cell : g.WindowsHoverGridCells)
+        cell.clear();
+    g.WindowsHoverGridGeneration++;
+    g.WindowsHoverGridValidFrame = g.FrameCount + 2; // Windows already submitted in current frame won't be added again until next frame.
+    g.WindowsHoverGridReady = false;
+}
+
+// Positions outside of the grid rectangle are clamped to border cells. Never return an out of range cell, even for NaN.
+static int GetWindowsHoverGridCell(float v, float grid_min, float grid_max)
+{
+    if (!(v > grid_min))
+        return 0;
+    if (v >= grid_max)
+        return IM_WINDOWS_HOVER_GRID_CELLS - 1;
+    return ImMin((int)((v - grid_min) * IM_WINDOWS_HOVER_GRID_CELLS / (grid_max - grid_min)), IM_WINDOWS_HOVER_GRID_CELLS - 1);
+}
+
+// Called by Begin() once per frame, after OuterRectClipped has been updated.
+// In the common case of a window which didn't move or resize, this is only a comparison.
+static void UpdateWindowInHoverGrid(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImRect rect = window->OuterRectClipped;
+    rect.Expand(g.WindowsHoverGridPadding);
+    const bool in_grid = (window->HoverGridGeneration == g.WindowsHoverGridGeneration);
+    if (in_grid && rect.Min == window->HoverGridRect.Min && rect.Max == window->HoverGridRect.Max)
+        return;
+
+    const ImRect& grid_rect = g.WindowsHoverGridRect;
+    for (int pass = in_grid ? 0 : 1; pass < 2; pass++)
+    {
+        // Pass 0: remove from cells of previous rectangle, Pass 1: add to cells of new rectangle
+        const ImRect& cells_rect = (pass == 0) ? window->HoverGridRect : rect;
+        const int x1 = GetWindowsHoverGridCell(cells_rect.Min.x, grid_rect.Min.x, grid_rect.Max.x);
+        const int x2 = GetWindowsHoverGridCell(cells_rect.Max.x, grid_rect.Min.x, grid_rect.Max.x);
+        const int y1 = GetWindowsHoverGridCell(cells_rect.Min.y, grid_rect.Min.y, grid_rect.Max.y);
+        const int y2 = GetWindowsHoverGridCell(cells_rect.Max.y, grid_rect.Min.y, grid_rect.Max.y);
+        for (int y = y1; y <= y2; y++)
+            for (int x = x1; x <= x2; x++)
+            {
+                ImVector<ImGuiWindowHoverGridEntry>& cell = g.WindowsHoverGridCells[y * IM_WINDOWS_HOVER_GRID_CELLS + x];
+                if (pass == 0)
+                {
+                    for (ImGuiWindowHoverGridEntry& entry : cell)
+                        if (entry.Window == window)
+                        {
+                            entry = cell.back(); // Order within a cell doesn't matter
+                            cell.pop_back();
+                            break;
+                        }
+                }
+                else
+                {
+                    ImGuiWindowHoverGridEntry entry;
+                    entry.Rect = rect;
+                    entry.Window = window;
+                    cell.push_back(entry);
+                }
+            }
+    }
+    window->HoverGridRect = rect;
+    window->HoverGridGeneration = g.WindowsHoverGridGeneration;
+}
+
+static bool IsWindowHoverableAtPos(ImGuiWindow* window, const ImVec2& pos, const ImVec2& padding_regular, const ImVec2& padding_for_resize)
+{
+    if (!window->WasActive || window->Hidden)
+        return false;
+    if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
+        return false;
+
+    // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
+    ImVec2 hit_padding = (window->Flags & (ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize)) ? padding_regular : padding_for_resize;
+    if (!window->OuterRectClipped.ContainsWithPad(pos, hit_padding))
+        return false;
+
+    // Support for one rectangular hole in any given window
+    // FIXME: Consider generalizing hit-testing override (with more generic data, callback, etc.) (#1512)
+    if (window->HitTestHoleSize.x != 0)
+    {
+        ImVec2 hole_pos(window->Pos.x + (float)window->HitTestHoleOffset.x, window->Pos.y + (float)window->HitTestHoleOffset.y);
+        ImVec2 hole_size((float)window->HitTestHoleSize.x, (float)window->HitTestHoleSize.y);
+        if (ImRect(hole_pos, hole_pos + hole_size).Contains(pos))
+            return false;
+    }
+    return true;
+}
+
 // Find window given position, search front-to-back
 // - Typically write output back to g.HoveredWindow and g.HoveredWindowUnderMovingWindow.
 // - FIXME: Note that we have an inconsequential lag here: OuterRectClipped is updated in Begin(), so windows moved programmatically
@@ -6011,30 +6662,40 @@ void ImGui::FindHoveredWindowEx(const ImVec2& pos, bool find_first_and_in_any_vi
 
     ImVec2 padding_regular = g.Style.TouchExtraPadding;
     ImVec2 padding_for_resize = ImMax(g.Style.TouchExtraPadding, ImVec2(g.Style.WindowBorderHoverPadding, g.Style.WindowBorderHoverPadding));
+
+    // Fast path: only test windows registered in the grid cell containing 'pos', keeping the front-most ones.
+    // This gives the same result as the front-to-back scan below, without touching every window.
+    if (!find_first_and_in_any_viewport && g.WindowsHoverGridReady && padding_for_resize.x <= g.WindowsHoverGridPadding.x && padding_for_resize.y <= g.WindowsHoverGridPadding.y)
+    {
+        const ImRect& grid_rect = g.WindowsHoverGridRect;
+        const int cell_x = GetWindowsHoverGridCell(pos.x, grid_rect.Min.x, grid_rect.Max.x);
+        const int cell_y = GetWindowsHoverGridCell(pos.y, grid_rect.Min.y, grid_rect.Max.y);
+        const bool hovered_window_is_moving_window = (hovered_window != NULL);
+        for (const ImGuiWindowHoverGridEntry& entry : g.WindowsHoverGridCells[cell_y * IM_WINDOWS_HOVER_GRID_CELLS + cell_x])
+        {
+            if (!entry.Rect.Contains(pos))
+                continue;
+            ImGuiWindow* window = entry.Window;
+            if (!IsWindowHoverableAtPos(window, pos, padding_regular, padding_for_resize))
+                continue;
+            if (!hovered_window_is_moving_window && (hovered_window == NULL || window->DisplayOrder > hovered_window->DisplayOrder))
+                hovered_window = window;
+            if ((!g.MovingWindow || window->RootWindow != g.MovingWindow->RootWindow) && (hovered_window_under_moving_window == NULL || window->DisplayOrder > hovered_window_under_moving_window->DisplayOrder))
+                hovered_window_under_moving_window = window;
+        }
+        *out_hovered_window = hovered_window;
+        if (out_hovered_window_under_moving_window != NULL)
+            *out_hovered_window_under_moving_window = hovered_window_under_moving_window;
+        return;
+    }
+
     for (int i = g.Windows.Size - 1; i >= 0; i--)
     {
         ImGuiWindow* window = g.Windows[i];
         IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
-        if (!window->WasActive || window->Hidden)
-            continue;
-        if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
-            continue;
-
-        // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
-        ImVec2 hit_padding = (window->Flags & (ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize)) ? padding_regular : padding_for_resize;
-        if (!window->OuterRectClipped.ContainsWithPad(pos, hit_padding))
+        if (!IsWindowHoverableAtPos(window, pos, padding_regular, padding_for_resize))
             continue;
 
-        // Support for one rectangular hole in any given window
-        // FIXME: Consider generalizing hit-testing override (with more generic data, callback, etc.) (#1512)
-        if (window->HitTestHoleSize.x != 0)
-        {
-            ImVec2 hole_pos(window->Pos.x + (float)window->HitTestHoleOffset.x, window->Pos.y + (float)window->HitTestHoleOffset.y);
-            ImVec2 hole_size((float)window->HitTestHoleSize.x, (float)window->HitTestHoleSize.y);
-            if (ImRect(hole_pos, hole_pos + hole_size).Contains(pos))
-                continue;
-        }
-
         if (find_first_and_in_any_viewport)
         {
             hovered_window = window;
@@ -7165,57 +7826,207 @@ void ImGui::UpdateWindowParentAndRootLinks(ImGuiWindow* window, ImGuiWindowFlags
     }
 }
 
-// [EXPERIMENTAL] Called by Begin(). NextWindowData is valid at this point.
-// This is designed as a toy/test-bed for
-void ImGui::UpdateWindowSkipRefresh(ImGuiWindow* window)
+// Retained windows (ImGuiWindowFlags_Retained on a top-level window)
+// - Contents of the window and its child windows (draw lists, layout, items) are kept from the last time they were refreshed,
+//   and Begin() returns false, unless:
+//   - the window is appearing, or a refresh was requested with SetWindowDirty().
+//   - the window tree is hovered, active, has an open popup, or is focused and receiving keyboard/gamepad inputs.
+//   - state used to build contents changed: position, size, scroll, flags, contents size, focus, hover, style, font, font atlas texture.
+//   Style is hashed by NewFrame(): modifications made during the frame are only noticed when using PushStyleColor()/PushStyleVar().
+// - When state changed by the end of a refreshed frame, we also refresh the following frame to let layout and hover state settle.
+// - Anything else contents depend on (e.g. application data, animations) needs to call SetWindowDirty().
+static bool IsWindowRetained(ImGuiWindow* window)
 {
-    ImGuiContext& g = *GImGui;
-    window->SkipRefresh = false;
-    if ((g.NextWindowData.HasFlags & ImGuiNextWindowDataFlags_HasRefreshPolicy) == 0)
-        return;
-    if (g.NextWindowData.RefreshFlagsVal & ImGuiWindowRefreshFlags_TryToAvoidRefresh)
-    {
-        // FIXME-IDLE: Tests for e.g. mouse clicks or keyboard while focused.
-        if (window->Appearing) // If currently appearing
-            return;
-        if (window->Hidden) // If was hidden (previous frame)
-            return;
-        if ((g.NextWindowData.RefreshFlagsVal & ImGuiWindowRefreshFlags_RefreshOnHover) && g.HoveredWindow)
-            if (window->RootWindow == g.HoveredWindow->RootWindow || IsWindowWithinBeginStackOf(g.HoveredWindow->RootWindow, window))
-                return;
-        if ((g.NextWindowData.RefreshFlagsVal & ImGuiWindowRefreshFlags_RefreshOnFocus) && g.NavWindow)
-            if (window->RootWindow == g.NavWindow->RootWindow || IsWindowWithinBeginStackOf(g.NavWindow->RootWindow, window))
-                return;
-        window->DrawList = NULL;
-        window->SkipRefresh = true;
-    }
+    return (window->Flags & ImGuiWindowFlags_Retained) && !(window->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_Popup | ImGuiWindowFlags_Tooltip));
 }
 
-static void SetWindowActiveForSkipRefresh(ImGuiWindow* window)
+static bool IsWindowRetainedTreeHovered(ImGuiWindow* window, ImGuiWindow* hovered_window)
 {
-    window->Active = true;
-    for (ImGuiWindow* child : window->DC.ChildWindows)
-        if (!child->Hidden)
-        {
-            child->Active = child->SkipRefresh = true;
-            SetWindowActiveForSkipRefresh(child);
-        }
+    return hovered_window != NULL && (window->RootWindow == hovered_window->RootWindow || ImGui::IsWindowWithinBeginStackOf(hovered_window->RootWindow, window));
 }
 
-// Push a new Dear ImGui window to add widgets to.
-// - A default window called "Debug" is automatically stacked at the beginning of every frame so you can use widgets without explicitly calling a Begin/End pair.
-// - Begin/End can be called multiple times during the frame with the same window name to append content.
-// - The window name is used as a unique identifier to preserve window information across frames (and save rudimentary information to the .ini file).
-//   You can use the "##" or "###" markers to use the same label with different id, or same id with different label. See documentation at the top of this file.
-// - Return false when window is collapsed, so you can early out in your code. You always need to call ImGui::End() even if false is returned.
-// - Passing 'bool* p_open' displays a Close button on the upper-right corner of the window, the pointed value will be set to false when the button is pressed.
-bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
+// Hash contents of ImGuiStyle, skipping the padding following its bool fields.
+ImGuiID ImGui::CalcStyleHash(const ImGuiStyle* style)
+{
+    const size_t bools_end = offsetof(ImGuiStyle, AntiAliasedFill) + sizeof(style->AntiAliasedFill);
+    const size_t floats_begin = offsetof(ImGuiStyle, CurveTessellationTol);
+    ImGuiID hash = ImHashData(style, bools_end);
+    return ImHashData((const char*)style + floats_begin, sizeof(ImGuiStyle) - floats_begin, hash);
+}
+
+static ImGuiID CalcWindowRetainedStateHash(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    struct
+    {
+        ImVec2              Pos, SizeFull, Scroll, ScrollMax, ContentSizeExplicit, CursorMaxPos, IdealMaxPos, SetWindowPosVal, SetWindowPosPivot, DisplaySize;
+        ImGuiWindowFlags    Flags;
+        ImFont*             Font;
+        float               FontSizeBase, FontWindowScale, Alpha;
+        int                 TexUniqueID, AsyncGlyphsCommitCount, PagesReleasedCount;
+        ImGuiID             NavId;
+        bool                Collapsed, IsFocused, IsHovered, IsActive, IsNavCursorVisible;
+    } state;
+    memset(&state, 0, sizeof(state)); // Clear padding
+    state.Pos = window->Pos;
+    state.SizeFull = window->SizeFull;
+    state.Scroll = window->Scroll;
+    state.ScrollMax = window->ScrollMax;
+    state.ContentSizeExplicit = window->ContentSizeExplicit;
+    state.CursorMaxPos = window->DC.CursorMaxPos;
+    state.IdealMaxPos = window->DC.IdealMaxPos;
+    state.SetWindowPosVal = window->SetWindowPosVal;
+    state.SetWindowPosPivot = window->SetWindowPosPivot;
+    state.DisplaySize = g.IO.DisplaySize;
+    state.Flags = window->Flags;
+    state.Font = g.Font;
+    state.FontSizeBase = g.FontSizeBase;
+    state.FontWindowScale = window->FontWindowScale;
+    state.Alpha = g.Style.Alpha; // Modified by BeginDisabled()
+    state.TexUniqueID = (g.Font && g.Font->ContainerAtlas->TexData) ? g.Font->ContainerAtlas->TexData->UniqueID : 0; // Texture is recreated when glyphs are repacked
+    state.AsyncGlyphsCommitCount = (g.Font && g.Font->ContainerAtlas->Builder) ? g.Font->ContainerAtlas->Builder->AsyncGlyphsCommitCount : 0; // Placeholder glyphs got their pixels
+    state.PagesReleasedCount = (g.Font && g.Font->ContainerAtlas->Builder) ? g.Font->ContainerAtlas->Builder->PagesReleasedCount : 0; // Texture page destroyed (ImFontAtlasFlags_TexturePages)
+    state.Collapsed = window->Collapsed;
+    state.IsFocused = g.NavWindow && ImGui::IsWindowWithinBeginStackOf(g.NavWindow, window);
+    state.IsHovered = IsWindowRetainedTreeHovered(window, g.HoveredWindow);
+    state.IsActive = g.ActiveId != 0 && g.ActiveIdWindow && ImGui::IsWindowWithinBeginStackOf(g.ActiveIdWindow, window);
+    if (state.IsFocused)
+    {
+        state.NavId = g.NavId;
+        state.IsNavCursorVisible = g.NavCursorVisible;
+    }
+
+    // Style was hashed by NewFrame(): only add current values of pushed colors and variables.
+    ImGuiID hash = g.StyleHash;
+    for (const ImGuiColorMod& mod : g.ColorStack)
+    {
+        hash = ImHashData(&mod.Col, sizeof(mod.Col), hash);
+        hash = ImHashData(&g.Style.Colors[mod.Col], sizeof(ImVec4), hash);
+    }
+    for (const ImGuiStyleMod& mod : g.StyleVarStack)
+    {
+        const ImGuiStyleVarInfo* var_info = ImGui::GetStyleVarInfo(mod.VarIdx);
+        hash = ImHashData(&mod.VarIdx, sizeof(mod.VarIdx), hash);
+        hash = ImHashData(var_info->GetVarPtr(&g.Style), var_info->Count * sizeof(float), hash);
+    }
+    return ImHashData(&state, sizeof(state), hash);
+}
+
+// Contents of a retained window need to be refreshed this frame?
+static bool IsWindowRetainedRefreshNeeded(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    if (window->RefreshFramesRequested > 0)
+        return true;
+    if (window->ScrollTarget.x != FLT_MAX || window->ScrollTarget.y != FLT_MAX || window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0 || window->HiddenFramesCannotSkipItems > 0)
+        return true;
+    if (g.LogEnabled)
+        return true;
+
+    // Interactions
+    if (IsWindowRetainedTreeHovered(window, g.HoveredWindow))
+        return true;
+    if (g.ActiveId != 0 && g.ActiveIdWindow && ImGui::IsWindowWithinBeginStackOf(g.ActiveIdWindow, window))
+        return true;
+    for (const ImGuiPopupData& popup_data : g.OpenPopupStack)
+        if (popup_data.Window ? ImGui::IsWindowWithinBeginStackOf(popup_data.Window, window) : (popup_data.OpenFrameCount >= g.FrameCount - 1)) // Popups opened last frame don't know their parent window yet
+            return true;
+    if (g.NavWindow && ImGui::IsWindowWithinBeginStackOf(g.NavWindow, window))
+    {
+        if (g.NavAnyRequest)
+            return true;
+        for (const ImGuiInputEvent& e : g.InputEventsTrail)
+            if (e.Type == ImGuiInputEventType_Key || e.Type == ImGuiInputEventType_Text)
+                return true;
+    }
+
+    // State changes
+    return CalcWindowRetainedStateHash(window) != window->RetainedStateHash;
+}
+
+// Called by Begin(). NextWindowData is valid at this point.
+// - ImGuiWindowFlags_Retained: see comments above.
+// - [EXPERIMENTAL] SetNextWindowRefreshPolicy(): This is designed as a toy/test-bed for retained windows.
+void ImGui::UpdateWindowSkipRefresh(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    if (window->BeginCount > 0)
+    {
+        // Appending with multiple Begin()/End() pairs: keep state of first Begin() of the frame
+        if (window->SkipRefresh)
+            window->DrawList = NULL;
+        return;
+    }
+    window->SkipRefresh = false;
+    if (g.NextWindowData.HasFlags & ImGuiNextWindowDataFlags_HasRefreshPolicy)
+    {
+        if (g.NextWindowData.RefreshFlagsVal & ImGuiWindowRefreshFlags_TryToAvoidRefresh)
+        {
+            // FIXME-IDLE: Tests for e.g. mouse clicks or keyboard while focused.
+            if (window->Appearing) // If currently appearing
+                return;
+            if (window->Hidden) // If was hidden (previous frame)
+                return;
+            if ((g.NextWindowData.RefreshFlagsVal & ImGuiWindowRefreshFlags_RefreshOnHover) && g.HoveredWindow)
+                if (window->RootWindow == g.HoveredWindow->RootWindow || IsWindowWithinBeginStackOf(g.HoveredWindow->RootWindow, window))
+                    return;
+            if ((g.NextWindowData.RefreshFlagsVal & ImGuiWindowRefreshFlags_RefreshOnFocus) && g.NavWindow)
+                if (window->RootWindow == g.NavWindow->RootWindow || IsWindowWithinBeginStackOf(g.NavWindow->RootWindow, window))
+                    return;
+            window->DrawList = NULL;
+            window->SkipRefresh = true;
+        }
+    }
+    else if (IsWindowRetained(window))
+    {
+        if (window->Appearing || window->Hidden || window->IsFallbackWindow)
+            return;
+        const bool refresh = IsWindowRetainedRefreshNeeded(window);
+        if (window->RefreshFramesRequested > 0)
+            window->RefreshFramesRequested--;
+        if (refresh)
+            return;
+        window->DrawList = NULL;
+        window->SkipRefresh = true;
+    }
+}
+
+// Called by End() after refreshing contents of a retained window.
+static void UpdateWindowRetainedState(ImGuiWindow* window)
+{
+    const ImGuiID state_hash = CalcWindowRetainedStateHash(window);
+    if (state_hash != window->RetainedStateHash)
+        window->RefreshFramesRequested = ImMax(window->RefreshFramesRequested, (ImS8)1);
+    window->RetainedStateHash = state_hash;
+}
+
+static void SetWindowActiveForSkipRefresh(ImGuiWindow* window)
+{
+    UpdateWindowInHoverGrid(window); // Keep last OuterRectClipped
+    window->Active = true;
+    for (ImGuiWindow* child : window->DC.ChildWindows)
+        if (!child->Hidden)
+        {
+            child->SkipRefresh = true;
+            SetWindowActiveForSkipRefresh(child);
+        }
+}
+
+// Push a new Dear ImGui window to add widgets to.
+// - A default window called "Debug" is automatically stacked at the beginning of every frame so you can use widgets without explicitly calling a Begin/End pair.
+// - Begin/End can be called multiple times during the frame with the same window name to append content.
+// - The window name is used as a unique identifier to preserve window information across frames (and save rudimentary information to the .ini file).
+//   You can use the "##" or "###" markers to use the same label with different id, or same id with different label. See documentation at the top of this file.
+// - Return false when window is collapsed, so you can early out in your code. You always need to call ImGui::End() even if false is returned.
+// - Passing 'bool* p_open' displays a Close button on the upper-right corner of the window, the pointed value will be set to false when the button is pressed.
+bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 {
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
     IM_ASSERT(name != NULL && name[0] != '\0');     // Window name required
     IM_ASSERT(g.WithinFrameScope);                  // Forgot to call ImGui::NewFrame()
     IM_ASSERT(g.FrameCountEnded != g.FrameCount);   // Called ImGui::Render() or ImGui::EndFrame() and haven't called ImGui::NewFrame() again yet
+    IMGUI_PROFILER_ZONE_BEGIN("Begin", NULL);
 
     // Find or create
     ImGuiWindow* window = FindWindowByName(name);
@@ -7367,7 +8178,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     if (window->Appearing)
         SetWindowConditionAllowFlags(window, ImGuiCond_Appearing, false);
 
-    // [EXPERIMENTAL] Skip Refresh mode
+    // Skip Refresh mode (ImGuiWindowFlags_Retained or [EXPERIMENTAL] SetNextWindowRefreshPolicy())
     UpdateWindowSkipRefresh(window);
 
     // Nested root windows (typically tooltips) override disabled state
@@ -7697,6 +8508,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         const ImRect title_bar_rect = window->TitleBarRect();
         window->OuterRectClipped = outer_rect;
         window->OuterRectClipped.ClipWith(host_rect);
+        UpdateWindowInHoverGrid(window);
 
         // Inner rectangle
         // Not affected by window border size. Used by:
@@ -7977,6 +8789,11 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->SkipItems = true;
     }
 
+    // Profiler: measure the time spent in Begin() then in window contents until End(). The implicit fallback window is not measured as it spans the whole frame.
+    IMGUI_PROFILER_ZONE_END("Begin");
+    if (!window->IsFallbackWindow)
+        IMGUI_PROFILER_ZONE_BEGIN(window->Name, window);
+
     // [DEBUG] io.ConfigDebugBeginReturnValue override return value to test Begin/End and BeginChild/EndChild behaviors.
     // (The implicit fallback window is NOT automatically ended allowing it to always be able to receive commands without crashing)
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
@@ -8003,6 +8820,9 @@ void ImGui::End()
         IM_ASSERT_USER_ERROR(g.CurrentWindowStack.Size > 1, "Calling End() too many times!");
         return;
     }
+    if (!window->IsFallbackWindow)
+        IMGUI_PROFILER_ZONE_END(window->Name);
+    IMGUI_PROFILER_SCOPE("End");
     ImGuiWindowStackData& window_stack_data = g.CurrentWindowStack.back();
 
     // Error checking: verify that user doesn't directly call End() on a child window.
@@ -8023,6 +8843,16 @@ void ImGui::End()
         IM_ASSERT(window->DrawList == NULL);
         window->DrawList = &window->DrawListInst;
     }
+    else if (IsWindowRetained(window))
+    {
+        UpdateWindowRetainedState(window);
+    }
+
+    // Request another frame while window state is converging (see io.WantRedraw)
+    if (window->ScrollTarget.x != FLT_MAX || window->ScrollTarget.y != FLT_MAX || window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0 || window->RefreshFramesRequested > 0)
+        RequestRedrawEx(0.0f, "Window layout");
+    if (window->HiddenFramesCanSkipItems > 0 || window->HiddenFramesCannotSkipItems > 0 || window->HiddenFramesForRenderOnly > 0)
+        RequestRedrawEx(0.0f, "Window hidden frames");
 
     // Stop logging
     if (g.LogWindow == window) // FIXME: add more options for scope of logging
@@ -8261,7 +9091,10 @@ bool ImGui::IsWindowHovered(ImGuiHoveredFlags flags)
     if (flags & ImGuiHoveredFlags_ForTooltip)
         flags = ApplyHoverFlagsForTooltip(flags, g.Style.HoverFlagsForTooltipMouse);
     if ((flags & ImGuiHoveredFlags_Stationary) != 0 && g.HoverWindowUnlockedStationaryId != ref_window->ID)
+    {
+        RequestRedrawEx(g.Style.HoverStationaryDelay - g.MouseStationaryTimer, "Hover stationary delay");
         return false;
+    }
 
     return true;
 }
@@ -8415,6 +9248,26 @@ void ImGui::SetWindowCollapsed(const char* name, bool collapsed, ImGuiCond cond)
         SetWindowCollapsed(window, collapsed, cond);
 }
 
+// Request contents of a retained window (ImGuiWindowFlags_Retained) to be refreshed on its next Begin().
+// Called while appending to the window, this refreshes it again on the next frame.
+void ImGui::SetWindowDirty(ImGuiWindow* window)
+{
+    window->RefreshFramesRequested = ImMax(window->RefreshFramesRequested, (ImS8)1);
+    RequestRedrawEx(0.0f, "SetWindowDirty()");
+}
+
+void ImGui::SetWindowDirty()
+{
+    ImGuiContext& g = *GImGui;
+    SetWindowDirty(g.CurrentWindow->RootWindow);
+}
+
+void ImGui::SetWindowDirty(const char* name)
+{
+    if (ImGuiWindow* window = FindWindowByName(name))
+        SetWindowDirty(window->RootWindow);
+}
+
 void ImGui::SetNextWindowPos(const ImVec2& pos, ImGuiCond cond, const ImVec2& pivot)
 {
     ImGuiContext& g = *GImGui;
@@ -8710,6 +9563,7 @@ static void ImGui::UpdateTexturesNewFrame()
     {
         if (atlas->OwnerContext == &g)
         {
+            atlas->RendererHasSdfTextures = (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasSdfTextures) != 0;
             ImFontAtlasUpdateNewFrame(atlas, g.FrameCount, has_textures);
         }
         else
@@ -8730,6 +9584,11 @@ static void ImGui::UpdateTexturesEndFrame()
     ImGuiContext& g = *GImGui;
     g.PlatformIO.Textures.resize(0);
     for (ImFontAtlas* atlas : g.FontAtlases)
+    {
+        // With ImFontAtlasFlags_SharedAcrossThreads, textures are not listed, otherwise renderers of contexts on different threads would update them concurrently.
+        // The application updates them with a single renderer after ImFontAtlasUpdateNewFrame(), while no other context is rendering.
+        if (atlas->Flags & ImFontAtlasFlags_SharedAcrossThreads)
+            continue;
         for (ImTextureData* tex : atlas->TexList)
         {
             // We provide this information so backends can decide whether to destroy textures.
@@ -8737,8 +9596,15 @@ static void ImGui::UpdateTexturesEndFrame()
             tex->RefCount = (unsigned short)atlas->RefCount;
             g.PlatformIO.Textures.push_back(tex);
         }
+    }
     for (ImTextureData* tex : g.UserTextures)
         g.PlatformIO.Textures.push_back(tex);
+
+    // Start rasterizing glyphs queued during the frame (ImFontAtlasFlags_AsyncGlyphLoading)
+    // With ImFontAtlasFlags_SharedAcrossThreads, glyphs are only queued by ImFontAtlasUpdateNewFrame() which starts the task.
+    for (ImFontAtlas* atlas : g.FontAtlases)
+        if ((atlas->Flags & ImFontAtlasFlags_SharedAcrossThreads) == 0)
+            ImFontAtlasAsyncGlyphsStart(atlas);
 }
 
 void ImGui::UpdateFontsNewFrame()
@@ -8842,7 +9708,8 @@ void ImGui::SetCurrentFont(ImFont* font, float font_size_before_scaling, float f
         ImFontAtlas* atlas = font->ContainerAtlas;
         g.DrawListSharedData.FontAtlas = atlas;
         g.DrawListSharedData.Font = font;
-        ImFontAtlasUpdateDrawListsSharedData(atlas);
+        g.DrawListSharedData.TexUvWhitePixel = atlas->TexUvWhitePixel; // Other contexts are updated by ImFontAtlasUpdateDrawListsSharedData() when this changes
+        g.DrawListSharedData.TexUvLines = atlas->TexUvLines;
         if (g.CurrentWindow != NULL)
             g.CurrentWindow->DrawList->_SetTexture(atlas->TexRef);
     }
@@ -8892,8 +9759,8 @@ void ImGui::UpdateCurrentFontSize(float restore_font_size_after_scaling)
     // - We may support it better later and remove this rounding.
     final_size = GetRoundedFontSize(final_size);
     final_size = ImClamp(final_size, 1.0f, IMGUI_FONT_SIZE_MAX);
-    if (g.Font != NULL && (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures))
-        g.Font->CurrentRasterizerDensity = g.FontRasterizerDensity;
+    if (g.Font != NULL && (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures) && g.Font->CurrentRasterizerDensity != g.FontRasterizerDensity)
+        g.Font->CurrentRasterizerDensity = g.FontRasterizerDensity; // Only write when changed: font may be shared by contexts on other threads, which need to use the same density.
     g.FontSize = final_size;
     g.FontBaked = (g.Font != NULL && window != NULL) ? g.Font->GetFontBaked(final_size) : NULL;
     g.FontBakedScale = (g.Font != NULL && window != NULL) ? (g.FontSize / g.FontBaked->Size) : 0.0f;
@@ -10217,6 +11084,55 @@ static void DebugPrintInputEvent(const char* prefix, const ImGuiInputEvent* e)
 }
 #endif
 
+// Move events submitted from other threads via io.PostXXX() functions into the input queue.
+// Redundant events are coalesced only when adjacent, which doesn't affect how the queue is trickled by UpdateInputEvents():
+// - successive mouse moves (same source) are merged into the latest position.
+// - successive mouse wheels (same source) are summed.
+void ImGui::UpdateInputEventsPosted()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+    ImGuiInputEventPosted pe;
+    while (PopPostedInputEvent(&g, &pe))
+    {
+        ImGuiInputEvent* last_e = (g.InputEventsQueue.Size > 0 && io.AppAcceptingEvents) ? &g.InputEventsQueue.back() : NULL;
+        if (pe.Type == ImGuiInputEventType_MousePos)
+        {
+            if (last_e && last_e->Type == ImGuiInputEventType_MousePos && last_e->MousePos.MouseSource == g.InputEventsNextMouseSource)
+            {
+                last_e->MousePos.PosX = (pe.X > -FLT_MAX) ? ImFloor(pe.X) : pe.X;
+                last_e->MousePos.PosY = (pe.Y > -FLT_MAX) ? ImFloor(pe.Y) : pe.Y;
+            }
+            else
+            {
+                io.AddMousePosEvent(pe.X, pe.Y);
+            }
+        }
+        else if (pe.Type == ImGuiInputEventType_MouseWheel)
+        {
+            if (last_e && last_e->Type == ImGuiInputEventType_MouseWheel && last_e->MouseWheel.MouseSource == g.InputEventsNextMouseSource)
+            {
+                last_e->MouseWheel.WheelX += pe.X;
+                last_e->MouseWheel.WheelY += pe.Y;
+            }
+            else
+            {
+                io.AddMouseWheelEvent(pe.X, pe.Y);
+            }
+        }
+        else if (pe.Type == ImGuiInputEventType_MouseButton)
+            io.AddMouseButtonEvent(pe.Arg, pe.Down);
+        else if (pe.Type == ImGuiInputEventType_Key)
+            io.AddKeyAnalogEvent((ImGuiKey)pe.Arg, pe.Down, pe.X);
+        else if (pe.Type == ImGuiInputEventType_Text)
+            io.AddInputCharacter((unsigned int)pe.Arg);
+        else if (pe.Type == ImGuiInputEventType_Focus)
+            io.AddFocusEvent(pe.Down);
+        else if (pe.Type == ImGuiInputEventType_None)
+            io.AddMouseSourceEvent((ImGuiMouseSource)pe.Arg);
+    }
+}
+
 // Process input queue
 // We always call this with the value of 'bool g.IO.ConfigInputTrickleEventQueue'.
 // - trickle_fast_inputs = false : process all events, turn into flattened input state (e.g. successive down/up/down/up will be lost)
@@ -12027,6 +12943,7 @@ void ImGui::OpenPopupEx(ImGuiID id, ImGuiPopupFlags popup_flags)
     if (g.OpenPopupStack.Size < current_stack_size + 1)
     {
         g.OpenPopupStack.push_back(popup_ref);
+        RequestRedrawEx(0.0f, "OpenPopup()");
     }
     else
     {
@@ -12048,6 +12965,7 @@ void ImGui::OpenPopupEx(ImGuiID id, ImGuiPopupFlags popup_flags)
             // Reopen: close child popups if any, then flag popup for open/reopen (set position, focus, init navigation)
             ClosePopupToLevel(current_stack_size, true);
             g.OpenPopupStack.push_back(popup_ref);
+            RequestRedrawEx(0.0f, "OpenPopup()");
         }
 
         // When reopening a popup we first refocus its parent, otherwise if its parent is itself a popup it would get closed by ClosePopupsOverWindow().
@@ -12132,6 +13050,7 @@ void ImGui::ClosePopupToLevel(int remaining, bool restore_focus_to_window_under_
     // Trim open popup stack
     ImGuiPopupData prev_popup = g.OpenPopupStack[remaining];
     g.OpenPopupStack.resize(remaining);
+    RequestRedrawEx(0.0f, "ClosePopup()");
 
     // Restore focus (unless popup window was not yet submitted, and didn't have a chance to take focus anyhow. See #7325 for an edge case)
     if (restore_focus_to_window_under_popup && prev_popup.Window)
@@ -12680,6 +13599,8 @@ void ImGui::BringWindowToDisplayBehind(ImGuiWindow* window, ImGuiWindow* behind_
 int ImGui::FindWindowDisplayIndex(ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
+    if (window->DisplayOrder < g.Windows.Size && g.Windows[window->DisplayOrder] == window) // Order stored by NewFrame() is still valid if nothing was brought to front since.
+        return window->DisplayOrder;
     return g.Windows.index_from_ptr(g.Windows.find(window));
 }
 
@@ -12886,27 +13807,11 @@ static float inline NavScoreItemDistInterval(float cand_min, float cand_max, flo
     return 0.0f;
 }
 
-// Scoring function for keyboard/gamepad directional navigation. Based on https://gist.github.com/rygorous/6981057
-static bool ImGui::NavScoreItem(ImGuiNavItemData* result, const ImRect& nav_bb)
+// Compute distances between a candidate rectangle and the current scoring rectangle, and which quadrant of the latter the candidate lies in.
+// 'cand_id' is only used to break ties between overlapping rectangles with same center.
+static void NavScoreItemCalcDistances(const ImRect& cand, const ImRect& curr, ImGuiID cand_id, ImGuiNavItemDistances* out)
 {
     ImGuiContext& g = *GImGui;
-    ImGuiWindow* window = g.CurrentWindow;
-    if (g.NavLayer != window->DC.NavLayerCurrent)
-        return false;
-
-    // FIXME: Those are not good variables names
-    ImRect cand = nav_bb;                   // Current item nav rectangle
-    const ImRect curr = g.NavScoringRect;   // Current modified source rect (NB: we've applied Max.x = Min.x in NavUpdate() to inhibit the effect of having varied item width)
-    g.NavScoringDebugCount++;
-
-    // When entering through a NavFlattened border, we consider child window items as fully clipped for scoring
-    if (window->ParentWindow == g.NavWindow)
-    {
-        IM_ASSERT((window->ChildFlags | g.NavWindow->ChildFlags) & ImGuiChildFlags_NavFlattened);
-        if (!window->ClipRect.Overlaps(cand))
-            return false;
-        cand.ClipWithFull(window->ClipRect); // This allows the scored item to not overlap other candidates in the parent window
-    }
 
     // Compute distance between boxes
     // FIXME-NAV: Introducing biases for vertical navigation, needs to be removed.
@@ -12946,67 +13851,52 @@ static bool ImGui::NavScoreItem(ImGuiNavItemData* result, const ImRect& nav_bb)
     else
     {
         // Degenerate case: two overlapping buttons with same center, break ties arbitrarily (note that LastItemId here is really the _previous_ item order, but it doesn't matter)
-        quadrant = (g.LastItemData.ID < g.NavId) ? ImGuiDir_Left : ImGuiDir_Right;
+        quadrant = (cand_id < g.NavId) ? ImGuiDir_Left : ImGuiDir_Right;
     }
 
+    out->DeltaBoxX = dbx;
+    out->DeltaBoxY = dby;
+    out->DeltaCenterX = dcx;
+    out->DeltaCenterY = dcy;
+    out->DeltaAxialX = dax;
+    out->DeltaAxialY = day;
+    out->DistBox = dist_box;
+    out->DistCenter = dist_center;
+    out->DistAxial = dist_axial;
+    out->Quadrant = quadrant;
+}
+
+// Return true if candidate is the new best candidate for current move request, and update 'result' distances.
+static bool NavScoreItemUpdateResult(ImGuiNavItemData* result, const ImGuiNavItemDistances& d)
+{
+    ImGuiContext& g = *GImGui;
     const ImGuiDir move_dir = g.NavMoveDir;
-#if IMGUI_DEBUG_NAV_SCORING
-    char buf[200];
-    if (g.IO.KeyCtrl) // Hold CTRL to preview score in matching quadrant. CTRL+Arrow to rotate.
-    {
-        if (quadrant == move_dir)
-        {
-            ImFormatString(buf, IM_ARRAYSIZE(buf), "%.0f/%.0f", dist_box, dist_center);
-            ImDrawList* draw_list = GetForegroundDrawList(window);
-            draw_list->AddRectFilled(cand.Min, cand.Max, IM_COL32(255, 0, 0, 80));
-            draw_list->AddRectFilled(cand.Min, cand.Min + CalcTextSize(buf), IM_COL32(255, 0, 0, 200));
-            draw_list->AddText(cand.Min, IM_COL32(255, 255, 255, 255), buf);
-        }
-    }
-    const bool debug_hovering = IsMouseHoveringRect(cand.Min, cand.Max);
-    const bool debug_tty = (g.IO.KeyCtrl && IsKeyPressed(ImGuiKey_Space));
-    if (debug_hovering || debug_tty)
-    {
-        ImFormatString(buf, IM_ARRAYSIZE(buf),
-            "d-box    (%7.3f,%7.3f) -> %7.3f\nd-center (%7.3f,%7.3f) -> %7.3f\nd-axial  (%7.3f,%7.3f) -> %7.3f\nnav %c, quadrant %c",
-            dbx, dby, dist_box, dcx, dcy, dist_center, dax, day, dist_axial, "-WENS"[move_dir+1], "-WENS"[quadrant+1]);
-        if (debug_hovering)
-        {
-            ImDrawList* draw_list = GetForegroundDrawList(window);
-            draw_list->AddRect(curr.Min, curr.Max, IM_COL32(255, 200, 0, 100));
-            draw_list->AddRect(cand.Min, cand.Max, IM_COL32(255, 255, 0, 200));
-            draw_list->AddRectFilled(cand.Max - ImVec2(4, 4), cand.Max + CalcTextSize(buf) + ImVec2(4, 4), IM_COL32(40, 0, 0, 200));
-            draw_list->AddText(cand.Max, ~0U, buf);
-        }
-        if (debug_tty) { IMGUI_DEBUG_LOG_NAV("id 0x%08X\n%s\n", g.LastItemData.ID, buf); }
-    }
-#endif
 
     // Is it in the quadrant we're interested in moving to?
     bool new_best = false;
-    if (quadrant == move_dir)
+    if (d.Quadrant == move_dir)
     {
         // Does it beat the current best candidate?
-        if (dist_box < result->DistBox)
+        if (d.DistBox < result->DistBox)
         {
-            result->DistBox = dist_box;
-            result->DistCenter = dist_center;
+            result->DistBox = d.DistBox;
+            result->DistCenter = d.DistCenter;
             return true;
         }
-        if (dist_box == result->DistBox)
+        if (d.DistBox == result->DistBox)
         {
             // Try using distance between center points to break ties
-            if (dist_center < result->DistCenter)
+            if (d.DistCenter < result->DistCenter)
             {
-                result->DistCenter = dist_center;
+                result->DistCenter = d.DistCenter;
                 new_best = true;
             }
-            else if (dist_center == result->DistCenter)
+            else if (d.DistCenter == result->DistCenter)
             {
                 // Still tied! we need to be extra-careful to make sure everything gets linked properly. We consistently break ties by symbolically moving "later" items
                 // (with higher index) to the right/downwards by an infinitesimal amount since we the current "best" button already (so it must have a lower index),
                 // this is fairly easy. This rule ensures that all buttons with dx==dy==0 will end up being linked in order of appearance along the x axis.
-                if (((move_dir == ImGuiDir_Up || move_dir == ImGuiDir_Down) ? dby : dbx) < 0.0f) // moving bj to the right/down decreases distance
+                if (((move_dir == ImGuiDir_Up || move_dir == ImGuiDir_Down) ? d.DeltaBoxY : d.DeltaBoxX) < 0.0f) // moving bj to the right/down decreases distance
                     new_best = true;
             }
         }
@@ -13017,17 +13907,78 @@ static bool ImGui::NavScoreItem(ImGuiNavItemData* result, const ImRect& nav_bb)
     // This is just to avoid buttons having no links in a particular direction when there's a suitable neighbor. you get good graphs without this too.
     // 2017/09/29: FIXME: This now currently only enabled inside menu bars, ideally we'd disable it everywhere. Menus in particular need to catch failure. For general navigation it feels awkward.
     // Disabling it may lead to disconnected graphs when nodes are very spaced out on different axis. Perhaps consider offering this as an option?
-    if (result->DistBox == FLT_MAX && dist_axial < result->DistAxial)  // Check axial match
+    if (result->DistBox == FLT_MAX && d.DistAxial < result->DistAxial)  // Check axial match
         if (g.NavLayer == ImGuiNavLayer_Menu && !(g.NavWindow->Flags & ImGuiWindowFlags_ChildMenu))
-            if ((move_dir == ImGuiDir_Left && dax < 0.0f) || (move_dir == ImGuiDir_Right && dax > 0.0f) || (move_dir == ImGuiDir_Up && day < 0.0f) || (move_dir == ImGuiDir_Down && day > 0.0f))
+            if ((move_dir == ImGuiDir_Left && d.DeltaAxialX < 0.0f) || (move_dir == ImGuiDir_Right && d.DeltaAxialX > 0.0f) || (move_dir == ImGuiDir_Up && d.DeltaAxialY < 0.0f) || (move_dir == ImGuiDir_Down && d.DeltaAxialY > 0.0f))
             {
-                result->DistAxial = dist_axial;
+                result->DistAxial = d.DistAxial;
                 new_best = true;
             }
 
     return new_best;
 }
 
+// Scoring function for keyboard/gamepad directional navigation. Based on https://gist.github.com/rygorous/6981057
+static bool ImGui::NavScoreItem(ImGuiNavItemData* result, const ImRect& nav_bb)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    if (g.NavLayer != window->DC.NavLayerCurrent)
+        return false;
+
+    // FIXME: Those are not good variables names
+    ImRect cand = nav_bb;                   // Current item nav rectangle
+    const ImRect curr = g.NavScoringRect;   // Current modified source rect (NB: we've applied Max.x = Min.x in NavUpdate() to inhibit the effect of having varied item width)
+    g.NavScoringDebugCount++;
+
+    // When entering through a NavFlattened border, we consider child window items as fully clipped for scoring
+    if (window->ParentWindow == g.NavWindow)
+    {
+        IM_ASSERT((window->ChildFlags | g.NavWindow->ChildFlags) & ImGuiChildFlags_NavFlattened);
+        if (!window->ClipRect.Overlaps(cand))
+            return false;
+        cand.ClipWithFull(window->ClipRect); // This allows the scored item to not overlap other candidates in the parent window
+    }
+
+    ImGuiNavItemDistances d;
+    NavScoreItemCalcDistances(cand, curr, g.LastItemData.ID, &d);
+
+#if IMGUI_DEBUG_NAV_SCORING
+    const ImGuiDir move_dir = g.NavMoveDir;
+    char buf[200];
+    if (g.IO.KeyCtrl) // Hold CTRL to preview score in matching quadrant. CTRL+Arrow to rotate.
+    {
+        if (d.Quadrant == move_dir)
+        {
+            ImFormatString(buf, IM_ARRAYSIZE(buf), "%.0f/%.0f", d.DistBox, d.DistCenter);
+            ImDrawList* draw_list = GetForegroundDrawList(window);
+            draw_list->AddRectFilled(cand.Min, cand.Max, IM_COL32(255, 0, 0, 80));
+            draw_list->AddRectFilled(cand.Min, cand.Min + CalcTextSize(buf), IM_COL32(255, 0, 0, 200));
+            draw_list->AddText(cand.Min, IM_COL32(255, 255, 255, 255), buf);
+        }
+    }
+    const bool debug_hovering = IsMouseHoveringRect(cand.Min, cand.Max);
+    const bool debug_tty = (g.IO.KeyCtrl && IsKeyPressed(ImGuiKey_Space));
+    if (debug_hovering || debug_tty)
+    {
+        ImFormatString(buf, IM_ARRAYSIZE(buf),
+            "d-box    (%7.3f,%7.3f) -> %7.3f\nd-center (%7.3f,%7.3f) -> %7.3f\nd-axial  (%7.3f,%7.3f) -> %7.3f\nnav %c, quadrant %c",
+            d.DeltaBoxX, d.DeltaBoxY, d.DistBox, d.DeltaCenterX, d.DeltaCenterY, d.DistCenter, d.DeltaAxialX, d.DeltaAxialY, d.DistAxial, "-WENS"[move_dir+1], "-WENS"[d.Quadrant+1]);
+        if (debug_hovering)
+        {
+            ImDrawList* draw_list = GetForegroundDrawList(window);
+            draw_list->AddRect(curr.Min, curr.Max, IM_COL32(255, 200, 0, 100));
+            draw_list->AddRect(cand.Min, cand.Max, IM_COL32(255, 255, 0, 200));
+            draw_list->AddRectFilled(cand.Max - ImVec2(4, 4), cand.Max + CalcTextSize(buf) + ImVec2(4, 4), IM_COL32(40, 0, 0, 200));
+            draw_list->AddText(cand.Max, ~0U, buf);
+        }
+        if (debug_tty) { IMGUI_DEBUG_LOG_NAV("id 0x%08X\n%s\n", g.LastItemData.ID, buf); }
+    }
+#endif
+
+    return NavScoreItemUpdateResult(result, d);
+}
+
 static void ImGui::NavApplyItemToResult(ImGuiNavItemData* result)
 {
     ImGuiContext& g = *GImGui;
@@ -13097,18 +14048,23 @@ static void ImGui::NavProcessItem()
             {
                 NavProcessItemForTabbingRequest(id, item_flags, g.NavMoveFlags);
             }
-            else if (g.NavId != id || (g.NavMoveFlags & ImGuiNavMoveFlags_AllowCurrentNavId))
+            else
             {
-                ImGuiNavItemData* result = (window == g.NavWindow) ? &g.NavMoveResultLocal : &g.NavMoveResultOther;
-                if (NavScoreItem(result, nav_bb))
-                    NavApplyItemToResult(result);
-
-                // Features like PageUp/PageDown need to maintain a separate score for the visible set of items.
-                const float VISIBLE_RATIO = 0.70f;
-                if ((g.NavMoveFlags & ImGuiNavMoveFlags_AlsoScoreVisibleSet) && window->ClipRect.Overlaps(nav_bb))
-                    if (ImClamp(nav_bb.Max.y, window->ClipRect.Min.y, window->ClipRect.Max.y) - ImClamp(nav_bb.Min.y, window->ClipRect.Min.y, window->ClipRect.Max.y) >= (nav_bb.Max.y - nav_bb.Min.y) * VISIBLE_RATIO)
-                        if (NavScoreItem(&g.NavMoveResultLocalVisible, nav_bb))
-                            NavApplyItemToResult(&g.NavMoveResultLocalVisible);
+                // In NavWindow, skip scoring items which can't beat the best candidate found from last move request (see ImGuiNavMoveCandidates)
+                const bool skip_scoring = (window == g.NavWindow) && NavMoveCandidatesProcessItem(id, item_flags, nav_bb);
+                if (!skip_scoring && (g.NavId != id || (g.NavMoveFlags & ImGuiNavMoveFlags_AllowCurrentNavId)))
+                {
+                    ImGuiNavItemData* result = (window == g.NavWindow) ? &g.NavMoveResultLocal : &g.NavMoveResultOther;
+                    if (NavScoreItem(result, nav_bb))
+                        NavApplyItemToResult(result);
+
+                    // Features like PageUp/PageDown need to maintain a separate score for the visible set of items.
+                    const float VISIBLE_RATIO = 0.70f;
+                    if ((g.NavMoveFlags & ImGuiNavMoveFlags_AlsoScoreVisibleSet) && window->ClipRect.Overlaps(nav_bb))
+                        if (ImClamp(nav_bb.Max.y, window->ClipRect.Min.y, window->ClipRect.Max.y) - ImClamp(nav_bb.Min.y, window->ClipRect.Min.y, window->ClipRect.Max.y) >= (nav_bb.Max.y - nav_bb.Min.y) * VISIBLE_RATIO)
+                            if (NavScoreItem(&g.NavMoveResultLocalVisible, nav_bb))
+                                NavApplyItemToResult(&g.NavMoveResultLocalVisible);
+                }
             }
         }
     }
@@ -13131,6 +14087,255 @@ static void ImGui::NavProcessItem()
     }
 }
 
+// Directional move request in NavWindow: record candidates, and skip scoring those which can't win. See ImGuiNavMoveCandidates for details.
+// Return true when NavScoreItem() doesn't need to be called for this item.
+static bool ImGui::NavMoveCandidatesProcessItem(ImGuiID id, ImGuiItemFlags item_flags, const ImRect& nav_bb)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGuiNavMoveCandidates* nc = &g.NavMoveCandidates;
+    if (nc->State == 0)
+        NavMoveCandidatesBegin(window);
+    if (nc->State == 3)
+        return false;
+    if (nc->Window != window || nc->NavLayer != g.NavLayer || nc->NavId != g.NavId) // e.g. NavWindow changed during the frame
+    {
+        NavMoveCandidatesFlush();
+        nc->State = 3;
+        return false;
+    }
+
+    // Items of other layers are not scored (e.g. title bar buttons, which don't move when scrolling)
+    if (window->DC.NavLayerCurrent != nc->NavLayer)
+        return false;
+
+    const ImRect& nav_rect = g.LastItemData.NavRect;
+    if (nc->State == 1)
+    {
+        // Same item as last move request?
+        if (nc->Cursor < nc->Items.Size)
+        {
+            const ImGuiNavMoveCandidate* prev = &nc->Items[nc->Cursor];
+            const ImVec2 delta = nc->Delta;
+            if (prev->ID == id && prev->Rect.Min + delta == nav_bb.Min && prev->Rect.Max + delta == nav_bb.Max
+                && prev->NavRect.Min + delta == nav_rect.Min && prev->NavRect.Max + delta == nav_rect.Max
+                && prev->FocusScopeId == g.CurrentFocusScopeId && prev->ItemFlags == item_flags
+                && ((item_flags & ImGuiItemFlags_HasSelectionUserData) == 0 || prev->SelectionUserData == g.NextItemData.SelectionUserData))
+            {
+                if (nc->Cursor++ != nc->BestIndex)
+                    return true;
+                nc->BestReached = true;
+                return false;
+            }
+        }
+        NavMoveCandidatesFlush(); // Score skipped items if needed, record from now on
+    }
+
+    nc->ItemsNext.resize(nc->ItemsNext.Size + 1);
+    ImGuiNavMoveCandidate* item = &nc->ItemsNext.back();
+    item->ID = id;
+    item->FocusScopeId = g.CurrentFocusScopeId;
+    item->ItemFlags = item_flags;
+    item->Rect = nav_bb;
+    item->NavRect = nav_rect;
+    item->SelectionUserData = (item_flags & ImGuiItemFlags_HasSelectionUserData) ? g.NextItemData.SelectionUserData : ImGuiSelectionUserData_Invalid;
+    return false;
+}
+
+static int IMGUI_CDECL NavMoveCandidateComparerByMinY(const void* lhs, const void* rhs)
+{
+    const ImVector<ImGuiNavMoveCandidate>& items = GImGui->NavMoveCandidates.Items;
+    const int lhs_n = *(const int*)lhs;
+    const int rhs_n = *(const int*)rhs;
+    const float lhs_y = items[lhs_n].Rect.Min.y;
+    const float rhs_y = items[rhs_n].Rect.Min.y;
+    if (lhs_y != rhs_y)
+        return (lhs_y < rhs_y) ? -1 : +1;
+    return lhs_n - rhs_n;
+}
+
+static inline bool NavMoveCandidateIsScored(const ImGuiNavMoveCandidates* nc, const ImGuiNavMoveCandidate* cand)
+{
+    ImGuiContext& g = *GImGui;
+    return cand->ID != nc->NavId || (g.NavMoveFlags & ImGuiNavMoveFlags_AllowCurrentNavId);
+}
+
+// Called on first item of NavWindow reaching scoring: find which candidate of last move request would win this one.
+static void ImGui::NavMoveCandidatesBegin(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiNavMoveCandidates* nc = &g.NavMoveCandidates;
+    nc->Window = window;
+    nc->NavLayer = g.NavLayer;
+    nc->NavId = g.NavId;
+    nc->OffsetNext = window->DC.CursorStartPos;
+    nc->ItemsNext.resize(0);
+    nc->Cursor = 0;
+    nc->BestIndex = -1;
+    nc->BestReached = false;
+
+    // Menu layer uses axial scoring, PageUp/PageDown use a second result: just record.
+    const bool can_skip = !IMGUI_DEBUG_NAV_SCORING && nc->WindowID == window->ID && nc->ItemsNavLayer == g.NavLayer && nc->Items.Size > 0 && g.NavLayer == ImGuiNavLayer_Main && (g.NavMoveFlags & ImGuiNavMoveFlags_AlsoScoreVisibleSet) == 0;
+    if (!can_skip)
+    {
+        nc->State = 2;
+        return;
+    }
+    nc->State = 1;
+    nc->Delta = window->DC.CursorStartPos - nc->Offset;
+
+    // Visit candidates by increasing vertical gap to scoring rectangle, as it is a lower bound of box distance.
+    // Going downward the gap is exact. Going upward, we only know candidates bottom is at most MaxHeight below their top.
+    const ImRect curr = g.NavScoringRect;
+    const float curr_y1 = ImLerp(curr.Min.y, curr.Max.y, 0.2f); // Same as NavScoreItemCalcDistances()
+    const float curr_y2 = ImLerp(curr.Min.y, curr.Max.y, 0.8f);
+    const float slack = 1.0f; // Bounds are computed differently from distances: absorb rounding errors
+    const int count = nc->Items.Size;
+    const int* sorted = nc->SortedByMinY.Size > 0 ? nc->SortedByMinY.Data : NULL;
+    int below = 0, below_end = count;
+    while (below < below_end)
+    {
+        const int mid = (below + below_end) >> 1;
+        if (nc->Items[sorted ? sorted[mid] : mid].Rect.Min.y + nc->Delta.y > curr_y2)
+            below_end = mid;
+        else
+            below = mid + 1;
+    }
+    int above = below - 1;
+
+    // Keep lowest (DistBox, DistCenter), and for ties do the same as NavScoreItemUpdateResult() does in submission order:
+    // first candidate wins, unless later ones are moving right/down in which case the last of them wins.
+    float best_dist_box = FLT_MAX, best_dist_center = FLT_MAX;
+    int best_first = -1, best_last_tie = -1;
+    const bool move_vertical = (g.NavMoveDir == ImGuiDir_Up || g.NavMoveDir == ImGuiDir_Down);
+    while (below < count || above >= 0)
+    {
+        const float gap_below = (below < count) ? nc->Items[sorted ? sorted[below] : below].Rect.Min.y + nc->Delta.y - curr_y2 : FLT_MAX;
+        const float gap_above = (above >= 0) ? curr_y1 - (nc->Items[sorted ? sorted[above] : above].Rect.Min.y + nc->Delta.y + nc->MaxHeight) : FLT_MAX;
+        int n;
+        if (gap_below <= gap_above)
+        {
+            if (gap_below - slack > best_dist_box)
+                break;
+            n = sorted ? sorted[below] : below;
+            below++;
+        }
+        else
+        {
+            if (gap_above - slack > best_dist_box)
+                break;
+            n = sorted ? sorted[above] : above;
+            above--;
+        }
+
+        const ImGuiNavMoveCandidate* cand = &nc->Items[n];
+        if (!NavMoveCandidateIsScored(nc, cand))
+            continue;
+        ImGuiNavItemDistances d;
+        NavScoreItemCalcDistances(ImRect(cand->Rect.Min + nc->Delta, cand->Rect.Max + nc->Delta), curr, cand->ID, &d);
+        if (d.Quadrant != g.NavMoveDir)
+            continue;
+        const bool tie_wins = (move_vertical ? d.DeltaBoxY : d.DeltaBoxX) < 0.0f;
+        if (d.DistBox < best_dist_box || (d.DistBox == best_dist_box && d.DistCenter < best_dist_center))
+        {
+            best_dist_box = d.DistBox;
+            best_dist_center = d.DistCenter;
+            best_first = n;
+            best_last_tie = tie_wins ? n : -1;
+        }
+        else if (d.DistBox == best_dist_box && d.DistCenter == best_dist_center)
+        {
+            best_first = ImMin(best_first, n);
+            if (tie_wins)
+                best_last_tie = ImMax(best_last_tie, n);
+        }
+    }
+    nc->BestIndex = (best_last_tie != -1) ? best_last_tie : best_first;
+}
+
+// Stop skipping items: score items skipped so far (unless they can't win), then record next items.
+static void ImGui::NavMoveCandidatesFlush()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiNavMoveCandidates* nc = &g.NavMoveCandidates;
+    if (nc->State != 1)
+        return;
+
+    // When the predicted best candidate was reached, skipped items couldn't beat it. Otherwise score them in submission order.
+    if (nc->BestIndex != -1 && !nc->BestReached && g.NavMoveScoringItems)
+    {
+        ImGuiNavItemData* result = &g.NavMoveResultLocal;
+        ImGuiWindow* window = nc->Window;
+        for (int n = 0; n < nc->Cursor; n++)
+        {
+            const ImGuiNavMoveCandidate* cand = &nc->Items[n];
+            if (!NavMoveCandidateIsScored(nc, cand))
+                continue;
+            ImGuiNavItemDistances d;
+            NavScoreItemCalcDistances(ImRect(cand->Rect.Min + nc->Delta, cand->Rect.Max + nc->Delta), g.NavScoringRect, cand->ID, &d);
+            g.NavScoringDebugCount++;
+            if (!NavScoreItemUpdateResult(result, d))
+                continue;
+            // Same as NavApplyItemToResult()
+            result->Window = window;
+            result->ID = cand->ID;
+            result->FocusScopeId = cand->FocusScopeId;
+            result->ItemFlags = cand->ItemFlags;
+            result->RectRel = WindowRectAbsToRel(window, ImRect(cand->NavRect.Min + nc->Delta, cand->NavRect.Max + nc->Delta));
+            if (result->ItemFlags & ImGuiItemFlags_HasSelectionUserData)
+                result->SelectionUserData = cand->SelectionUserData;
+        }
+    }
+
+    // Record matched items, converted to current coordinates
+    nc->ItemsNext.resize(nc->Cursor);
+    for (int n = 0; n < nc->Cursor; n++)
+    {
+        ImGuiNavMoveCandidate* cand = &nc->ItemsNext[n];
+        *cand = nc->Items[n];
+        cand->Rect.Translate(nc->Delta);
+        cand->NavRect.Translate(nc->Delta);
+    }
+    nc->State = 2;
+}
+
+// Called by NavEndFrame(), before any use of move request result.
+static void ImGui::NavMoveCandidatesEndFrame()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiNavMoveCandidates* nc = &g.NavMoveCandidates;
+    if (nc->State == 1 && nc->Cursor < nc->Items.Size)
+        NavMoveCandidatesFlush(); // Less items than last time
+    if (nc->State == 2)
+    {
+        nc->Items.swap(nc->ItemsNext);
+        nc->ItemsNext.resize(0);
+        nc->WindowID = nc->Window->ID;
+        nc->ItemsNavLayer = nc->NavLayer;
+        nc->Offset = nc->OffsetNext;
+
+        // Build index (in the common case of items laid out from top to bottom, it is not needed)
+        bool is_sorted = true;
+        nc->MaxHeight = 0.0f;
+        for (int n = 0; n < nc->Items.Size; n++)
+        {
+            const ImRect& rect = nc->Items[n].Rect;
+            nc->MaxHeight = ImMax(nc->MaxHeight, rect.Max.y - rect.Min.y);
+            if (n > 0 && rect.Min.y < nc->Items[n - 1].Rect.Min.y)
+                is_sorted = false;
+        }
+        nc->SortedByMinY.resize(is_sorted ? 0 : nc->Items.Size);
+        if (!is_sorted)
+        {
+            for (int n = 0; n < nc->Items.Size; n++)
+                nc->SortedByMinY[n] = n;
+            ImQsort(nc->SortedByMinY.Data, (size_t)nc->SortedByMinY.Size, sizeof(int), NavMoveCandidateComparerByMinY);
+        }
+    }
+    nc->State = 0;
+    nc->Window = NULL;
+}
+
 // Handle "scoring" of an item for a tabbing/focusing request initiated by NavUpdateCreateTabbingRequest().
 // Note that SetKeyboardFocusHere() API calls are considered tabbing requests!
 // - Case 1: no nav/active id:    set result to first eligible item, stop storing.
@@ -13200,6 +14405,8 @@ void ImGui::NavProcessItemForTabbingRequest(ImGuiID id, ImGuiItemFlags item_flag
 bool ImGui::NavMoveRequestButNoResultYet()
 {
     ImGuiContext& g = *GImGui;
+    if (g.NavMoveCandidates.State == 1 && g.NavMoveCandidates.BestIndex != -1 && !g.NavMoveCandidates.BestReached)
+        NavMoveCandidatesFlush(); // Skipped items may have been a result
     return g.NavMoveScoringItems && g.NavMoveResultLocal.ID == 0 && g.NavMoveResultOther.ID == 0;
 }
 
@@ -13224,6 +14431,8 @@ void ImGui::NavMoveRequestSubmit(ImGuiDir move_dir, ImGuiDir clip_dir, ImGuiNavM
     g.NavMoveResultLocal.Clear();
     g.NavMoveResultLocalVisible.Clear();
     g.NavMoveResultOther.Clear();
+    if (g.NavMoveCandidates.State != 0)
+        g.NavMoveCandidates.State = 3; // New request during the frame: stop skipping and recording
     g.NavTabbingCounter = 0;
     g.NavTabbingResultFirst.Clear();
     NavUpdateAnyRequestFlag();
@@ -14061,6 +15270,7 @@ static float ImGui::NavUpdatePageUpPageDown()
 static void ImGui::NavEndFrame()
 {
     ImGuiContext& g = *GImGui;
+    NavMoveCandidatesEndFrame();
 
     // Show CTRL+TAB list window
     if (g.NavWindowingTarget != NULL)
@@ -15720,6 +16930,168 @@ static void Platform_SetImeDataFn_DefaultImpl(ImGuiContext*, ImGuiViewport*, ImG
 
 #endif // Default IME handlers
 
+//-----------------------------------------------------------------------------
+// [SECTION] PROFILER
+//-----------------------------------------------------------------------------
+// - ProfilerGetTime() [Internal]
+// - ProfilerNewFrame() [Internal]
+// - ProfilerZoneBegin() [Internal]
+// - ProfilerZoneEnd() [Internal]
+// - ProfilerStartCapture() [Internal]
+// - ProfilerExportChromeTrace() [Internal]
+// - ProfilerExportChromeTraceToFile() [Internal]
+//-----------------------------------------------------------------------------
+// Built-in hierarchical frame profiler, compiled out unless IMGUI_ENABLE_PROFILER is defined.
+// Zones are recorded with the IMGUI_PROFILER_XXX macros in hot paths of the library, they are cheap when recording is disabled (one test).
+// Enable recording and browse results in 'Metrics->Profiler'. Captures can be exported to the Chrome trace JSON format,
+// which can be opened with chrome://tracing or https://ui.perfetto.dev
+//-----------------------------------------------------------------------------
+
+#ifdef IMGUI_ENABLE_PROFILER
+
+ImGuiProfilerScope::ImGuiProfilerScope(const char* name)
+{
+    Name = name;
+    ImGui::ProfilerZoneBegin(name);
+}
+
+ImGuiProfilerScope::~ImGuiProfilerScope()
+{
+    ImGui::ProfilerZoneEnd(Name);
+}
+
+ImU64 ImGui::ProfilerGetTime()
+{
+    return (ImU64)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Called at the very beginning of NewFrame(): retire zones of the previous frame and latch enabled state.
+void ImGui::ProfilerNewFrame()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.Profiler;
+    if (profiler->ZonesStack.Size > 0)
+    {
+        // Close zones left open (e.g. zones recorded outside of NewFrame()..Render())
+        const ImU64 time = ProfilerGetTime();
+        for (int idx : profiler->ZonesStack)
+        {
+            profiler->Zones[idx].TimeEnd = time;
+            profiler->Zones[idx].SubtreeEnd = profiler->Zones.Size;
+        }
+        profiler->ZonesStack.resize(0);
+    }
+    if (profiler->EnabledThisFrame && profiler->CaptureFramesLeft > 0)
+    {
+        const int base_idx = profiler->CaptureZones.Size;
+        for (const ImGuiProfilerZone& zone : profiler->Zones)
+        {
+            profiler->CaptureZones.push_back(zone);
+            ImGuiProfilerZone& dst = profiler->CaptureZones.back();
+            dst.ParentIdx = (zone.ParentIdx != -1) ? zone.ParentIdx + base_idx : -1;
+            dst.SubtreeEnd += base_idx;
+        }
+        profiler->CaptureFramesLeft--;
+    }
+    profiler->ZonesLastFrame.swap(profiler->Zones);
+    profiler->Zones.resize(0);
+    profiler->EnabledThisFrame = profiler->Enabled || profiler->CaptureFramesLeft > 0;
+}
+
+// May be called from ImDrawList/ImFont functions which can operate without a context, or outside of NewFrame()/Render().
+void ImGui::ProfilerZoneBegin(const char* name, ImGuiWindow* window)
+{
+    ImGuiContext* ctx = GImGui;
+    if (ctx == NULL || !ctx->Profiler.EnabledThisFrame)
+        return;
+    ImGuiProfiler* profiler = &ctx->Profiler;
+    ImGuiProfilerZone zone;
+    zone.Name = name;
+    zone.Window = window;
+    zone.TimeEnd = 0;
+    zone.ParentIdx = profiler->ZonesStack.Size > 0 ? profiler->ZonesStack.back() : -1;
+    zone.SubtreeEnd = profiler->Zones.Size + 1;
+    zone.FrameCount = ctx->FrameCount;
+    profiler->ZonesStack.push_back(profiler->Zones.Size);
+    profiler->Zones.push_back(zone);
+    profiler->Zones.back().TimeBegin = ProfilerGetTime(); // Read timer last to exclude our own overhead.
+}
+
+void ImGui::ProfilerZoneEnd(const char* name)
+{
+    ImGuiContext* ctx = GImGui;
+    if (ctx == NULL || !ctx->Profiler.EnabledThisFrame)
+        return;
+    const ImU64 time_end = ProfilerGetTime();
+    ImGuiProfiler* profiler = &ctx->Profiler;
+    if (profiler->ZonesStack.Size == 0)
+        return;
+    ImGuiProfilerZone* zone = &profiler->Zones[profiler->ZonesStack.back()];
+    const bool name_match = (zone->Name == name) || strcmp(zone->Name, name) == 0; // Identical literals are not guaranteed to be merged.
+    IM_ASSERT(name_match && "Mismatching IMGUI_PROFILER_ZONE_BEGIN()/IMGUI_PROFILER_ZONE_END() calls!");
+    if (!name_match)
+        return;
+    zone->TimeEnd = time_end;
+    zone->SubtreeEnd = profiler->Zones.Size;
+    profiler->ZonesStack.pop_back();
+}
+
+void ImGui::ProfilerStartCapture(int frames_count)
+{
+    ImGuiContext& g = *GImGui;
+    g.Profiler.CaptureZones.resize(0);
+    g.Profiler.CaptureFramesLeft = ImMax(frames_count, 0);
+}
+
+static void ProfilerAppendJsonString(ImGuiTextBuffer* buf, const char* str)
+{
+    buf->append("\"");
+    for (const char* p = str; *p; p++)
+    {
+        const unsigned char c = (unsigned char)*p;
+        if (c == '"' || c == '\\')
+            buf->appendf("\\%c", c);
+        else if (c < 0x20)
+            buf->appendf("\\u%04x", c);
+        else
+            buf->append(p, p + 1);
+    }
+    buf->append("\"");
+}
+
+// Export zones in Chrome trace JSON format ("Complete" events, timestamps in microseconds)
+void ImGui::ProfilerExportChromeTrace(ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.Profiler;
+    const ImVector<ImGuiProfilerZone>& zones = (profiler->CaptureZones.Size > 0) ? profiler->CaptureZones : profiler->ZonesLastFrame;
+    const ImU64 time_origin = (zones.Size > 0) ? zones[0].TimeBegin : 0;
+    buf->append("{\"traceEvents\":[\n");
+    for (int n = 0; n < zones.Size; n++)
+    {
+        const ImGuiProfilerZone& zone = zones[n];
+        buf->append("{\"name\":");
+        ProfilerAppendJsonString(buf, zone.Name);
+        buf->appendf(",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%d}}%s\n",
+            zone.Window ? "window" : "imgui", (double)(zone.TimeBegin - time_origin) / 1000.0, (double)(zone.TimeEnd - zone.TimeBegin) / 1000.0, zone.FrameCount, (n + 1 < zones.Size) ? "," : "");
+    }
+    buf->append("],\"displayTimeUnit\":\"ms\"}\n");
+}
+
+bool ImGui::ProfilerExportChromeTraceToFile(const char* filename)
+{
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (f == NULL)
+        return false;
+    ImGuiTextBuffer buf;
+    ProfilerExportChromeTrace(&buf);
+    const bool ret = ImFileWrite(buf.c_str(), sizeof(char), (ImU64)buf.size(), f) == (ImU64)buf.size();
+    ImFileClose(f);
+    return ret;
+}
+
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
 //-----------------------------------------------------------------------------
 // [SECTION] METRICS/DEBUGGER WINDOW
 //-----------------------------------------------------------------------------
@@ -15739,6 +17111,7 @@ static void Platform_SetImeDataFn_DefaultImpl(ImGuiContext*, ImGuiViewport*, ImG
 // - DebugNodeDrawCmdShowMeshAndBoundingBox() [Internal]
 // - DebugNodeFont() [Internal]
 // - DebugNodeFontGlyph() [Internal]
+// - DebugNodeProfiler() [Internal]
 // - DebugNodeStorage() [Internal]
 // - DebugNodeTabBar() [Internal]
 // - DebugNodeViewport() [Internal]
@@ -16068,6 +17441,22 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
     const int discarded_surface_sqrt = (int)sqrtf((float)atlas->Builder->RectsDiscardedSurface);
     Text("Packed rects: %d, area: about %d px ~%dx%d px", atlas->Builder->RectsPackedCount, atlas->Builder->RectsPackedSurface, packed_surface_sqrt, packed_surface_sqrt);
     Text("incl. Discarded rects: %d, area: about %d px ~%dx%d px", atlas->Builder->RectsDiscardedCount, atlas->Builder->RectsDiscardedSurface, discarded_surface_sqrt, discarded_surface_sqrt);
+    if (atlas->Flags & ImFontAtlasFlags_TexturePages)
+        Text("Texture pages: %d, current: %d, released: %d", atlas->Builder->PagesCount, atlas->Builder->PagesCurrent, atlas->Builder->PagesReleasedCount);
+    if (atlas->BakedMemoryBudget > 0)
+        Text("Baked fonts memory: %d KB / budget %d KB (%.0f%%), evicted: %d", atlas->Builder->BakedMemoryUsage / 1024, atlas->BakedMemoryBudget / 1024, atlas->Builder->BakedMemoryUsage * 100.0f / atlas->BakedMemoryBudget, atlas->Builder->BakedEvictedCount);
+    else
+        Text("Baked fonts memory: %d KB (no budget)", atlas->Builder->BakedMemoryUsage / 1024);
+    if (atlas->Flags & ImFontAtlasFlags_SharedAcrossThreads)
+        Text("Shared across threads: %d deferred loads committed", atlas->Builder->DeferredLoadsCommitted);
+    if (atlas->Flags & ImFontAtlasFlags_TextLayoutCache)
+    {
+        ImFontAtlasBuilder* builder = atlas->Builder;
+        int runs_memory = builder->TextRuns.Capacity * (int)sizeof(ImFontTextRun);
+        runs_memory += builder->TextRunsText.Capacity + builder->TextRunsTextCompact.Capacity;
+        runs_memory += (builder->TextRunsQuads.Capacity + builder->TextRunsQuadsCompact.Capacity) * (int)sizeof(ImFontTextRunQuad);
+        Text("Text layout cache: %d runs, %d KB", builder->TextRuns.Size, runs_memory / 1024);
+    }
 
     ImFontAtlasRectId highlight_r_id = ImFontAtlasRectId_Invalid;
     if (TreeNode("Rects Index", "Rects Index (%d)", atlas->Builder->RectsPackedCount)) // <-- Use count of used rectangles
@@ -16081,14 +17470,17 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
                     ImFontAtlasRectId id = ImFontAtlasRectId_Make(atlas->Builder->RectsIndex.index_from_ptr(&entry), entry.Generation);
                     ImFontAtlasRect r = {};
                     atlas->GetCustomRect(id, &r);
+                    ImTextureData* r_tex = ImFontAtlasPageGetTexture(atlas, entry.PageIdx);
+                    r.uv0 = ImVec2((float)r.x / r_tex->Width, (float)r.y / r_tex->Height);
+                    r.uv1 = ImVec2((float)(r.x + r.w) / r_tex->Width, (float)(r.y + r.h) / r_tex->Height);
                     const char* buf;
-                    ImFormatStringToTempBuffer(&buf, NULL, "ID:%08X, used:%d, { w:%3d, h:%3d } { x:%4d, y:%4d }", id, entry.IsUsed, r.w, r.h, r.x, r.y);
+                    ImFormatStringToTempBuffer(&buf, NULL, "ID:%08X, used:%d, page:%d, { w:%3d, h:%3d } { x:%4d, y:%4d }", id, entry.IsUsed, entry.PageIdx, r.w, r.h, r.x, r.y);
                     TableNextColumn();
                     Selectable(buf);
                     if (IsItemHovered())
                         highlight_r_id = id;
                     TableNextColumn();
-                    Image(atlas->TexRef, ImVec2(r.w, r.h), r.uv0, r.uv1);
+                    Image(r_tex->GetTexRef(), ImVec2(r.w, r.h), r.uv0, r.uv1);
                 }
             EndTable();
         }
@@ -16099,13 +17491,17 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
     // Texture list
     // (ensure the last texture always use the same ID, so we can keep it open neatly)
     ImFontAtlasRect highlight_r;
+    ImTextureData* highlight_tex = NULL;
     if (highlight_r_id != ImFontAtlasRectId_Invalid)
+    {
         atlas->GetCustomRect(highlight_r_id, &highlight_r);
+        highlight_tex = ImFontAtlasPackGetRectTexture(atlas, highlight_r_id);
+    }
     for (int tex_n = 0; tex_n < atlas->TexList.Size; tex_n++)
     {
         if (tex_n == atlas->TexList.Size - 1)
             SetNextItemOpen(true, ImGuiCond_Once);
-        DebugNodeTexture(atlas->TexList[tex_n], atlas->TexList.Size - 1 - tex_n, (highlight_r_id != ImFontAtlasRectId_Invalid) ? &highlight_r : NULL);
+        DebugNodeTexture(atlas->TexList[tex_n], atlas->TexList.Size - 1 - tex_n, (highlight_tex == atlas->TexList[tex_n]) ? &highlight_r : NULL);
     }
 }
 
@@ -16135,7 +17531,7 @@ void ImGui::DebugNodeTexture(ImTextureData* tex, int int_id, const ImFontAtlasRe
         PopStyleVar();
 
         char texid_desc[30];
-        Text("Status = %s (%d), Format = %s (%d), UseColors = %d", ImTextureDataGetStatusName(tex->Status), tex->Status, ImTextureDataGetFormatName(tex->Format), tex->Format, tex->UseColors);
+        Text("Status = %s (%d), Format = %s (%d), UseColors = %d, UseSDF = %d", ImTextureDataGetStatusName(tex->Status), tex->Status, ImTextureDataGetFormatName(tex->Format), tex->Format, tex->UseColors, tex->UseSDF);
         Text("TexID = %s, BackendUserData = %p", FormatTextureRefForDebugDisplay(texid_desc, IM_ARRAYSIZE(texid_desc), tex->GetTexRef()), tex->BackendUserData);
         TreePop();
     }
@@ -16532,6 +17928,14 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         TreePop();
     }
 
+#ifdef IMGUI_ENABLE_PROFILER
+    if (TreeNode("Profiler"))
+    {
+        DebugNodeProfiler(&g.Profiler);
+        TreePop();
+    }
+#endif
+
     if (TreeNode("Inputs"))
     {
         Text("KEYBOARD/GAMEPAD/MOUSE KEYS");
@@ -16575,6 +17979,14 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             Unindent();
         }
 
+        if (ImGuiInputEventsPostQueue* post_queue = (ImGuiInputEventsPostQueue*)ImAtomicLoadPtr((void* volatile*)&g.InputEventsPostQueue))
+        {
+            Text("POSTED EVENTS");
+            Indent();
+            Text("Consumed: %u, Dropped: %u (capacity %d)", post_queue->DequeuePos, ImAtomicLoad(&post_queue->DroppedCount), IMGUI_INPUT_EVENTS_POSTED_CAPACITY);
+            Unindent();
+        }
+
         Text("KEY OWNERS");
         {
             Indent();
@@ -16665,6 +18077,23 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             SetItemTooltip("In window \"%s\"", FindWindowByID(focus_scope.WindowID)->Name);
         }
         Text("NavWindowingTarget: '%s'", g.NavWindowingTarget ? g.NavWindowingTarget->Name : "NULL");
+        Text("NavMoveCandidates: %d in 0x%08X%s", g.NavMoveCandidates.Items.Size, g.NavMoveCandidates.WindowID, g.NavMoveCandidates.SortedByMinY.Size > 0 ? " (sorted index)" : "");
+        Unindent();
+
+        Text("TEXT");
+        Indent();
+        const int text_size_memo_calls = g.TextSizeMemoHitsLastFrame + g.TextSizeMemoMissesLastFrame;
+        Text("CalcTextSize() memo: %d hits, %d misses (%.1f%% hit rate) last frame", g.TextSizeMemoHitsLastFrame, g.TextSizeMemoMissesLastFrame, text_size_memo_calls ? g.TextSizeMemoHitsLastFrame * 100.0f / text_size_memo_calls : 0.0f);
+        Text("CalcTextSize() memo: %d entries, %d KB", g.TextSizeMemoCount, g.TextSizeMemo.size_in_bytes() / 1024);
+        Unindent();
+
+        Text("REDRAW");
+        Indent();
+        if (g.IO.WantRedrawTimeout == FLT_MAX)
+            Text("io.WantRedraw: %d, io.WantRedrawTimeout: none", g.IO.WantRedraw);
+        else
+            Text("io.WantRedraw: %d, io.WantRedrawTimeout: %.3f sec", g.IO.WantRedraw, g.IO.WantRedrawTimeout);
+        Text("Reason: %s", g.WantRedrawDebugReasonLastFrame ? g.WantRedrawDebugReasonLastFrame : "none");
         Unindent();
 
         TreePop();
@@ -16856,7 +18285,7 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
         {
             ImVec2 triangle[3];
             for (int n = 0; n < 3; n++, idx_n++)
-                triangle[n] = vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n].pos;
+                triangle[n] = ImDrawVertGetPos(vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n]);
             total_area += ImTriangleArea(triangle[0], triangle[1], triangle[2]);
         }
 
@@ -16877,9 +18306,10 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
                 for (int n = 0; n < 3; n++, idx_i++)
                 {
                     const ImDrawVert& v = vtx_buffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
-                    triangle[n] = v.pos;
+                    const ImVec2 uv = ImDrawVertGetUV(v);
+                    triangle[n] = ImDrawVertGetPos(v);
                     buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                        (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                        (n == 0) ? "Vert:" : "     ", idx_i, triangle[n].x, triangle[n].y, uv.x, uv.y, v.col);
                 }
 
                 Selectable(buf, false);
@@ -16913,7 +18343,7 @@ void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList* out_draw_list, co
 
         ImVec2 triangle[3];
         for (int n = 0; n < 3; n++, idx_n++)
-            vtxs_rect.Add((triangle[n] = vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n].pos));
+            vtxs_rect.Add((triangle[n] = ImDrawVertGetPos(vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n])));
         if (show_mesh)
             out_draw_list->AddPolyline(triangle, 3, IM_COL32(255, 255, 0, 255), ImDrawFlags_Closed, 1.0f); // In yellow: mesh triangles
     }
@@ -17064,7 +18494,7 @@ void ImGui::DebugNodeFont(ImFont* font)
         if (baked->ContainerFont != font)
             continue;
         PushID(baked_n);
-        if (TreeNode("Glyphs", "Baked at { %.2fpx, d.%.2f }: %d glyphs%s", baked->Size, baked->RasterizerDensity, baked->Glyphs.Size, (baked->LastUsedFrame < atlas->Builder->FrameCount - 1) ? " *Unused*" : ""))
+        if (TreeNode("Glyphs", "Baked at { %.2fpx, d.%.2f }: %d glyphs%s%s", baked->Size, baked->RasterizerDensity, baked->Glyphs.Size, baked->UseSDF ? " (SDF)" : "", (baked->LastUsedFrame < atlas->Builder->FrameCount - 1) ? " *Unused*" : ""))
         {
             if (SmallButton("Load all"))
                 for (unsigned int base = 0; base <= IM_UNICODE_CODEPOINT_MAX; base++)
@@ -17154,10 +18584,181 @@ void ImGui::DebugNodeFontGlyph(ImFont* font, const ImFontGlyph* glyph)
     {
         ImTextureRect* r = ImFontAtlasPackGetRect(font->ContainerAtlas, glyph->PackId);
         Text("PackId: %d (%dx%d rect at %d,%d)", glyph->PackId, r->w, r->h, r->x, r->y);
+        if (glyph->PageIdx != 0)
+            Text("PageIdx: %d (Texture #%03d)", glyph->PageIdx, ImFontAtlasPageGetTexture(font->ContainerAtlas, glyph->PageIdx)->UniqueID);
     }
     Text("SourceIdx: %d", glyph->SourceIdx);
 }
 
+#ifdef IMGUI_ENABLE_PROFILER
+struct ImGuiProfilerStats
+{
+    const char*     Name;
+    ImGuiWindow*    Window;
+    int             Count;
+    ImU64           TimeTotal;
+    ImU64           TimeSelf;
+    ImU64           TimeMax;
+};
+
+static int IMGUI_CDECL ProfilerStatsComparerByTimeTotal(const void* lhs, const void* rhs)
+{
+    const ImU64 lhs_v = ((const ImGuiProfilerStats*)lhs)->TimeTotal;
+    const ImU64 rhs_v = ((const ImGuiProfilerStats*)rhs)->TimeTotal;
+    return (lhs_v < rhs_v ? +1 : lhs_v > rhs_v ? -1 : 0);
+}
+
+static void DebugNodeProfilerStatsTable(const char* str_id, const char* name_header, ImVector<ImGuiProfilerStats>* stats)
+{
+    using namespace ImGui;
+    ImQsort(stats->Data, (size_t)stats->Size, sizeof(ImGuiProfilerStats), ProfilerStatsComparerByTimeTotal);
+    if (!BeginTable(str_id, 5, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit))
+        return;
+    TableSetupColumn(name_header, ImGuiTableColumnFlags_WidthStretch);
+    TableSetupColumn("Calls");
+    TableSetupColumn("Total ms");
+    TableSetupColumn("Self ms");
+    TableSetupColumn("Max ms");
+    TableHeadersRow();
+    for (const ImGuiProfilerStats& entry : *stats)
+    {
+        TableNextColumn();
+        TextUnformatted(entry.Name);
+        if (entry.Window && IsItemHovered())
+            GetForegroundDrawList()->AddRect(entry.Window->Pos, entry.Window->Pos + entry.Window->Size, IM_COL32(255, 255, 0, 255));
+        TableNextColumn(); Text("%d", entry.Count);
+        TableNextColumn(); Text("%.3f", (double)entry.TimeTotal / 1000000.0);
+        TableNextColumn(); Text("%.3f", (double)entry.TimeSelf / 1000000.0);
+        TableNextColumn(); Text("%.3f", (double)entry.TimeMax / 1000000.0);
+    }
+    EndTable();
+}
+
+static void DebugNodeProfilerZone(const ImVector<ImGuiProfilerZone>& zones, int zone_idx)
+{
+    using namespace ImGui;
+    const ImGuiProfilerZone& zone = zones[zone_idx];
+    const double zone_ms = (double)(zone.TimeEnd - zone.TimeBegin) / 1000000.0;
+    if (zone.SubtreeEnd == zone_idx + 1)
+    {
+        BulletText("%s%s: %.3f ms", zone.Window ? "Window " : "", zone.Name, zone_ms);
+        return;
+    }
+    if (!TreeNode((void*)(intptr_t)zone_idx, "%s%s: %.3f ms", zone.Window ? "Window " : "", zone.Name, zone_ms))
+        return;
+    for (int child_idx = zone_idx + 1; child_idx < zone.SubtreeEnd; )
+    {
+        // Merge consecutive leaves with same name (e.g. many RenderText calls) into a single line
+        const ImGuiProfilerZone& child = zones[child_idx];
+        int run_end = child_idx;
+        ImU64 run_time = 0;
+        while (run_end < zone.SubtreeEnd && zones[run_end].SubtreeEnd == run_end + 1 && zones[run_end].Name == child.Name)
+            run_time += zones[run_end].TimeEnd - zones[run_end].TimeBegin, run_end++;
+        if (run_end - child_idx > 1)
+        {
+            BulletText("%s (x%d): %.3f ms", child.Name, run_end - child_idx, (double)run_time / 1000000.0);
+            child_idx = run_end;
+            continue;
+        }
+        DebugNodeProfilerZone(zones, child_idx);
+        child_idx = child.SubtreeEnd;
+    }
+    TreePop();
+}
+
+// [DEBUG] Display built-in profiler state and last frame results (IMGUI_ENABLE_PROFILER)
+void ImGui::DebugNodeProfiler(ImGuiProfiler* profiler)
+{
+    Checkbox("Record", &profiler->Enabled);
+    SameLine();
+    MetricsHelpMarker("Record timing zones (NewFrame, Begin/End, tables, text rendering, Render...).\nChanges are applied on next frame.");
+
+    // Capture and export
+    if (profiler->CaptureFramesLeft > 0)
+    {
+        Text("Capturing... %d frames left.", profiler->CaptureFramesLeft);
+    }
+    else
+    {
+        SetNextItemWidth(GetFontSize() * 6.0f);
+        InputInt("##CaptureFrames", &profiler->CaptureFramesRequest);
+        SameLine();
+        if (Button("Capture frames"))
+            ProfilerStartCapture(profiler->CaptureFramesRequest);
+        SameLine();
+        Text("Captured: %d zones", profiler->CaptureZones.Size);
+    }
+    BeginDisabled(profiler->CaptureFramesLeft > 0 || (profiler->CaptureZones.Size == 0 && profiler->ZonesLastFrame.Size == 0));
+    if (Button("Export to 'imgui_trace.json'"))
+        ProfilerExportChromeTraceToFile("imgui_trace.json");
+    SameLine();
+    if (Button("Copy to clipboard"))
+    {
+        ImGuiTextBuffer buf;
+        ProfilerExportChromeTrace(&buf);
+        SetClipboardText(buf.c_str());
+    }
+    EndDisabled();
+    SameLine();
+    MetricsHelpMarker("Export capture (or last frame if there is no capture) in Chrome trace JSON format.\nOpen with chrome://tracing or https://ui.perfetto.dev");
+
+    const ImVector<ImGuiProfilerZone>& zones = profiler->ZonesLastFrame;
+    if (zones.Size == 0)
+        return;
+
+    // Aggregate last frame zones by name and by window
+    ImVector<ImU64> children_time;
+    children_time.resize(zones.Size);
+    memset(children_time.Data, 0, (size_t)children_time.size_in_bytes());
+    for (const ImGuiProfilerZone& zone : zones)
+        if (zone.ParentIdx != -1)
+            children_time[zone.ParentIdx] += zone.TimeEnd - zone.TimeBegin;
+    ImVector<ImGuiProfilerStats> stats_zones;
+    ImVector<ImGuiProfilerStats> stats_windows;
+    ImGuiStorage stats_zones_map;   // Hash of zone name pointer -> Index+1 in stats_zones[]
+    ImGuiStorage stats_windows_map; // Window ID -> Index+1 in stats_windows[]
+    ImU64 frame_time = 0;
+    for (int zone_idx = 0; zone_idx < zones.Size; zone_idx++)
+    {
+        const ImGuiProfilerZone& zone = zones[zone_idx];
+        const ImU64 zone_time = zone.TimeEnd - zone.TimeBegin;
+        if (zone.ParentIdx == -1)
+            frame_time += zone_time;
+        ImVector<ImGuiProfilerStats>& stats = zone.Window ? stats_windows : stats_zones;
+        int* p_stats_idx = zone.Window ? stats_windows_map.GetIntRef(zone.Window->ID, 0) : stats_zones_map.GetIntRef(ImHashData(&zone.Name, sizeof(zone.Name)), 0);
+        if (*p_stats_idx == 0)
+        {
+            ImGuiProfilerStats new_entry = { zone.Name, zone.Window, 0, 0, 0, 0 };
+            stats.push_back(new_entry);
+            *p_stats_idx = stats.Size;
+        }
+        ImGuiProfilerStats& entry = stats[*p_stats_idx - 1];
+        entry.Count++;
+        entry.TimeTotal += zone_time;
+        entry.TimeSelf += zone_time - children_time[zone_idx];
+        entry.TimeMax = ImMax(entry.TimeMax, zone_time);
+    }
+
+    Text("Last frame (%d): %d zones, %.3f ms in recorded root zones.", zones[0].FrameCount, zones.Size, (double)frame_time / 1000000.0);
+    if (TreeNodeEx("Zones", ImGuiTreeNodeFlags_DefaultOpen, "Zones (%d)", stats_zones.Size))
+    {
+        DebugNodeProfilerStatsTable("##zones", "Zone", &stats_zones);
+        TreePop();
+    }
+    if (TreeNodeEx("Windows", ImGuiTreeNodeFlags_DefaultOpen, "Windows (%d)", stats_windows.Size))
+    {
+        DebugNodeProfilerStatsTable("##windows", "Window", &stats_windows);
+        TreePop();
+    }
+    if (TreeNode("Hierarchy"))
+    {
+        for (int zone_idx = 0; zone_idx < zones.Size; zone_idx = zones[zone_idx].SubtreeEnd)
+            DebugNodeProfilerZone(zones, zone_idx);
+        TreePop();
+    }
+}
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
 // [DEBUG] Display contents of ImGuiStorage
 void ImGui::DebugNodeStorage(ImGuiStorage* storage, const char* label)
 {
@@ -17276,6 +18877,8 @@ void ImGui::DebugNodeWindow(ImGuiWindow* window, const char* label)
     BulletText("Scroll: (%.2f/%.2f,%.2f/%.2f) Scrollbar:%s%s", window->Scroll.x, window->ScrollMax.x, window->Scroll.y, window->ScrollMax.y, window->ScrollbarX ? "X" : "", window->ScrollbarY ? "Y" : "");
     BulletText("Active: %d/%d, WriteAccessed: %d, BeginOrderWithinContext: %d", window->Active, window->WasActive, window->WriteAccessed, (window->Active || window->WasActive) ? window->BeginOrderWithinContext : -1);
     BulletText("Appearing: %d, Hidden: %d (CanSkip %d Cannot %d), SkipItems: %d", window->Appearing, window->Hidden, window->HiddenFramesCanSkipItems, window->HiddenFramesCannotSkipItems, window->SkipItems);
+    if (flags & ImGuiWindowFlags_Retained)
+        BulletText("Retained: SkipRefresh: %d, RefreshFramesRequested: %d", window->SkipRefresh, window->RefreshFramesRequested);
     for (int layer = 0; layer < ImGuiNavLayer_COUNT; layer++)
     {
         ImRect r = window->NavRectRel[layer];
@@ -17820,6 +19423,9 @@ void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList*, const ImDrawList
 void ImGui::DebugNodeFont(ImFont*) {}
 void ImGui::DebugNodeFontGlyphesForSrcMask(ImFont*, ImFontBaked*, int) {}
 void ImGui::DebugNodeStorage(ImGuiStorage*, const char*) {}
+#ifdef IMGUI_ENABLE_PROFILER
+void ImGui::DebugNodeProfiler(ImGuiProfiler*) {}
+#endif
 void ImGui::DebugNodeTabBar(ImGuiTabBar*, const char*) {}
 void ImGui::DebugNodeWindow(ImGuiWindow*, const char*) {}
 void ImGui::DebugNodeWindowSettings(ImGuiWindowSettings*) {}
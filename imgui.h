@@ -168,7 +168,7 @@ struct ImDrawData;                  // All draw command lists required to render
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 12 bytes with IMGUI_USE_COMPACT_DRAWVERT. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontAtlasBuilder;          // Opaque storage for building a ImFontAtlas
@@ -478,6 +478,8 @@ namespace ImGui
     IMGUI_API void          SetWindowPos(const char* name, const ImVec2& pos, ImGuiCond cond = 0);      // set named window position.
     IMGUI_API void          SetWindowSize(const char* name, const ImVec2& size, ImGuiCond cond = 0);    // set named window size. set axis to 0.0f to force an auto-fit on this axis.
     IMGUI_API void          SetWindowCollapsed(const char* name, bool collapsed, ImGuiCond cond = 0);   // set named window collapsed state
+    IMGUI_API void          SetWindowDirty();                                                           // (for ImGuiWindowFlags_Retained windows) request current window contents to be refreshed again next frame, e.g. when animating.
+    IMGUI_API void          SetWindowDirty(const char* name);                                           // (for ImGuiWindowFlags_Retained windows) request named window contents to be refreshed on its next Begin(), e.g. when data it displays changed.
     IMGUI_API void          SetWindowFocus(const char* name);                                           // set named window to be focused / top-most. use NULL to remove focus.
 
     // Windows Scrolling
@@ -1025,6 +1027,7 @@ namespace ImGui
     IMGUI_API bool          IsRectVisible(const ImVec2& rect_min, const ImVec2& rect_max);      // test if rectangle (in screen space) is visible / not clipped. to perform coarse clipping on user's side.
     IMGUI_API double        GetTime();                                                          // get global imgui time. incremented by io.DeltaTime every frame.
     IMGUI_API int           GetFrameCount();                                                    // get global imgui frame count. incremented by 1 every frame.
+    IMGUI_API void          RequestRedraw(float delay = 0.0f);                                  // request a new frame to be processed within 'delay' seconds even if no inputs are submitted (e.g. custom animation). Reflected in io.WantRedraw/io.WantRedrawTimeout. Needs to be called every frame it applies to.
     IMGUI_API ImDrawListSharedData* GetDrawListSharedData();                                    // you may use this when creating your own ImDrawList instances.
     IMGUI_API const char*   GetStyleColorName(ImGuiCol idx);                                    // get a string corresponding to the enum value (for display, saving, etc.).
     IMGUI_API void          SetStateStorage(ImGuiStorage* storage);                             // replace current window storage with our own (if you want to manipulate it yourself, typically clear subsection of it)
@@ -1163,6 +1166,7 @@ enum ImGuiWindowFlags_
     ImGuiWindowFlags_NoNavInputs            = 1 << 16,  // No keyboard/gamepad navigation within the window
     ImGuiWindowFlags_NoNavFocus             = 1 << 17,  // No focusing toward this window with keyboard/gamepad navigation (e.g. skipped by CTRL+TAB)
     ImGuiWindowFlags_UnsavedDocument        = 1 << 18,  // Display a dot next to the title. When used in a tab/docking context, tab is selected when clicking the X + closure is not assumed (will wait for user to stop submitting the tab). Otherwise closure is assumed when pressing the X, so if you keep submitting the tab may reappear at end of tab bar.
+    ImGuiWindowFlags_Retained               = 1 << 20,  // Reuse contents from previous frame until something changes (hover, focus, inputs, size, scroll, style...) or SetWindowDirty() is called. Begin() returns false when contents are reused: don't submit anything then. Top-level windows only.
     ImGuiWindowFlags_NoNav                  = ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
     ImGuiWindowFlags_NoDecoration           = ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoCollapse,
     ImGuiWindowFlags_NoInputs               = ImGuiWindowFlags_NoMouseInputs | ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
@@ -1701,6 +1705,7 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if io.ConfigNavMoveSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
     ImGuiBackendFlags_RendererHasTextures   = 1 << 4,   // Backend Renderer supports ImTextureData requests to create/update/destroy textures. This enables incremental texture updates and texture reloads. See https://github.com/ocornut/imgui/blob/master/docs/BACKENDS.md for instructions on how to upgrade your custom backend.
+    ImGuiBackendFlags_RendererHasSdfTextures = 1 << 5,  // Backend Renderer supports ImTextureData::UseSDF: draws those textures as signed distance fields. This enables ImFontFlags_SDF fonts to be rendered at any size from a single baked size.
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -2395,6 +2400,7 @@ struct ImGuiIO
     bool        ConfigWindowsCopyContentsWithCtrlC; // = false      // [EXPERIMENTAL] CTRL+C copy the contents of focused window into the clipboard. Experimental because: (1) has known issues with nested Begin/End pairs (2) text output quality varies (3) text output is in submission order rather than spatial order.
     bool        ConfigScrollbarScrollByPage;    // = true           // Enable scrolling page by page when clicking outside the scrollbar grab. When disabled, always scroll to clicked location. When enabled, Shift+Click scrolls to clicked location.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    bool        ConfigDamageTracking;           // = false          // [BETA] Render() compares draw lists with last frame and outputs changed regions in ImDrawData::DamageRects[]. Supporting renderer backends will then only redraw those regions: your app needs to preserve framebuffer contents between frames and only clear damaged regions.
 
     // Inputs Behaviors
     // (other variables, ones which are expected to be tweaked within UI code, are exposed in ImGuiStyle)
@@ -2484,6 +2490,20 @@ struct ImGuiIO
     IMGUI_API void  AddInputCharacterUTF16(ImWchar16 c);                    // Queue a new character input from a UTF-16 character, it can be a surrogate
     IMGUI_API void  AddInputCharactersUTF8(const char* str);                // Queue a new characters input from a UTF-8 string
 
+    // Input Functions: thread-safe variants
+    // - May be called from any thread (e.g. a dedicated input thread), concurrently with each other and with NewFrame(). They don't lock.
+    // - Events are stored in a fixed size lock-free queue, and passed to the AddXXX() functions above by next NewFrame(), in order.
+    //   Consecutive mouse position events and consecutive mouse wheel events are merged (io.InputEventsTrail won't see intermediate positions).
+    // - Return false if the queue is full (4096 events not consumed by NewFrame()). Custom allocator functions need to be thread-safe.
+    IMGUI_API bool  PostKeyEvent(ImGuiKey key, bool down);
+    IMGUI_API bool  PostKeyAnalogEvent(ImGuiKey key, bool down, float v);
+    IMGUI_API bool  PostMousePosEvent(float x, float y);
+    IMGUI_API bool  PostMouseButtonEvent(int button, bool down);
+    IMGUI_API bool  PostMouseWheelEvent(float wheel_x, float wheel_y);
+    IMGUI_API bool  PostMouseSourceEvent(ImGuiMouseSource source);
+    IMGUI_API bool  PostFocusEvent(bool focused);
+    IMGUI_API bool  PostInputCharacter(unsigned int c);                     // Decode UTF-8/UTF-16 yourself: there is no per-thread surrogate storage.
+
     IMGUI_API void  SetKeyEventNativeData(ImGuiKey key, int native_keycode, int native_scancode, int native_legacy_index = -1); // [Optional] Specify index for legacy <1.87 IsKeyXXX() functions with native indices + specify native keycode, scancode.
     IMGUI_API void  SetAppAcceptingEvents(bool accepting_events);           // Set master flag for accepting key/mouse/text events (default to true). Useful if you have native dialog boxes that are interrupting your application loop/refresh, and you want to disable events being queued while your app is frozen.
     IMGUI_API void  ClearEventsQueue();                                     // Clear all incoming events.
@@ -2512,6 +2532,8 @@ struct ImGuiIO
     int         MetricsRenderWindows;               // Number of visible windows
     int         MetricsActiveWindows;               // Number of active windows
     ImVec2      MouseDelta;                         // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
+    bool        WantRedraw;                         // Set by EndFrame() when another frame needs to be processed right away even if no new inputs are submitted (e.g. widget active, window auto-fitting, popup appearing, animation running). Applications wanting to save power may skip frames when this is false.
+    float       WantRedrawTimeout;                  // When WantRedraw is false: delay in seconds after which a new frame should be processed even if no new inputs are submitted (e.g. text cursor blinking, tooltip delay), FLT_MAX if none. 0.0f when WantRedraw is true.
 
     //------------------------------------------------------------------
     // [Internal] Dear ImGui will maintain those fields. Forward compatibility not guaranteed!
@@ -2749,11 +2771,21 @@ struct ImGuiStorage
 {
     // [Internal]
     ImVector<ImGuiStoragePair>      Data;
+#ifdef IMGUI_ENABLE_STORAGE_HASHMAP
+    ImVector<int>                   HashIndex;      // Open-addressing table (linear probing) of Data indices + 1, 0 = empty slot. Size is a power of two.
+    int                             HashIndexCount; // Number of Data entries referenced by HashIndex. Index is lazily rebuilt when this doesn't match Data.Size. Set to -1 after reordering Data in place.
+    ImGuiStorage()                  { HashIndexCount = 0; }
+#endif
 
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
+    // - With IMGUI_ENABLE_STORAGE_HASHMAP: pairs are stored in insertion order and indexed by a hash table, query and insertion are amortized O(1).
+#ifdef IMGUI_ENABLE_STORAGE_HASHMAP
+    void                Clear() { Data.clear(); HashIndex.clear(); HashIndexCount = 0; }
+#else
     void                Clear() { Data.clear(); }
+#endif
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2773,6 +2805,7 @@ struct ImGuiStorage
     IMGUI_API void**    GetVoidPtrRef(ImGuiID key, void* default_val = NULL);
 
     // Advanced: for quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
+    // (with IMGUI_ENABLE_STORAGE_HASHMAP this also rebuilds the hash index, call it if you reordered Data yourself)
     IMGUI_API void      BuildSortByKey();
     // Obsolete: use on your own storage if you know only integer are being stored (open/close all tree nodes)
     IMGUI_API void      SetAllInt(int val);
@@ -3126,7 +3159,33 @@ struct ImDrawCmd
 };
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if defined(IMGUI_USE_COMPACT_DRAWVERT)
+// Compact vertex layout (12 bytes instead of 20 bytes), enabled by '#define IMGUI_USE_COMPACT_DRAWVERT' in imconfig.h. Reduces vertex upload bandwidth.
+// - pos: 16-bit signed fixed-point, in units of 1/IM_DRAWVERT_COMPACT_POS_SCALE pixels. Default scale 8.0f: 1/8 pixel precision, range -4095.875..+4095.875.
+//   Positions outside of this range are clamped: content far outside of the display may be distorted. Use a smaller scale for larger displays.
+// - uv: 16-bit unsigned normalized (0..65535 == 0.0f..1.0f). UV outside of 0.0f..1.0f are clamped, so textures can't be repeated.
+// - Use ImDrawVertGetPos(), ImDrawVertGetUV(), ImDrawVertSetPos(), ImDrawVertSetUV() to access those fields in a layout-agnostic way.
+// - Renderer backends need to support it: see CHANGELOG for list of supported backends. Positions are usually read as integer-valued floats (e.g. GL_SHORT
+//   non-normalized) or normalized floats (e.g. VK_FORMAT_R16G16_SNORM) and scaled in the projection matrix. UV are read as normalized (e.g. VK_FORMAT_R16G16_UNORM).
+#ifdef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#error "IMGUI_USE_COMPACT_DRAWVERT and IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT cannot be used together."
+#endif
+#ifndef IM_DRAWVERT_COMPACT_POS_SCALE
+#define IM_DRAWVERT_COMPACT_POS_SCALE   8.0f
+#endif
+struct ImDrawVert
+{
+    ImS16   pos[2];
+    ImU16   uv[2];
+    ImU32   col;
+};
+inline ImS16    ImDrawVertPackPos(float v)                      { v *= IM_DRAWVERT_COMPACT_POS_SCALE; return (ImS16)(v >= 32767.0f ? 32767 : v <= -32767.0f ? -32767 : (int)(v >= 0.0f ? v + 0.5f : v - 0.5f)); }
+inline ImU16    ImDrawVertPackUV(float v)                       { return (ImU16)(v >= 1.0f ? 65535 : v <= 0.0f ? 0 : (int)(v * 65535.0f + 0.5f)); }
+inline ImVec2   ImDrawVertGetPos(const ImDrawVert& v)           { return ImVec2(v.pos[0] * (1.0f / IM_DRAWVERT_COMPACT_POS_SCALE), v.pos[1] * (1.0f / IM_DRAWVERT_COMPACT_POS_SCALE)); }
+inline ImVec2   ImDrawVertGetUV(const ImDrawVert& v)            { return ImVec2(v.uv[0] * (1.0f / 65535.0f), v.uv[1] * (1.0f / 65535.0f)); }
+inline void     ImDrawVertSetPos(ImDrawVert& v, const ImVec2& pos) { v.pos[0] = ImDrawVertPackPos(pos.x); v.pos[1] = ImDrawVertPackPos(pos.y); }
+inline void     ImDrawVertSetUV(ImDrawVert& v, const ImVec2& uv)   { v.uv[0] = ImDrawVertPackUV(uv.x); v.uv[1] = ImDrawVertPackUV(uv.y); }
+#elif !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImDrawVert
 {
     ImVec2  pos;
@@ -3140,6 +3199,12 @@ struct ImDrawVert
 // NOTE: IMGUI DOESN'T CLEAR THE STRUCTURE AND DOESN'T CALL A CONSTRUCTOR SO ANY CUSTOM FIELD WILL BE UNINITIALIZED. IF YOU ADD EXTRA FIELDS (SUCH AS A 'Z' COORDINATES) YOU WILL NEED TO CLEAR THEM DURING RENDER OR TO IGNORE THEM.
 IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT;
 #endif
+#ifndef IMGUI_USE_COMPACT_DRAWVERT
+inline ImVec2   ImDrawVertGetPos(const ImDrawVert& v)           { return v.pos; }
+inline ImVec2   ImDrawVertGetUV(const ImDrawVert& v)            { return v.uv; }
+inline void     ImDrawVertSetPos(ImDrawVert& v, const ImVec2& pos) { v.pos = pos; }
+inline void     ImDrawVertSetUV(ImDrawVert& v, const ImVec2& uv)   { v.uv = uv; }
+#endif
 
 // [Internal] For use by ImDrawList
 struct ImDrawCmdHeader
@@ -3184,6 +3249,7 @@ enum ImDrawFlags_
     ImDrawFlags_RoundCornersBottomLeft      = 1 << 6, // AddRect(), AddRectFilled(), PathRect(): enable rounding bottom-left corner only (when rounding > 0.0f, we default to all corners). Was 0x04.
     ImDrawFlags_RoundCornersBottomRight     = 1 << 7, // AddRect(), AddRectFilled(), PathRect(): enable rounding bottom-right corner only (when rounding > 0.0f, we default to all corners). Wax 0x08.
     ImDrawFlags_RoundCornersNone            = 1 << 8, // AddRect(), AddRectFilled(), PathRect(): disable rounding on all corners (when rounding > 0.0f). This is NOT zero, NOT an implicit flag!
+    ImDrawFlags_CullToClipRect              = 1 << 9, // AddRectFilledBatch(), AddLineBatch(), AddCircleFilledBatch(): skip items which are entirely outside of the current clipping rectangle.
     ImDrawFlags_RoundCornersTop             = ImDrawFlags_RoundCornersTopLeft | ImDrawFlags_RoundCornersTopRight,
     ImDrawFlags_RoundCornersBottom          = ImDrawFlags_RoundCornersBottomLeft | ImDrawFlags_RoundCornersBottomRight,
     ImDrawFlags_RoundCornersLeft            = ImDrawFlags_RoundCornersBottomLeft | ImDrawFlags_RoundCornersTopLeft,
@@ -3232,6 +3298,7 @@ struct ImDrawList
     ImVector<ImVec4>        _ClipRectStack;     // [Internal]
     ImVector<ImTextureRef>  _TextureStack;      // [Internal]
     ImVector<ImU8>          _CallbacksDataBuf;  // [Internal]
+    ImVector<ImVec2>        _TempBuffer;        // [Internal] scratch buffer for polyline/polygon normals and triangulation (owned by each list so lists can be recorded concurrently)
     float                   _FringeScale;       // [Internal] anti-alias fringe is scaled by this value, this helps to keep things sharp while zooming at vertex buffer content
     const char*             _OwnerName;         // Pointer to owner window's name for debugging
 
@@ -3305,6 +3372,15 @@ struct ImDrawList
     IMGUI_API void  PathBezierQuadraticCurveTo(const ImVec2& p2, const ImVec2& p3, int num_segments = 0);               // Quadratic Bezier (3 control points)
     IMGUI_API void  PathRect(const ImVec2& rect_min, const ImVec2& rect_max, float rounding = 0.0f, ImDrawFlags flags = 0);
 
+    // Batched primitives
+    // - Submit many primitives in one call: buffers are reserved once and vertices/indices are written in a tight loop, removing per-call overhead.
+    // - Points are passed as pairs: 'p_min_max[n * 2 + 0]' and 'p_min_max[n * 2 + 1]' for item n.
+    // - 'cols' is optional: if non-NULL it provides one color per item, otherwise 'col' is used for all items. Fully transparent items are skipped.
+    // - Use ImDrawFlags_CullToClipRect to skip items entirely outside of the current clipping rectangle (e.g. from PushClipRect()).
+    IMGUI_API void  AddRectFilledBatch(const ImVec2* p_min_max, int count, ImU32 col, const ImU32* cols = NULL, ImDrawFlags flags = 0);                             // Same as AddRectFilled() without rounding for each item.
+    IMGUI_API void  AddLineBatch(const ImVec2* p1_p2, int count, ImU32 col, float thickness = 1.0f, const ImU32* cols = NULL, ImDrawFlags flags = 0);               // Same as AddLine() for each item.
+    IMGUI_API void  AddCircleFilledBatch(const ImVec2* centers, int count, float radius, ImU32 col, int num_segments = 0, const ImU32* cols = NULL, ImDrawFlags flags = 0); // Same as AddCircleFilled() for each item, sharing radius and tessellation.
+
     // Advanced: Draw Callbacks
     // - May be used to alter render state (change sampler, blending, current shader). May be used to emit custom rendering commands (difficult to do correctly, but possible).
     // - Use special ImDrawCallback_ResetRenderState callback to instruct backend to reset its render state to the default.
@@ -3320,6 +3396,17 @@ struct ImDrawList
     IMGUI_API void  AddDrawCmd();                                               // This is useful if you need to forcefully create a new draw call (to allow for dependent rendering / blending). Otherwise primitives are merged into the same draw-call as much as possible
     IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer. For multi-threaded rendering, consider using `imgui_threaded_rendering` from https://github.com/ocornut/imgui_club instead.
 
+    // Advanced: Multi-threaded recording
+    // - Standalone ImDrawList instances created with ImGui::GetDrawListSharedData() may be filled concurrently on worker threads (one thread per list),
+    //   then appended with AddDrawList() to e.g. GetWindowDrawList(), GetBackgroundDrawList() or GetForegroundDrawList(), in the order of your choice.
+    // - Create/destroy the lists and call AddDrawList() on the main thread. Keep lists alive across frames so their buffers don't need to grow again.
+    // - Record between NewFrame() and Render() while the main thread waits for workers (fork-join): the font atlas may update textures and UV of all lists.
+    // - Worker threads may use the shape/path/primitive functions and AddImage(), but must not call ImGui:: functions, AddText() or anything using fonts.
+    // - ImGui::MemAlloc() updates allocation statistics of the current context, which are not thread-safe: if lists may grow on worker threads, '#define IMGUI_ENABLE_THREAD_LOCAL_CONTEXT'
+    //   or '#define IMGUI_DEBUG_ALLOC_OWNER_THREAD_ONLY' in imconfig.h (or IMGUI_DISABLE_DEBUG_TOOLS), or reserve buffers of the lists on the main thread beforehand.
+    IMGUI_API void  Reset();                                                    // Clear contents and setup full-screen clip rectangle + font atlas texture, before recording a standalone list. Safe to call on worker threads.
+    IMGUI_API void  AddDrawList(const ImDrawList* src);                         // Append contents of another list, clipped by the current clip rectangle. Textures and callbacks are preserved.
+
     // Advanced: Channels
     // - Use to split render into layers. By switching channels to can render out-of-order (e.g. submit FG primitives before BG primitives)
     // - Use to minimize draw calls (e.g. if going back-and-forth between multiple clipping rectangles, prefer to append into separate channels then merge at the end)
@@ -3338,7 +3425,7 @@ struct ImDrawList
     IMGUI_API void  PrimRect(const ImVec2& a, const ImVec2& b, ImU32 col);      // Axis aligned rectangle (composed of two triangles)
     IMGUI_API void  PrimRectUV(const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, ImU32 col);
     IMGUI_API void  PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, const ImVec2& d, const ImVec2& uv_a, const ImVec2& uv_b, const ImVec2& uv_c, const ImVec2& uv_d, ImU32 col);
-    inline    void  PrimWriteVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)    { _VtxWritePtr->pos = pos; _VtxWritePtr->uv = uv; _VtxWritePtr->col = col; _VtxWritePtr++; _VtxCurrentIdx++; }
+    inline    void  PrimWriteVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)    { ImDrawVertSetPos(*_VtxWritePtr, pos); ImDrawVertSetUV(*_VtxWritePtr, uv); _VtxWritePtr->col = col; _VtxWritePtr++; _VtxCurrentIdx++; }
     inline    void  PrimWriteIdx(ImDrawIdx idx)                                     { *_IdxWritePtr = idx; _IdxWritePtr++; }
     inline    void  PrimVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)         { PrimWriteIdx((ImDrawIdx)_VtxCurrentIdx); PrimWriteVtx(pos, uv, col); } // Write vertex with unique index
 
@@ -3383,13 +3470,15 @@ struct ImDrawData
     ImVec2              FramebufferScale;   // Amount of pixels for each unit of DisplaySize. Copied from viewport->FramebufferScale (== io.DisplayFramebufferScale for main viewport). Generally (1,1) on normal display, (2,2) on OSX with Retina display.
     ImGuiViewport*      OwnerViewport;      // Viewport carrying the ImDrawData instance, might be of use to the renderer (generally not).
     ImVector<ImTextureData*>* Textures;     // List of textures to update. Most of the times the list is shared by all ImDrawData, has only 1 texture and it doesn't need any update. This almost always points to ImGui::GetPlatformIO().Textures[]. May be overriden or set to NULL if you want to manually update textures.
+    bool                DamageTracked;      // Set by Render() when io.ConfigDamageTracking is enabled: DamageRects[] is valid and renderer backends may only redraw those regions. Clear to request a full redraw.
+    ImVector<ImVec4>    DamageRects;        // Regions that changed since last frame, in the same coordinates as ImDrawCmd::ClipRect (x1,y1,x2,y2). Rounded to integers, non-overlapping. Empty == nothing changed. Changes to the contents of your own textures and user callbacks are not detected: push your own rect or clear DamageTracked.
 
     // Functions
     ImDrawData()    { Clear(); }
     IMGUI_API void  Clear();
     IMGUI_API void  AddDrawList(ImDrawList* draw_list);     // Helper to add an external draw list into an existing ImDrawData.
     IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
-    IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
+    IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd (and DamageRects[]). Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
 };
 
 //-----------------------------------------------------------------------------
@@ -3454,6 +3543,7 @@ struct ImTextureData
     int                 UnusedFrames;           // w    r   // In order to facilitate handling Status==WantDestroy in some backend: this is a count successive frames where the texture was not used. Always >0 when Status==WantDestroy.
     unsigned short      RefCount;               // w    r   // Number of contexts using this texture. Used during backend shutdown.
     bool                UseColors;              // w    r   // Tell whether our texture data is known to use colors (rather than just white + alpha).
+    bool                UseSDF;                 // w    r   // Tell whether alpha channel stores signed distance fields (ImFontFlags_SDF): 0.5 on glyph edges, increasing inside. Only set when backend supports ImGuiBackendFlags_RendererHasSdfTextures.
     bool                WantDestroyNextFrame;   // rw   -   // [Internal] Queued to set ImTextureStatus_WantDestroy next frame. May still be used in the current frame.
 
     // Functions
@@ -3506,6 +3596,7 @@ struct ImFontConfig
     //unsigned int  FontBuilderFlags;       // --       // [Renamed in 1.92] Ue FontLoaderFlags.
     float           RasterizerMultiply;     // 1.0f     // Linearly brighten (>1.0f) or darken (<1.0f) font output. Brightening small fonts may be a good workaround to make them more readable. This is a silly thing we may remove in the future.
     float           RasterizerDensity;      // 1.0f     // [LEGACY: this only makes sense when ImGuiBackendFlags_RendererHasTextures is not supported] DPI scale multiplier for rasterization. Not altering other font metrics: makes it easy to swap between e.g. a 100% and a 400% fonts for a zooming display, or handle Retina screen. IMPORTANT: If you change this it is expected that you increase/decrease font scale roughly to the inverse of this, otherwise quality may look lowered.
+    float           SdfSize;                // 48.0f    // [BETA] Size in pixels at which glyphs are rasterized when using ImFontFlags_SDF. All font sizes are rendered by scaling those glyphs.
 
     // [Internal]
     ImFontFlags     Flags;                  // Font flags (don't use just yet, will be exposed in upcoming 1.92.X updates)
@@ -3523,10 +3614,11 @@ struct ImFontGlyph
     unsigned int    Colored : 1;        // Flag to indicate glyph is colored and should generally ignore tinting (make it usable with no shift on little-endian as this is used in loops)
     unsigned int    Visible : 1;        // Flag to indicate glyph has no visible pixels (e.g. space). Allow early out when rendering.
     unsigned int    SourceIdx : 4;      // Index of source in parent font
-    unsigned int    Codepoint : 26;     // 0x0000..0x10FFFF
+    unsigned int    Codepoint : 21;     // 0x0000..0x10FFFF
+    unsigned int    PageIdx : 5;        // Texture page storing the glyph (ImFontAtlasFlags_TexturePages). 0: ImFontAtlas->TexRef.
     float           AdvanceX;           // Horizontal distance to advance cursor/layout position.
     float           X0, Y0, X1, Y1;     // Glyph corners. Offsets from current cursor/layout position.
-    float           U0, V0, U1, V1;     // Texture coordinates for the current value of ImFontAtlas->TexRef. Cached equivalent of calling GetCustomRect() with PackId.
+    float           U0, V0, U1, V1;     // Texture coordinates for the current value of ImFontAtlas->TexRef (or for the texture page when PageIdx != 0). Cached equivalent of calling GetCustomRect() with PackId.
     int             PackId;             // [Internal] ImFontAtlasRectId value (FIXME: Cold data, could be moved elsewhere?)
 
     ImFontGlyph()   { memset(this, 0, sizeof(*this)); PackId = -1; }
@@ -3572,6 +3664,10 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
     ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_AsyncGlyphLoading  = 1 << 3,   // [BETA] Don't rasterize glyphs when first used: reserve them (correct advance, nothing drawn) then rasterize them in a background task (see BackgroundTaskStart) and commit them on next frame. Requires ImGuiBackendFlags_RendererHasTextures and a loader supporting it (stb_truetype).
+    ImFontAtlasFlags_TexturePages       = 1 << 4,   // [BETA] Once the texture reached TexPageSize, pack new glyphs into additional textures ("pages") instead of growing and repacking the texture. Pages are never resized, and are destroyed when all their glyphs have been discarded. Requires ImGuiBackendFlags_RendererHasTextures.
+    ImFontAtlasFlags_TextLayoutCache    = 1 << 5,   // [BETA] Cache layout of text drawn repeatedly (e.g. labels): after a text was drawn on two calls, glyph quads are reused instead of decoding text and looking up glyphs. Only used for text shorter than 256 bytes and entirely inside its clipping rectangle. Costs memory: ~36 bytes per visible character.
+    ImFontAtlasFlags_SharedAcrossThreads = 1 << 6,  // [BETA] Atlas is used by multiple imgui contexts running on different threads (see IMGUI_ENABLE_THREAD_LOCAL_CONTEXT). Contexts never modify the atlas during their frame: missing glyphs and font sizes are drawn with fallback glyph and closest size, recorded per context, and loaded by next ImFontAtlasUpdateNewFrame(). That call (done by NewFrame() of the owner context) must not overlap frames of other contexts. Textures are not listed in DrawData->Textures: after that call and before other contexts render, update atlas->TexList with a single renderer. Requires IMGUI_ENABLE_THREAD_LOCAL_CONTEXT and ImGuiBackendFlags_RendererHasTextures. Disables ImFontAtlasFlags_TextLayoutCache.
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -3609,6 +3705,15 @@ struct ImFontAtlas
     IMGUI_API void              CompactCache();             // Compact cached glyphs and texture.
     IMGUI_API void              SetFontLoader(const ImFontLoader* font_loader); // Change font loader at runtime.
 
+    // [BETA] Persistent glyph cache, to avoid rasterizing the same glyphs again on every run.
+    // - Call SaveGlyphCacheToDisk() before exiting, and LoadGlyphCacheFromDisk() on next run: glyphs are then copied from the cache instead of being rasterized.
+    // - Entries are only used when font data, font settings, font loader, size and density all match. Cache is not portable across architectures and Dear ImGui versions.
+    // - Loaded data stays in memory until the atlas is destroyed. Call LoadGlyphCacheFromMemory(NULL, 0) to free it.
+    IMGUI_API bool              LoadGlyphCacheFromDisk(const char* filename);
+    IMGUI_API bool              LoadGlyphCacheFromMemory(const void* data, size_t data_size);
+    IMGUI_API bool              SaveGlyphCacheToDisk(const char* filename);
+    IMGUI_API void              SaveGlyphCacheToMemory(ImVector<unsigned char>* out_data); // Save all glyphs currently loaded + entries of loaded cache which haven't been used.
+
     // As we are transitioning toward a new font system, we expect to obsolete those soon:
     IMGUI_API void              ClearInputData();           // [OBSOLETE] Clear input data (all ImFontConfig structures including sizes, TTF data, glyph ranges, etc.) = all the data used to build the texture and fonts.
     IMGUI_API void              ClearFonts();               // [OBSOLETE] Clear input+output font data (same as ClearInputData() + glyphs storage, UV coordinates).
@@ -3689,7 +3794,14 @@ struct ImFontAtlas
     int                         TexMinHeight;       // Minimum desired texture height. Must be a power of two. Default to 128.
     int                         TexMaxWidth;        // Maximum desired texture width. Must be a power of two. Default to 8192.
     int                         TexMaxHeight;       // Maximum desired texture height. Must be a power of two. Default to 8192.
+    int                         TexPageSize;        // Width and height of additional textures when using ImFontAtlasFlags_TexturePages or ImFontFlags_SDF. Must be a power of two. Default to 1024.
+    int                         BakedMemoryBudget;  // [BETA] Budget in bytes for baked fonts (glyph pixels + glyph data). When exceeded, least recently used baked fonts are discarded by NewFrame(). Baked fonts used during the last frame are never discarded. 0: unlimited (default).
     void*                       UserData;           // Store your own atlas related user-data (if e.g. you have multiple font atlas).
+    void                        (*ParallelFor)(void (*func)(void* func_user_data, int index), void* func_user_data, int count, void* user_data); // [BETA] Optional: used by ImFontBaked::PreloadGlyphs() to rasterize glyphs using your job system. Must call 'func(func_user_data, n)' for all n in [0..count) from any thread and return when all calls have completed. Your memory allocator needs to be thread-safe.
+    void*                       ParallelForUserData;// Passed as 'user_data' to ParallelFor().
+    void                        (*BackgroundTaskStart)(void (*func)(void* func_user_data), void* func_user_data, void* user_data); // [BETA] Optional: used by ImFontAtlasFlags_AsyncGlyphLoading, at the end of the frame. Must call 'func(func_user_data)' from another thread. Without it, glyphs are rasterized at the beginning of next frame. Your memory allocator needs to be thread-safe.
+    void                        (*BackgroundTaskWait)(void* user_data);                                                               // [BETA] Optional: wait for completion of the task started by BackgroundTaskStart(). Called on next NewFrame, or earlier if fonts are modified.
+    void*                       BackgroundTaskUserData; // Passed as 'user_data' to BackgroundTaskStart(), BackgroundTaskWait().
 
     // Output
     // - Because textures are dynamically created/resized, the current texture identifier may changed at *ANY TIME* during the frame.
@@ -3705,6 +3817,7 @@ struct ImFontAtlas
     ImVector<ImTextureData*>    TexList;            // Texture list (most often TexList.Size == 1). TexData is always == TexList.back(). DO NOT USE DIRECTLY, USE GetDrawData().Textures[]/GetPlatformIO().Textures[] instead!
     bool                        Locked;             // Marked as locked during ImGui::NewFrame()..EndFrame() scope if TexUpdates are not supported. Any attempt to modify the atlas will assert.
     bool                        RendererHasTextures;// Copy of (BackendFlags & ImGuiBackendFlags_RendererHasTextures) from supporting context.
+    bool                        RendererHasSdfTextures; // Copy of (BackendFlags & ImGuiBackendFlags_RendererHasSdfTextures) from supporting context.
     bool                        TexIsBuilt;         // Set when texture was built matching current font input. Mostly useful for legacy IsBuilt() call.
     bool                        TexPixelsUseColors; // Tell whether our texture data is known to use colors (rather than just alpha channel), in order to help backend select a format or conversion process.
     ImVec2                      TexUvScale;         // = (1.0f/TexData->TexWidth, 1.0f/TexData->TexHeight). May change as new texture gets created.
@@ -3715,6 +3828,7 @@ struct ImFontAtlas
     int                         TexNextUniqueID;    // Next value to be stored in TexData->UniqueID
     int                         FontNextUniqueID;   // Next value to be stored in ImFont->FontID
     ImVector<ImDrawListSharedData*> DrawListSharedDatas; // List of users for this atlas. Typically one per Dear ImGui context.
+    ImVector<unsigned char>     GlyphCacheData;     // Persistent glyph cache data, loaded by LoadGlyphCacheFromMemory().
     ImFontAtlasBuilder*         Builder;            // Opaque interface to our data that doesn't need to be public and may be discarded when rebuilding.
     const ImFontLoader*         FontLoader;         // Font loader opaque interface (default to use FreeType when IMGUI_ENABLE_FREETYPE is defined, otherwise default to use stb_truetype). Use SetFontLoader() to change this at runtime.
     const char*                 FontLoaderName;     // Font loader name (for display e.g. in About box) == FontLoader->Name
@@ -3744,14 +3858,15 @@ struct ImFontAtlas
 // Important: pointers to ImFontBaked are only valid for the current frame.
 struct ImFontBaked
 {
-    // [Internal] Members: Hot ~20/24 bytes (for CalcTextSize)
-    ImVector<float>             IndexAdvanceX;      // 12-16 // out // Sparse. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this info, and are often bottleneck in large UI).
+    // [Internal] Members: Hot ~32/40 bytes (for CalcTextSize)
+    ImVector<ImU16>             IndexPages;         // 12-16 // out // Two-level index: IndexPages[codepoint >> 8] is a page of 256 entries in IndexAdvanceX[]/IndexLookup[], only allocated when containing loaded glyphs.
+    ImVector<float>             IndexAdvanceX;      // 12-16 // out // Paged. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this info, and are often bottleneck in large UI).
     float                       FallbackAdvanceX;   // 4     // out // FindGlyph(FallbackChar)->AdvanceX
     float                       Size;               // 4     // in  // Height of characters/line, set during loading (doesn't change after loading)
     float                       RasterizerDensity;  // 4     // in  // Density this is baked at
 
     // [Internal] Members: Hot ~28/36 bytes (for RenderText loop)
-    ImVector<ImU16>             IndexLookup;        // 12-16 // out // Sparse. Index glyphs by Unicode code-point.
+    ImVector<ImU16>             IndexLookup;        // 12-16 // out // Paged. Index glyphs by Unicode code-point.
     ImVector<ImFontGlyph>       Glyphs;             // 12-16 // out // All glyphs.
     int                         FallbackGlyphIndex; // 4     // out // Index of FontFallbackChar
 
@@ -3761,7 +3876,9 @@ struct ImFontBaked
     unsigned int                WantDestroy:1;         // 0  //     // Queued for destroy
     unsigned int                LoadNoFallback:1;      // 0  //     // Disable loading fallback in lower-level calls.
     unsigned int                LoadNoRenderOnLayout:1;// 0  //     // Enable a two-steps mode where CalcTextSize() calls will load AdvanceX *without* rendering/packing glyphs. Only advantagous if you know that the glyph is unlikely to actually be rendered, otherwise it is slower because we'd do one query on the first CalcTextSize and one query on the first Draw.
+    unsigned int                UseSDF:1;              // 0  // in  // Glyphs are rasterized as signed distance fields into dedicated texture pages (ImFontFlags_SDF).
     int                         LastUsedFrame;         // 4  //     // Record of that time this was bounds
+    int                         GlyphCacheIdx;         // 4  //     // Index+1 of matching entry in ContainerAtlas->GlyphCacheData. 0: not searched yet, -1: none.
     ImGuiID                     BakedId;            // 4     //     // Unique ID for this baked storage
     ImFont*                     ContainerFont;      // 4-8   // in  // Parent font
     void*                       FontLoaderDatas;    // 4-8   //     // Font loader opaque storage (per baked font * sources): single contiguous buffer allocated by imgui, passed to loader.
@@ -3773,6 +3890,7 @@ struct ImFontBaked
     IMGUI_API ImFontGlyph*      FindGlyphNoFallback(ImWchar c);     // Return NULL if glyph doesn't exist
     IMGUI_API float             GetCharAdvance(ImWchar c);
     IMGUI_API bool              IsGlyphLoaded(ImWchar c);
+    IMGUI_API void              PreloadGlyphs(const ImWchar* codepoints, int codepoints_count); // Load multiple glyphs at once. Faster than loading them one by one, and rasterization is spread over atlas->ParallelFor() when set.
 };
 
 // Font flags
@@ -3783,6 +3901,7 @@ enum ImFontFlags_
     ImFontFlags_NoLoadError             = 1 << 1,   // Disable throwing an error/assert when calling AddFontXXX() with missing file/data. Calling code is expected to check AddFontXXX() return value.
     ImFontFlags_NoLoadGlyphs            = 1 << 2,   // [Internal] Disable loading new glyphs.
     ImFontFlags_LockBakedSizes          = 1 << 3,   // [Internal] Disable loading new baked sizes, disable garbage collecting current ones. e.g. if you want to lock a font to a single size. Important: if you use this to preload given sizes, consider the possibility of multiple font density used on Retina display.
+    ImFontFlags_SDF                     = 1 << 4,   // [BETA] Rasterize glyphs once as signed distance fields at ImFontConfig::SdfSize, and render every size from them (no new baked size on every zoom step). Requires ImGuiBackendFlags_RendererHasSdfTextures and a loader supporting it (stb_truetype, FreeType 2.11+), otherwise ignored.
 };
 
 // Font runtime data and rendering
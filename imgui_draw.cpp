@@ -11,6 +11,7 @@ Index of this file:
 // [SECTION] ImTriangulator, ImDrawList concave polygon fill
 // [SECTION] ImDrawListSplitter
 // [SECTION] ImDrawData
+// [SECTION] ImDrawDamageTracker
 // [SECTION] Helpers ShadeVertsXXX functions
 // [SECTION] ImFontConfig
 // [SECTION] ImFontAtlas, ImFontAtlasBuilder
@@ -137,8 +138,29 @@ namespace IMGUI_STB_NAMESPACE
 #ifdef  IMGUI_ENABLE_STB_TRUETYPE
 #ifndef STB_TRUETYPE_IMPLEMENTATION                         // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
 #ifndef IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION           // in case the user already have an implementation in another compilation unit
-#define STBTT_malloc(x,u)   ((void)(u), IM_ALLOC(x))
-#define STBTT_free(x,u)     ((void)(u), IM_FREE(x))
+// Allocations made while rasterizing glyphs from worker threads (stbtt_fontinfo::userdata != NULL, see ImGui_ImplStbTrueType_FontBakedRasterizeGlyph())
+// call the allocator directly, bypassing debug allocation hooks of ImGui::MemAlloc()/MemFree() which are not thread-safe.
+static void* ImStbTrueTypeMemAlloc(size_t sz, void* user_data)
+{
+    if (user_data == NULL)
+        return IM_ALLOC(sz);
+    ImGuiMemAllocFunc alloc_func; ImGuiMemFreeFunc free_func; void* alloc_user_data;
+    ImGui::GetAllocatorFunctions(&alloc_func, &free_func, &alloc_user_data);
+    return alloc_func(sz, alloc_user_data);
+}
+static void ImStbTrueTypeMemFree(void* ptr, void* user_data)
+{
+    if (user_data == NULL)
+    {
+        IM_FREE(ptr);
+        return;
+    }
+    ImGuiMemAllocFunc alloc_func; ImGuiMemFreeFunc free_func; void* alloc_user_data;
+    ImGui::GetAllocatorFunctions(&alloc_func, &free_func, &alloc_user_data);
+    free_func(ptr, alloc_user_data);
+}
+#define STBTT_malloc(x,u)   ImStbTrueTypeMemAlloc(x,u)
+#define STBTT_free(x,u)     ImStbTrueTypeMemFree(x,u)
 #define STBTT_assert(x)     do { IM_ASSERT(x); } while(0)
 #define STBTT_fmod(x,y)     ImFmod(x,y)
 #define STBTT_sqrt(x)       ImSqrt(x)
@@ -475,6 +497,7 @@ void ImDrawList::_ClearFreeMemory()
     _TextureStack.clear();
     _CallbacksDataBuf.clear();
     _Path.clear();
+    _TempBuffer.clear();
     _Splitter.ClearFreeMemory();
 }
 
@@ -489,6 +512,79 @@ ImDrawList* ImDrawList::CloneOutput() const
     return dst;
 }
 
+// Prepare a standalone draw list for recording. This only reads from the shared data, so it may be called from a worker thread.
+void ImDrawList::Reset()
+{
+    IM_ASSERT(_Data != NULL && _Data->FontAtlas != NULL && "Create standalone draw lists with ImGui::GetDrawListSharedData(), after the first NewFrame().");
+    _ResetForNewFrame();
+    PushTexture(_Data->FontAtlas->TexRef);
+    PushClipRectFullScreen();
+}
+
+// Append the contents of another draw list, e.g. recorded on a worker thread.
+// - Commands are clipped by our current clip rectangle. Texture references and callbacks are copied as-is.
+// - With ImDrawListFlags_AllowVtxOffset, indices are copied unmodified and commands are offset with VtxOffset.
+//   Otherwise indices are rebased, which requires the combined vertex count to fit in ImDrawIdx.
+void ImDrawList::AddDrawList(const ImDrawList* src)
+{
+    IM_ASSERT(src != this && src->_Splitter._Count <= 1 && "Source draw list channels need to be merged first!");
+    const bool use_vtx_offset = (Flags & ImDrawListFlags_AllowVtxOffset) != 0;
+    const int vtx_base = VtxBuffer.Size;
+    const int idx_base = IdxBuffer.Size;
+    IM_ASSERT((use_vtx_offset || sizeof(ImDrawIdx) == 4 || vtx_base + src->VtxBuffer.Size <= (1 << 16)) && "Too many vertices in ImDrawList using 16-bit indices. Read comment above about ImDrawListFlags_AllowVtxOffset.");
+
+    VtxBuffer.resize(vtx_base + src->VtxBuffer.Size);
+    IdxBuffer.resize(idx_base + src->IdxBuffer.Size);
+    if (src->VtxBuffer.Size > 0)
+        memcpy(VtxBuffer.Data + vtx_base, src->VtxBuffer.Data, (size_t)src->VtxBuffer.Size * sizeof(ImDrawVert));
+    if (use_vtx_offset && src->IdxBuffer.Size > 0)
+        memcpy(IdxBuffer.Data + idx_base, src->IdxBuffer.Data, (size_t)src->IdxBuffer.Size * sizeof(ImDrawIdx));
+
+    _PopUnusedDrawCmd();
+    const ImVec4 clip_rect = _CmdHeader.ClipRect;
+    for (const ImDrawCmd& src_cmd : src->CmdBuffer)
+    {
+        if (src_cmd.ElemCount == 0 && src_cmd.UserCallback == NULL)
+            continue;
+        ImDrawCmd cmd = src_cmd;
+        cmd.ClipRect.x = ImMax(src_cmd.ClipRect.x, clip_rect.x);
+        cmd.ClipRect.y = ImMax(src_cmd.ClipRect.y, clip_rect.y);
+        cmd.ClipRect.z = ImMax(cmd.ClipRect.x, ImMin(src_cmd.ClipRect.z, clip_rect.z));
+        cmd.ClipRect.w = ImMax(cmd.ClipRect.y, ImMin(src_cmd.ClipRect.w, clip_rect.w));
+        cmd.IdxOffset = idx_base + src_cmd.IdxOffset;
+        cmd.VtxOffset = use_vtx_offset ? vtx_base + src_cmd.VtxOffset : 0;
+        if (!use_vtx_offset)
+        {
+            const ImDrawIdx idx_delta = (ImDrawIdx)(vtx_base + src_cmd.VtxOffset);
+            const ImDrawIdx* src_idx = src->IdxBuffer.Data + src_cmd.IdxOffset;
+            ImDrawIdx* dst_idx = IdxBuffer.Data + cmd.IdxOffset;
+            for (unsigned int n = 0; n < src_cmd.ElemCount; n++)
+                dst_idx[n] = (ImDrawIdx)(src_idx[n] + idx_delta);
+        }
+        if (src_cmd.UserCallback != NULL && src_cmd.UserCallbackDataSize > 0)
+        {
+            cmd.UserCallbackDataOffset = _CallbacksDataBuf.Size;
+            _CallbacksDataBuf.resize(_CallbacksDataBuf.Size + src_cmd.UserCallbackDataSize);
+            memcpy(_CallbacksDataBuf.Data + (size_t)cmd.UserCallbackDataOffset, src->_CallbacksDataBuf.Data + (size_t)src_cmd.UserCallbackDataOffset, (size_t)src_cmd.UserCallbackDataSize);
+        }
+        CmdBuffer.push_back(cmd);
+    }
+
+    // Resume recording after appended data, with our current clip rectangle and texture
+    _VtxWritePtr = VtxBuffer.Data + VtxBuffer.Size;
+    _IdxWritePtr = IdxBuffer.Data + IdxBuffer.Size;
+    if (use_vtx_offset)
+    {
+        _CmdHeader.VtxOffset = VtxBuffer.Size;
+        _VtxCurrentIdx = 0;
+    }
+    else
+    {
+        _VtxCurrentIdx = (unsigned int)VtxBuffer.Size;
+    }
+    AddDrawCmd();
+}
+
 void ImDrawList::AddDrawCmd()
 {
     ImDrawCmd draw_cmd;
@@ -746,10 +842,10 @@ void ImDrawList::PrimRect(const ImVec2& a, const ImVec2& c, ImU32 col)
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
-    _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
-    _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col;
-    _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col;
-    _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv; _VtxWritePtr[3].col = col;
+    IM_DRAWVERT_WRITE_POS(_VtxWritePtr[0], a.x, a.y); IM_DRAWVERT_WRITE_UV(_VtxWritePtr[0], uv.x, uv.y); _VtxWritePtr[0].col = col;
+    IM_DRAWVERT_WRITE_POS(_VtxWritePtr[1], b.x, b.y); IM_DRAWVERT_WRITE_UV(_VtxWritePtr[1], uv.x, uv.y); _VtxWritePtr[1].col = col;
+    IM_DRAWVERT_WRITE_POS(_VtxWritePtr[2], c.x, c.y); IM_DRAWVERT_WRITE_UV(_VtxWritePtr[2], uv.x, uv.y); _VtxWritePtr[2].col = col;
+    IM_DRAWVERT_WRITE_POS(_VtxWritePtr[3], d.x, d.y); IM_DRAWVERT_WRITE_UV(_VtxWritePtr[3], uv.x, uv.y); _VtxWritePtr[3].col = col;
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -761,10 +857,10 @@ void ImDrawList::PrimRectUV(const ImVec2& a, const ImVec2& c, const ImVec2& uv_a
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
-    _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv_a; _VtxWritePtr[0].col = col;
-    _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv_b; _VtxWritePtr[1].col = col;
-    _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv_c; _VtxWritePtr[2].col = col;
-    _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv_d; _VtxWritePtr[3].col = col;
+    IM_DRAWVERT_WRITE_POS(_VtxWritePtr[0], a.x, a.y); IM_DRAWVERT_WRITE_UV(_VtxWritePtr[0], uv_a.x, uv_a.y); _VtxWritePtr[0].col = col;
+    IM_DRAWVERT_WRITE_POS(_VtxWritePtr[1], b.x, b.y); IM_DRAWVERT_WRITE_UV(_VtxWritePtr[1], uv_b.x, uv_b.y); _VtxWritePtr[1].col = col;
+    IM_DRAWVERT_WRITE_POS(_VtxWritePtr[2], c.x, c.y); IM_DRAWVERT_WRITE_UV(_VtxWritePtr[2], uv_c.x, uv_c.y); _VtxWritePtr[2].col = col;
+    IM_DRAWVERT_WRITE_POS(_VtxWritePtr[3], d.x, d.y); IM_DRAWVERT_WRITE_UV(_VtxWritePtr[3], uv_d.x, uv_d.y); _VtxWritePtr[3].col = col;
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -775,10 +871,10 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
-    _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv_a; _VtxWritePtr[0].col = col;
-    _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv_b; _VtxWritePtr[1].col = col;
-    _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv_c; _VtxWritePtr[2].col = col;
-    _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv_d; _VtxWritePtr[3].col = col;
+    IM_DRAWVERT_WRITE_POS(_VtxWritePtr[0], a.x, a.y); IM_DRAWVERT_WRITE_UV(_VtxWritePtr[0], uv_a.x, uv_a.y); _VtxWritePtr[0].col = col;
+    IM_DRAWVERT_WRITE_POS(_VtxWritePtr[1], b.x, b.y); IM_DRAWVERT_WRITE_UV(_VtxWritePtr[1], uv_b.x, uv_b.y); _VtxWritePtr[1].col = col;
+    IM_DRAWVERT_WRITE_POS(_VtxWritePtr[2], c.x, c.y); IM_DRAWVERT_WRITE_UV(_VtxWritePtr[2], uv_c.x, uv_c.y); _VtxWritePtr[2].col = col;
+    IM_DRAWVERT_WRITE_POS(_VtxWritePtr[3], d.x, d.y); IM_DRAWVERT_WRITE_UV(_VtxWritePtr[3], uv_d.x, uv_d.y); _VtxWritePtr[3].col = col;
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -791,6 +887,298 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+// Polyline tessellation helpers used by AddPolyline().
+// - SIMD versions (SSE, or NEON on AArch64) process two points at a time. Indices are written with SSE2 or NEON integer operations. They perform the same floating-point operations
+//   in the same order as the scalar code (including ImRsqrt() approximation), so both produce identical vertices.
+//   Not used when scalar float operations may be evaluated with extra precision (e.g. x87 math on 32-bit x86), as results would differ.
+// - Using macros rather than functions for the same reason as above (debug builds).
+// - 'use_simd' parameters are only false when ImDrawListSharedData::DebugPolylineNoSimd is set, to compare both code paths.
+#if defined(IMGUI_ENABLE_SSE) && (!defined(__FLT_EVAL_METHOD__) || __FLT_EVAL_METHOD__ == 0)
+#define IM_POLYLINE_SIMD
+typedef __m128 ImPolylineF4;    // 2 x ImVec2
+#define IM_POLYLINE_F4_LOAD(P)                  _mm_loadu_ps(&(P)->x)
+#define IM_POLYLINE_F4_STORE(P, V)              _mm_storeu_ps(&(P)->x, V)
+#define IM_POLYLINE_F4_STORE_LO(P, V)           _mm_storel_pi((__m64*)(void*)(P), V)
+#define IM_POLYLINE_F4_STORE_HI(P, V)           _mm_storeh_pi((__m64*)(void*)(P), V)
+#define IM_POLYLINE_F4_SET1(F)                  _mm_set1_ps(F)
+#define IM_POLYLINE_F4_ADD(A, B)                _mm_add_ps(A, B)
+#define IM_POLYLINE_F4_SUB(A, B)                _mm_sub_ps(A, B)
+#define IM_POLYLINE_F4_MUL(A, B)                _mm_mul_ps(A, B)
+#define IM_POLYLINE_F4_DIV(A, B)                _mm_div_ps(A, B)
+#define IM_POLYLINE_F4_MIN(A, B)                _mm_min_ps(A, B)
+#define IM_POLYLINE_F4_RSQRT(A)                 _mm_rsqrt_ps(A)                                                 // Same as ImRsqrt()
+#define IM_POLYLINE_F4_SWAP_XY(A)               _mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 3, 0, 1))
+#define IM_POLYLINE_F4_NEG_Y(A)                 _mm_xor_ps(A, _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f))
+#define IM_POLYLINE_F4_SELECT_GT(A, B, T, F)    _mm_or_ps(_mm_and_ps(_mm_cmpgt_ps(A, B), T), _mm_andnot_ps(_mm_cmpgt_ps(A, B), F))  // (A > B) ? T : F
+#ifdef IMGUI_ENABLE_SSE2
+#define IM_POLYLINE_IDX_SIMD
+#define IM_POLYLINE_IDX_ADD_STORE(DST, SRC, B)  _mm_storeu_si128((__m128i*)(void*)(DST), (sizeof(ImDrawIdx) == 2) ? _mm_add_epi16(_mm_set1_epi16((short)(B)), _mm_loadu_si128((const __m128i*)(const void*)(SRC))) : _mm_add_epi32(_mm_set1_epi32((int)(B)), _mm_loadu_si128((const __m128i*)(const void*)(SRC))))
+#endif
+#elif defined(IMGUI_ENABLE_NEON)
+#define IM_POLYLINE_SIMD
+#define IM_POLYLINE_IDX_SIMD
+typedef float32x4_t ImPolylineF4;
+static const float ImPolylineSignsNegY[4] = { 1.0f, -1.0f, 1.0f, -1.0f };
+#define IM_POLYLINE_F4_LOAD(P)                  vld1q_f32(&(P)->x)
+#define IM_POLYLINE_F4_STORE(P, V)              vst1q_f32(&(P)->x, V)
+#define IM_POLYLINE_F4_STORE_LO(P, V)           vst1_f32(&(P)->x, vget_low_f32(V))
+#define IM_POLYLINE_F4_STORE_HI(P, V)           vst1_f32(&(P)->x, vget_high_f32(V))
+#define IM_POLYLINE_F4_SET1(F)                  vdupq_n_f32(F)
+#define IM_POLYLINE_F4_ADD(A, B)                vaddq_f32(A, B)
+#define IM_POLYLINE_F4_SUB(A, B)                vsubq_f32(A, B)
+#define IM_POLYLINE_F4_MUL(A, B)                vmulq_f32(A, B)
+#define IM_POLYLINE_F4_DIV(A, B)                vdivq_f32(A, B)
+#define IM_POLYLINE_F4_MIN(A, B)                vbslq_f32(vcltq_f32(A, B), A, B)                                // Same as _mm_min_ps() and scalar code
+#define IM_POLYLINE_F4_RSQRT(A)                 vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(A))                     // Same as ImRsqrt()
+#define IM_POLYLINE_F4_SWAP_XY(A)               vrev64q_f32(A)
+#define IM_POLYLINE_F4_NEG_Y(A)                 vmulq_f32(A, vld1q_f32(ImPolylineSignsNegY))
+#define IM_POLYLINE_F4_SELECT_GT(A, B, T, F)    vbslq_f32(vcgtq_f32(A, B), T, F)
+#define IM_POLYLINE_IDX_ADD_STORE(DST, SRC, B)  if (sizeof(ImDrawIdx) == 2) vst1q_u16((uint16_t*)(void*)(DST), vaddq_u16(vdupq_n_u16((uint16_t)(B)), vld1q_u16((const uint16_t*)(const void*)(SRC)))); else vst1q_u32((uint32_t*)(void*)(DST), vaddq_u32(vdupq_n_u32((uint32_t)(B)), vld1q_u32((const uint32_t*)(const void*)(SRC))))
+#endif
+
+// Normals of each line segment. On open lines, the last point reuses the normal of the last segment.
+static void ImPolylineComputeNormals(const ImVec2* points, const int points_count, bool closed, ImVec2* out_normals, bool use_simd)
+{
+    const int count = closed ? points_count : points_count - 1;
+    int i1 = 0;
+#ifdef IM_POLYLINE_SIMD
+    const ImPolylineF4 zero = IM_POLYLINE_F4_SET1(0.0f);
+    for (; use_simd && i1 + 2 < points_count; i1 += 2) // Two segments which are not wrapping around
+    {
+        ImPolylineF4 d = IM_POLYLINE_F4_SUB(IM_POLYLINE_F4_LOAD(&points[i1 + 1]), IM_POLYLINE_F4_LOAD(&points[i1]));
+        const ImPolylineF4 d_sq = IM_POLYLINE_F4_MUL(d, d);
+        const ImPolylineF4 d2 = IM_POLYLINE_F4_ADD(d_sq, IM_POLYLINE_F4_SWAP_XY(d_sq));
+        d = IM_POLYLINE_F4_SELECT_GT(d2, zero, IM_POLYLINE_F4_MUL(d, IM_POLYLINE_F4_RSQRT(d2)), d);
+        IM_POLYLINE_F4_STORE(&out_normals[i1], IM_POLYLINE_F4_NEG_Y(IM_POLYLINE_F4_SWAP_XY(d)));
+    }
+#else
+    IM_UNUSED(use_simd);
+#endif
+    for (; i1 < count; i1++)
+    {
+        const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+        float dx = points[i2].x - points[i1].x;
+        float dy = points[i2].y - points[i1].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        out_normals[i1].x = dy;
+        out_normals[i1].y = -dx;
+    }
+    if (!closed)
+        out_normals[points_count - 1] = out_normals[points_count - 2];
+}
+
+// Offsets to the edges at each point: average of the normals of the two segments joining at this point, fixed so that the line keeps its thickness.
+// On open lines, the first point uses the normal of the first segment.
+static void ImPolylineComputeOffsets(const ImVec2* normals, const int points_count, bool closed, ImVec2* out_offsets, bool use_simd)
+{
+    int i2 = 1;
+#ifdef IM_POLYLINE_SIMD
+    const ImPolylineF4 half = IM_POLYLINE_F4_SET1(0.5f);
+    const ImPolylineF4 one = IM_POLYLINE_F4_SET1(1.0f);
+    const ImPolylineF4 d2_min = IM_POLYLINE_F4_SET1(0.000001f);
+    const ImPolylineF4 inv_len2_max = IM_POLYLINE_F4_SET1(IM_FIXNORMAL2F_MAX_INVLEN2);
+    for (; use_simd && i2 + 1 < points_count; i2 += 2)
+    {
+        ImPolylineF4 dm = IM_POLYLINE_F4_MUL(IM_POLYLINE_F4_ADD(IM_POLYLINE_F4_LOAD(&normals[i2 - 1]), IM_POLYLINE_F4_LOAD(&normals[i2])), half);
+        const ImPolylineF4 dm_sq = IM_POLYLINE_F4_MUL(dm, dm);
+        const ImPolylineF4 d2 = IM_POLYLINE_F4_ADD(dm_sq, IM_POLYLINE_F4_SWAP_XY(dm_sq));
+        const ImPolylineF4 inv_len2 = IM_POLYLINE_F4_MIN(IM_POLYLINE_F4_DIV(one, d2), inv_len2_max);
+        dm = IM_POLYLINE_F4_SELECT_GT(d2, d2_min, IM_POLYLINE_F4_MUL(dm, inv_len2), dm);
+        IM_POLYLINE_F4_STORE(&out_offsets[i2], dm);
+    }
+#else
+    IM_UNUSED(use_simd);
+#endif
+    for (; i2 <= points_count; i2++)
+    {
+        const int i1 = i2 - 1;
+        if (i2 == points_count && !closed)
+        {
+            out_offsets[0] = normals[0];
+            break;
+        }
+        const int i2_wrapped = (i2 == points_count) ? 0 : i2;
+        float dm_x = (normals[i1].x + normals[i2_wrapped].x) * 0.5f;
+        float dm_y = (normals[i1].y + normals[i2_wrapped].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        out_offsets[i2_wrapped].x = dm_x;
+        out_offsets[i2_wrapped].y = dm_y;
+    }
+}
+
+// Vertex layout of anti-aliased polylines: each point is expanded into <VtxStride> vertices, at 'point + offset * Scales[n]'.
+struct ImPolylineLayout
+{
+    int         VtxStride;
+    float       Scales[4];
+    ImVec2      Uvs[4];
+    ImU32       ColMasks[4];    // Applied to line color (fringe vertices are transparent)
+};
+
+static void ImPolylineCalcLayout(const ImDrawList* draw_list, float thickness, ImPolylineLayout* out)
+{
+    const float AA_SIZE = draw_list->_FringeScale;
+    const bool thick_line = (thickness > draw_list->_FringeScale);
+    const ImVec2 opaque_uv = draw_list->_Data->TexUvWhitePixel;
+
+    // Thicknesses <1.0 should behave like thickness 1.0
+    thickness = ImMax(thickness, 1.0f);
+    const int integer_thickness = (int)thickness;
+    const float fractional_thickness = thickness - integer_thickness;
+
+    // Do we want to draw this line using a texture?
+    // - For now, only draw integer-width lines using textures to avoid issues with the way scaling occurs, could be improved.
+    // - If AA_SIZE is not 1.0f we cannot use the texture path.
+    const bool use_texture = (draw_list->Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f) && (AA_SIZE == 1.0f);
+
+    // We should never hit this, because NewFrame() doesn't set ImDrawListFlags_AntiAliasedLinesUseTex unless ImFontAtlasFlags_NoBakedLines is off
+    IM_ASSERT_PARANOID(!use_texture || !(draw_list->_Data->Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedLines));
+
+    const ImU32 mask_opaque = ~0u;
+    const ImU32 mask_trans = ~IM_COL32_A_MASK;
+    if (use_texture)
+    {
+        // [PATH 1] Texture-based lines (thick or non-thick): we only need to emit the left/right edge vertices.
+        // The width of the geometry we need to draw is <thickness> pixels for the line itself, plus "one pixel" for AA.
+        // We don't use AA_SIZE here because the +1 is tied to the generated texture (see ImFontAtlasBuildRenderLinesTexData()
+        // function), and so alternate values won't work without changes to that code.
+        const float half_draw_size = (thickness * 0.5f) + 1;
+        const ImVec4 tex_uvs = draw_list->_Data->TexUvLines[integer_thickness];
+        out->VtxStride = 2;
+        out->Scales[0] = +half_draw_size; out->Uvs[0] = ImVec2(tex_uvs.x, tex_uvs.y); out->ColMasks[0] = mask_opaque; // Left-side outer edge
+        out->Scales[1] = -half_draw_size; out->Uvs[1] = ImVec2(tex_uvs.z, tex_uvs.w); out->ColMasks[1] = mask_opaque; // Right-side outer edge
+    }
+    else if (!thick_line)
+    {
+        // [PATH 2] Non texture-based lines (non-thick): we need the center vertex as well.
+        // We would allow AA_SIZE to potentially be != 1.0f with a patch (e.g. fringe_scale patch to allow scaling geometry while preserving one-screen-pixel AA fringe).
+        const float half_draw_size = AA_SIZE;
+        out->VtxStride = 3;
+        out->Scales[0] = 0.0f;            out->Uvs[0] = opaque_uv; out->ColMasks[0] = mask_opaque;    // Center of line
+        out->Scales[1] = +half_draw_size; out->Uvs[1] = opaque_uv; out->ColMasks[1] = mask_trans;     // Left-side outer edge
+        out->Scales[2] = -half_draw_size; out->Uvs[2] = opaque_uv; out->ColMasks[2] = mask_trans;     // Right-side outer edge
+    }
+    else
+    {
+        // [PATH 3] Non texture-based lines (thick): we need to draw the solid line core and thus require four vertices per point
+        const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
+        out->VtxStride = 4;
+        out->Scales[0] = +(half_inner_thickness + AA_SIZE); out->Uvs[0] = opaque_uv; out->ColMasks[0] = mask_trans;
+        out->Scales[1] = +half_inner_thickness;             out->Uvs[1] = opaque_uv; out->ColMasks[1] = mask_opaque;
+        out->Scales[2] = -half_inner_thickness;             out->Uvs[2] = opaque_uv; out->ColMasks[2] = mask_opaque;
+        out->Scales[3] = -(half_inner_thickness + AA_SIZE); out->Uvs[3] = opaque_uv; out->ColMasks[3] = mask_trans;
+    }
+}
+
+// Write 'vtx_stride' vertices for each point, at position 'point + offset * scales[n]'.
+static void ImPolylineWriteVertices(ImDrawVert* out_vtx, const ImVec2* points, const ImVec2* offsets, const int points_count, const int vtx_stride, const float* scales, const ImVec2* uvs, const ImU32* cols, bool use_simd)
+{
+    int i = 0;
+#if defined(IM_POLYLINE_SIMD) && !defined(IMGUI_USE_COMPACT_DRAWVERT) // Storing float positions
+    ImPolylineF4 scales_f4[4];
+    for (int n = 0; n < vtx_stride; n++)
+        scales_f4[n] = IM_POLYLINE_F4_SET1(scales[n]);
+    for (; use_simd && i + 1 < points_count; i += 2)
+    {
+        const ImPolylineF4 p = IM_POLYLINE_F4_LOAD(&points[i]);
+        const ImPolylineF4 dm = IM_POLYLINE_F4_LOAD(&offsets[i]);
+        ImDrawVert* vtx0 = out_vtx + i * vtx_stride;
+        ImDrawVert* vtx1 = vtx0 + vtx_stride;
+        for (int n = 0; n < vtx_stride; n++)
+        {
+            const ImPolylineF4 pos = (scales[n] == 0.0f) ? p : IM_POLYLINE_F4_ADD(p, IM_POLYLINE_F4_MUL(dm, scales_f4[n]));
+            IM_POLYLINE_F4_STORE_LO(&vtx0[n].pos, pos); vtx0[n].uv = uvs[n]; vtx0[n].col = cols[n];
+            IM_POLYLINE_F4_STORE_HI(&vtx1[n].pos, pos); vtx1[n].uv = uvs[n]; vtx1[n].col = cols[n];
+        }
+    }
+#else
+    IM_UNUSED(use_simd);
+#endif
+    for (; i < points_count; i++)
+    {
+        ImDrawVert* vtx = out_vtx + i * vtx_stride;
+        for (int n = 0; n < vtx_stride; n++)
+        {
+            const float scale = scales[n];
+            if (scale == 0.0f)
+                IM_DRAWVERT_WRITE_POS(vtx[n], points[i].x, points[i].y);
+            else
+                IM_DRAWVERT_WRITE_POS(vtx[n], points[i].x + offsets[i].x * scale, points[i].y + offsets[i].y * scale);
+            IM_DRAWVERT_WRITE_UV(vtx[n], uvs[n].x, uvs[n].y);
+            vtx[n].col = cols[n];
+        }
+    }
+}
+
+// Write indices for each line segment, for 2, 3 or 4 vertices per point.
+// Vertex indices of a segment are relative to its first point vertices 'idx1', or second point vertices 'idx2 == idx1 + vtx_stride'
+// (the last segment of a closed line wraps around to 'idx_start').
+static void ImPolylineWriteIndices(ImDrawIdx* out_idx, const unsigned int idx_start, const int count, const int points_count, const int vtx_stride, bool use_simd)
+{
+    unsigned int idx1 = idx_start;
+    int i1 = 0;
+#ifdef IM_POLYLINE_IDX_SIMD
+    if (use_simd)
+    {
+        // Process groups of segments filling whole vectors, using a table of offsets relative to 'idx1'.
+        static const ImU8 offsets_stride2[] = { 2, 0, 1,  3, 1, 2 };
+        static const ImU8 offsets_stride3[] = { 3, 0, 2,  2, 5, 3,  4, 1, 0,  0, 3, 4 };
+        static const ImU8 offsets_stride4[] = { 5, 1, 2,  2, 6, 5,  5, 1, 0,  0, 4, 5,  6, 2, 3,  3, 7, 6 };
+        const ImU8* offsets = (vtx_stride == 2) ? offsets_stride2 : (vtx_stride == 3) ? offsets_stride3 : offsets_stride4;
+        const int idx_per_segment = vtx_stride * 6 - 6;
+        const int idx_per_vector = 16 / (int)sizeof(ImDrawIdx);
+        const int segments_per_group = (idx_per_segment % idx_per_vector == 0) ? 1 : (idx_per_segment * 2 % idx_per_vector == 0) ? 2 : 4;
+        const int idx_per_group = idx_per_segment * segments_per_group;
+        const int count_no_wrap = ImMin(count, points_count - 1);
+        ImDrawIdx group_offsets[18 * 4];
+        if (count_no_wrap >= segments_per_group)
+            for (int n = 0; n < idx_per_group; n++)
+                group_offsets[n] = (ImDrawIdx)((n / idx_per_segment) * vtx_stride + offsets[n % idx_per_segment]);
+        for (; i1 + segments_per_group <= count_no_wrap; i1 += segments_per_group)
+        {
+            for (int n = 0; n < idx_per_group; n += idx_per_vector)
+                IM_POLYLINE_IDX_ADD_STORE(out_idx + n, group_offsets + n, idx1);
+            out_idx += idx_per_group;
+            idx1 += (unsigned int)(segments_per_group * vtx_stride);
+        }
+    }
+#else
+    IM_UNUSED(use_simd);
+#endif
+    for (; i1 < count; i1++)
+    {
+        const unsigned int idx2 = (i1 + 1) == points_count ? idx_start : idx1 + vtx_stride;
+        if (vtx_stride == 2)
+        {
+            // Two triangles
+            out_idx[0] = (ImDrawIdx)(idx2 + 0); out_idx[1] = (ImDrawIdx)(idx1 + 0); out_idx[2] = (ImDrawIdx)(idx1 + 1); // Right tri
+            out_idx[3] = (ImDrawIdx)(idx2 + 1); out_idx[4] = (ImDrawIdx)(idx1 + 1); out_idx[5] = (ImDrawIdx)(idx2 + 0); // Left tri
+            out_idx += 6;
+        }
+        else if (vtx_stride == 3)
+        {
+            // Four triangles
+            out_idx[0] = (ImDrawIdx)(idx2 + 0); out_idx[1] = (ImDrawIdx)(idx1 + 0); out_idx[2] = (ImDrawIdx)(idx1 + 2); // Right tri 1
+            out_idx[3] = (ImDrawIdx)(idx1 + 2); out_idx[4] = (ImDrawIdx)(idx2 + 2); out_idx[5] = (ImDrawIdx)(idx2 + 0); // Right tri 2
+            out_idx[6] = (ImDrawIdx)(idx2 + 1); out_idx[7] = (ImDrawIdx)(idx1 + 1); out_idx[8] = (ImDrawIdx)(idx1 + 0); // Left tri 1
+            out_idx[9] = (ImDrawIdx)(idx1 + 0); out_idx[10] = (ImDrawIdx)(idx2 + 0); out_idx[11] = (ImDrawIdx)(idx2 + 1); // Left tri 2
+            out_idx += 12;
+        }
+        else
+        {
+            // Six triangles
+            out_idx[0]  = (ImDrawIdx)(idx2 + 1); out_idx[1]  = (ImDrawIdx)(idx1 + 1); out_idx[2]  = (ImDrawIdx)(idx1 + 2);
+            out_idx[3]  = (ImDrawIdx)(idx1 + 2); out_idx[4]  = (ImDrawIdx)(idx2 + 2); out_idx[5]  = (ImDrawIdx)(idx2 + 1);
+            out_idx[6]  = (ImDrawIdx)(idx2 + 1); out_idx[7]  = (ImDrawIdx)(idx1 + 1); out_idx[8]  = (ImDrawIdx)(idx1 + 0);
+            out_idx[9]  = (ImDrawIdx)(idx1 + 0); out_idx[10] = (ImDrawIdx)(idx2 + 0); out_idx[11] = (ImDrawIdx)(idx2 + 1);
+            out_idx[12] = (ImDrawIdx)(idx2 + 2); out_idx[13] = (ImDrawIdx)(idx1 + 2); out_idx[14] = (ImDrawIdx)(idx1 + 3);
+            out_idx[15] = (ImDrawIdx)(idx1 + 3); out_idx[16] = (ImDrawIdx)(idx2 + 3); out_idx[17] = (ImDrawIdx)(idx2 + 2);
+            out_idx += 18;
+        }
+        idx1 = idx2;
+    }
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
@@ -801,219 +1189,34 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
     const bool closed = (flags & ImDrawFlags_Closed) != 0;
     const ImVec2 opaque_uv = _Data->TexUvWhitePixel;
     const int count = closed ? points_count : points_count - 1; // The number of line segments we need to draw
-    const bool thick_line = (thickness > _FringeScale);
 
     if (Flags & ImDrawListFlags_AntiAliasedLines)
     {
         // Anti-aliased stroke
-        const float AA_SIZE = _FringeScale;
-        const ImU32 col_trans = col & ~IM_COL32_A_MASK;
-
-        // Thicknesses <1.0 should behave like thickness 1.0
-        thickness = ImMax(thickness, 1.0f);
-        const int integer_thickness = (int)thickness;
-        const float fractional_thickness = thickness - integer_thickness;
-
-        // Do we want to draw this line using a texture?
-        // - For now, only draw integer-width lines using textures to avoid issues with the way scaling occurs, could be improved.
-        // - If AA_SIZE is not 1.0f we cannot use the texture path.
-        const bool use_texture = (Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f) && (AA_SIZE == 1.0f);
-
-        // We should never hit this, because NewFrame() doesn't set ImDrawListFlags_AntiAliasedLinesUseTex unless ImFontAtlasFlags_NoBakedLines is off
-        IM_ASSERT_PARANOID(!use_texture || !(_Data->Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedLines));
-
-        const int idx_count = use_texture ? (count * 6) : (thick_line ? count * 18 : count * 12);
-        const int vtx_count = use_texture ? (points_count * 2) : (thick_line ? points_count * 4 : points_count * 3);
+        ImPolylineLayout layout;
+        ImPolylineCalcLayout(this, thickness, &layout);
+        const int vtx_stride = layout.VtxStride;
+        const int idx_count = count * (vtx_stride * 6 - 6);
+        const int vtx_count = points_count * vtx_stride;
         PrimReserve(idx_count, vtx_count);
 
         // Temporary buffer
-        // The first <points_count> items are normals at each line point, then after that there are either 2 or 4 temp points for each line point
-        _Data->TempBuffer.reserve_discard(points_count * ((use_texture || !thick_line) ? 3 : 5));
-        ImVec2* temp_normals = _Data->TempBuffer.Data;
-        ImVec2* temp_points = temp_normals + points_count;
-
-        // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
-        {
-            const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
-            float dx = points[i2].x - points[i1].x;
-            float dy = points[i2].y - points[i1].y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i1].x = dy;
-            temp_normals[i1].y = -dx;
-        }
-        if (!closed)
-            temp_normals[points_count - 1] = temp_normals[points_count - 2];
-
-        // If we are drawing a one-pixel-wide line without a texture, or a textured line of any width, we only need 2 or 3 vertices per point
-        if (use_texture || !thick_line)
-        {
-            // [PATH 1] Texture-based lines (thick or non-thick)
-            // [PATH 2] Non texture-based lines (non-thick)
-
-            // The width of the geometry we need to draw - this is essentially <thickness> pixels for the line itself, plus "one pixel" for AA.
-            // - In the texture-based path, we don't use AA_SIZE here because the +1 is tied to the generated texture
-            //   (see ImFontAtlasBuildRenderLinesTexData() function), and so alternate values won't work without changes to that code.
-            // - In the non texture-based paths, we would allow AA_SIZE to potentially be != 1.0f with a patch (e.g. fringe_scale patch to
-            //   allow scaling geometry while preserving one-screen-pixel AA fringe).
-            const float half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE;
-
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
-            {
-                temp_points[0] = points[0] + temp_normals[0] * half_draw_size;
-                temp_points[1] = points[0] - temp_normals[0] * half_draw_size;
-                temp_points[(points_count-1)*2+0] = points[points_count-1] + temp_normals[points_count-1] * half_draw_size;
-                temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
-            }
-
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
-            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
-            {
-                const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
-                const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                dm_x *= half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
-                dm_y *= half_draw_size;
-
-                // Add temporary vertices for the outer edges
-                ImVec2* out_vtx = &temp_points[i2 * 2];
-                out_vtx[0].x = points[i2].x + dm_x;
-                out_vtx[0].y = points[i2].y + dm_y;
-                out_vtx[1].x = points[i2].x - dm_x;
-                out_vtx[1].y = points[i2].y - dm_y;
-
-                if (use_texture)
-                {
-                    // Add indices for two triangles
-                    _IdxWritePtr[0] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[1] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[2] = (ImDrawIdx)(idx1 + 1); // Right tri
-                    _IdxWritePtr[3] = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[4] = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[5] = (ImDrawIdx)(idx2 + 0); // Left tri
-                    _IdxWritePtr += 6;
-                }
-                else
-                {
-                    // Add indexes for four triangles
-                    _IdxWritePtr[0] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[1] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[2] = (ImDrawIdx)(idx1 + 2); // Right tri 1
-                    _IdxWritePtr[3] = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4] = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5] = (ImDrawIdx)(idx2 + 0); // Right tri 2
-                    _IdxWritePtr[6] = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[7] = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[8] = (ImDrawIdx)(idx1 + 0); // Left tri 1
-                    _IdxWritePtr[9] = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[10] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[11] = (ImDrawIdx)(idx2 + 1); // Left tri 2
-                    _IdxWritePtr += 12;
-                }
-
-                idx1 = idx2;
-            }
-
-            // Add vertices for each point on the line
-            if (use_texture)
-            {
-                // If we're using textures we only need to emit the left/right edge vertices
-                ImVec4 tex_uvs = _Data->TexUvLines[integer_thickness];
-                /*if (fractional_thickness != 0.0f) // Currently always zero when use_texture==false!
-                {
-                    const ImVec4 tex_uvs_1 = _Data->TexUvLines[integer_thickness + 1];
-                    tex_uvs.x = tex_uvs.x + (tex_uvs_1.x - tex_uvs.x) * fractional_thickness; // inlined ImLerp()
-                    tex_uvs.y = tex_uvs.y + (tex_uvs_1.y - tex_uvs.y) * fractional_thickness;
-                    tex_uvs.z = tex_uvs.z + (tex_uvs_1.z - tex_uvs.z) * fractional_thickness;
-                    tex_uvs.w = tex_uvs.w + (tex_uvs_1.w - tex_uvs.w) * fractional_thickness;
-                }*/
-                ImVec2 tex_uv0(tex_uvs.x, tex_uvs.y);
-                ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
-                for (int i = 0; i < points_count; i++)
-                {
-                    _VtxWritePtr[0].pos = temp_points[i * 2 + 0]; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 1]; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
-                    _VtxWritePtr += 2;
-                }
-            }
-            else
-            {
-                // If we're not using a texture, we need the center vertex as well
-                for (int i = 0; i < points_count; i++)
-                {
-                    _VtxWritePtr[0].pos = points[i];              _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 0]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
-                    _VtxWritePtr[2].pos = temp_points[i * 2 + 1]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
-                    _VtxWritePtr += 3;
-                }
-            }
-        }
-        else
-        {
-            // [PATH 2] Non texture-based lines (thick): we need to draw the solid line core and thus require four vertices per point
-            const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
-
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
-            {
-                const int points_last = points_count - 1;
-                temp_points[0] = points[0] + temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[1] = points[0] + temp_normals[0] * (half_inner_thickness);
-                temp_points[2] = points[0] - temp_normals[0] * (half_inner_thickness);
-                temp_points[3] = points[0] - temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 0] = points[points_last] + temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 1] = points[points_last] + temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 2] = points[points_last] - temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-            }
-
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
-            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
-            {
-                const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
-                const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
-                float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
-                float dm_in_x = dm_x * half_inner_thickness;
-                float dm_in_y = dm_y * half_inner_thickness;
-
-                // Add temporary vertices
-                ImVec2* out_vtx = &temp_points[i2 * 4];
-                out_vtx[0].x = points[i2].x + dm_out_x;
-                out_vtx[0].y = points[i2].y + dm_out_y;
-                out_vtx[1].x = points[i2].x + dm_in_x;
-                out_vtx[1].y = points[i2].y + dm_in_y;
-                out_vtx[2].x = points[i2].x - dm_in_x;
-                out_vtx[2].y = points[i2].y - dm_in_y;
-                out_vtx[3].x = points[i2].x - dm_out_x;
-                out_vtx[3].y = points[i2].y - dm_out_y;
-
-                // Add indexes
-                _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
-                _IdxWritePtr[3]  = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2 + 1);
-                _IdxWritePtr[6]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[7]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[8]  = (ImDrawIdx)(idx1 + 0);
-                _IdxWritePtr[9]  = (ImDrawIdx)(idx1 + 0); _IdxWritePtr[10] = (ImDrawIdx)(idx2 + 0); _IdxWritePtr[11] = (ImDrawIdx)(idx2 + 1);
-                _IdxWritePtr[12] = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[13] = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[14] = (ImDrawIdx)(idx1 + 3);
-                _IdxWritePtr[15] = (ImDrawIdx)(idx1 + 3); _IdxWritePtr[16] = (ImDrawIdx)(idx2 + 3); _IdxWritePtr[17] = (ImDrawIdx)(idx2 + 2);
-                _IdxWritePtr += 18;
-
-                idx1 = idx2;
-            }
-
-            // Add vertices
-            for (int i = 0; i < points_count; i++)
-            {
-                _VtxWritePtr[0].pos = temp_points[i * 4 + 0]; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
-                _VtxWritePtr[1].pos = temp_points[i * 4 + 1]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-                _VtxWritePtr[2].pos = temp_points[i * 4 + 2]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-                _VtxWritePtr[3].pos = temp_points[i * 4 + 3]; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
-                _VtxWritePtr += 4;
-            }
-        }
+        // The first <points_count> items are normals of each line segment, then offsets to the edges at each line point
+        _TempBuffer.reserve_discard(points_count * 2);
+        ImVec2* temp_normals = _TempBuffer.Data;
+        ImVec2* temp_offsets = temp_normals + points_count;
+        const bool use_simd = !_Data->DebugPolylineNoSimd;
+        ImPolylineComputeNormals(points, points_count, closed, temp_normals, use_simd);
+        ImPolylineComputeOffsets(temp_normals, points_count, closed, temp_offsets, use_simd);
+
+        // Add vertices and indices
+        ImU32 vtx_cols[4];
+        for (int n = 0; n < vtx_stride; n++)
+            vtx_cols[n] = col & layout.ColMasks[n];
+        ImPolylineWriteVertices(_VtxWritePtr, points, temp_offsets, points_count, vtx_stride, layout.Scales, layout.Uvs, vtx_cols, use_simd);
+        ImPolylineWriteIndices(_IdxWritePtr, _VtxCurrentIdx, count, points_count, vtx_stride, use_simd);
+        _VtxWritePtr += vtx_count;
+        _IdxWritePtr += idx_count;
         _VtxCurrentIdx += (ImDrawIdx)vtx_count;
     }
     else
@@ -1035,10 +1238,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             dx *= (thickness * 0.5f);
             dy *= (thickness * 0.5f);
 
-            _VtxWritePtr[0].pos.x = p1.x + dy; _VtxWritePtr[0].pos.y = p1.y - dx; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;
-            _VtxWritePtr[1].pos.x = p2.x + dy; _VtxWritePtr[1].pos.y = p2.y - dx; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-            _VtxWritePtr[2].pos.x = p2.x - dy; _VtxWritePtr[2].pos.y = p2.y + dx; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-            _VtxWritePtr[3].pos.x = p1.x - dy; _VtxWritePtr[3].pos.y = p1.y + dx; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col;
+            IM_DRAWVERT_WRITE_POS(_VtxWritePtr[0], p1.x + dy, p1.y - dx); IM_DRAWVERT_WRITE_UV(_VtxWritePtr[0], opaque_uv.x, opaque_uv.y); _VtxWritePtr[0].col = col;
+            IM_DRAWVERT_WRITE_POS(_VtxWritePtr[1], p2.x + dy, p2.y - dx); IM_DRAWVERT_WRITE_UV(_VtxWritePtr[1], opaque_uv.x, opaque_uv.y); _VtxWritePtr[1].col = col;
+            IM_DRAWVERT_WRITE_POS(_VtxWritePtr[2], p2.x - dy, p2.y + dx); IM_DRAWVERT_WRITE_UV(_VtxWritePtr[2], opaque_uv.x, opaque_uv.y); _VtxWritePtr[2].col = col;
+            IM_DRAWVERT_WRITE_POS(_VtxWritePtr[3], p1.x - dy, p1.y + dx); IM_DRAWVERT_WRITE_UV(_VtxWritePtr[3], opaque_uv.x, opaque_uv.y); _VtxWritePtr[3].col = col;
             _VtxWritePtr += 4;
 
             _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx + 1); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx + 2);
@@ -1077,8 +1280,8 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
         }
 
         // Compute normals
-        _Data->TempBuffer.reserve_discard(points_count);
-        ImVec2* temp_normals = _Data->TempBuffer.Data;
+        _TempBuffer.reserve_discard(points_count);
+        ImVec2* temp_normals = _TempBuffer.Data;
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
             const ImVec2& p0 = points[i0];
@@ -1102,8 +1305,8 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             dm_y *= AA_SIZE * 0.5f;
 
             // Add vertices
-            _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
-            _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
+            IM_DRAWVERT_WRITE_POS(_VtxWritePtr[0], points[i1].x - dm_x, points[i1].y - dm_y); IM_DRAWVERT_WRITE_UV(_VtxWritePtr[0], uv.x, uv.y); _VtxWritePtr[0].col = col;        // Inner
+            IM_DRAWVERT_WRITE_POS(_VtxWritePtr[1], points[i1].x + dm_x, points[i1].y + dm_y); IM_DRAWVERT_WRITE_UV(_VtxWritePtr[1], uv.x, uv.y); _VtxWritePtr[1].col = col_trans;  // Outer
             _VtxWritePtr += 2;
 
             // Add indexes for fringes
@@ -1121,7 +1324,7 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
         PrimReserve(idx_count, vtx_count);
         for (int i = 0; i < vtx_count; i++)
         {
-            _VtxWritePtr[0].pos = points[i]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
+            IM_DRAWVERT_WRITE_POS(_VtxWritePtr[0], points[i].x, points[i].y); IM_DRAWVERT_WRITE_UV(_VtxWritePtr[0], uv.x, uv.y); _VtxWritePtr[0].col = col;
             _VtxWritePtr++;
         }
         for (int i = 2; i < points_count; i++)
@@ -1643,6 +1846,279 @@ void ImDrawList::AddNgonFilled(const ImVec2& center, float radius, ImU32 col, in
     PathFillConvex(col);
 }
 
+// Batched primitives: reserve once per chunk of items, then write vertices and indices in a tight loop.
+// - Chunks are limited in size so that PrimReserve() can still switch to a new VtxOffset with 16-bit indices.
+// - Unused reserved space (skipped items) is given back with PrimUnreserve() at the end of each chunk.
+#define IM_DRAWLIST_BATCH_CHUNK_VTX_MAX     (1 << 14)
+
+// With 16-bit indices, stop a chunk where a new VtxOffset would be needed so we split draw commands at the same place as individual calls would.
+static inline int ImDrawListBatchCalcChunkSize(const ImDrawList* draw_list, int items_remaining, int vtx_per_item)
+{
+    int items_count = ImMin(items_remaining, ImMax(IM_DRAWLIST_BATCH_CHUNK_VTX_MAX / vtx_per_item, 1));
+    if (sizeof(ImDrawIdx) == 2 && (draw_list->Flags & ImDrawListFlags_AllowVtxOffset))
+    {
+        const int items_fitting = (int)((1 << 16) - 1 - draw_list->_VtxCurrentIdx) / vtx_per_item;
+        if (items_fitting > 0)
+            items_count = ImMin(items_count, items_fitting);
+    }
+    return items_count;
+}
+
+static inline bool ImDrawListBatchIsCulled(const ImVec4& clip_rect, float min_x, float min_y, float max_x, float max_y)
+{
+    return max_x < clip_rect.x || max_y < clip_rect.y || min_x > clip_rect.z || min_y > clip_rect.w;
+}
+
+// p_min_max[n * 2 + 0] = upper-left, p_min_max[n * 2 + 1] = lower-right.
+// Same output as calling AddRectFilled() without rounding for each item.
+void ImDrawList::AddRectFilledBatch(const ImVec2* p_min_max, int count, ImU32 col, const ImU32* cols, ImDrawFlags flags)
+{
+    const bool cull = (flags & ImDrawFlags_CullToClipRect) != 0;
+    const ImVec4 clip_rect = _CmdHeader.ClipRect;
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    for (int chunk_start = 0, chunk_end = 0; chunk_start < count; chunk_start = chunk_end)
+    {
+        chunk_end = chunk_start + ImDrawListBatchCalcChunkSize(this, count - chunk_start, 4);
+        PrimReserve((chunk_end - chunk_start) * 6, (chunk_end - chunk_start) * 4);
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int idx = _VtxCurrentIdx;
+        for (int n = chunk_start; n < chunk_end; n++)
+        {
+            const ImU32 item_col = cols ? cols[n] : col;
+            const ImVec2& a = p_min_max[n * 2 + 0];
+            const ImVec2& c = p_min_max[n * 2 + 1];
+            if ((item_col & IM_COL32_A_MASK) == 0 || (cull && ImDrawListBatchIsCulled(clip_rect, a.x, a.y, c.x, c.y)))
+                continue;
+            idx_write[0] = (ImDrawIdx)idx; idx_write[1] = (ImDrawIdx)(idx + 1); idx_write[2] = (ImDrawIdx)(idx + 2);
+            idx_write[3] = (ImDrawIdx)idx; idx_write[4] = (ImDrawIdx)(idx + 2); idx_write[5] = (ImDrawIdx)(idx + 3);
+            IM_DRAWVERT_WRITE_POS(vtx_write[0], a.x, a.y); IM_DRAWVERT_WRITE_UV(vtx_write[0], uv.x, uv.y); vtx_write[0].col = item_col;
+            IM_DRAWVERT_WRITE_POS(vtx_write[1], c.x, a.y); IM_DRAWVERT_WRITE_UV(vtx_write[1], uv.x, uv.y); vtx_write[1].col = item_col;
+            IM_DRAWVERT_WRITE_POS(vtx_write[2], c.x, c.y); IM_DRAWVERT_WRITE_UV(vtx_write[2], uv.x, uv.y); vtx_write[2].col = item_col;
+            IM_DRAWVERT_WRITE_POS(vtx_write[3], a.x, c.y); IM_DRAWVERT_WRITE_UV(vtx_write[3], uv.x, uv.y); vtx_write[3].col = item_col;
+            vtx_write += 4;
+            idx_write += 6;
+            idx += 4;
+        }
+        const int skipped_count = (chunk_end - chunk_start) - (int)(vtx_write - _VtxWritePtr) / 4;
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = idx;
+        PrimUnreserve(skipped_count * 6, skipped_count * 4);
+    }
+}
+
+// p1_p2[n * 2 + 0] = start, p1_p2[n * 2 + 1] = end.
+// Same output as calling AddLine() for each item.
+void ImDrawList::AddLineBatch(const ImVec2* p1_p2, int count, ImU32 col, float thickness, const ImU32* cols, ImDrawFlags flags)
+{
+    const bool cull = (flags & ImDrawFlags_CullToClipRect) != 0;
+    const ImVec4 clip_rect = _CmdHeader.ClipRect;
+    const ImVec2 half_pixel(0.5f, 0.5f); // Same offset as AddLine()
+    const float cull_extent = ImMax(thickness, 1.0f) * 0.5f + ImMax(_FringeScale, 1.0f);
+
+    // Same vertex layout as AddPolyline() for a 2 points open polyline
+    const bool anti_aliased = (Flags & ImDrawListFlags_AntiAliasedLines) != 0;
+    ImPolylineLayout layout;
+    if (anti_aliased)
+        ImPolylineCalcLayout(this, thickness, &layout);
+    const int vtx_stride = anti_aliased ? layout.VtxStride : 2; // Non anti-aliased lines use 4 vertices per segment
+    const int vtx_per_item = vtx_stride * 2;
+    const int idx_per_item = anti_aliased ? (vtx_stride * 6 - 6) : 6;
+    const ImVec2 opaque_uv = _Data->TexUvWhitePixel;
+
+    for (int chunk_start = 0, chunk_end = 0; chunk_start < count; chunk_start = chunk_end)
+    {
+        chunk_end = chunk_start + ImDrawListBatchCalcChunkSize(this, count - chunk_start, vtx_per_item);
+        PrimReserve((chunk_end - chunk_start) * idx_per_item, (chunk_end - chunk_start) * vtx_per_item);
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int idx = _VtxCurrentIdx;
+        for (int n = chunk_start; n < chunk_end; n++)
+        {
+            const ImU32 item_col = cols ? cols[n] : col;
+            const ImVec2 p1 = p1_p2[n * 2 + 0] + half_pixel;
+            const ImVec2 p2 = p1_p2[n * 2 + 1] + half_pixel;
+            if ((item_col & IM_COL32_A_MASK) == 0)
+                continue;
+            if (cull && ImDrawListBatchIsCulled(clip_rect, ImMin(p1.x, p2.x) - cull_extent, ImMin(p1.y, p2.y) - cull_extent, ImMax(p1.x, p2.x) + cull_extent, ImMax(p1.y, p2.y) + cull_extent))
+                continue;
+
+            float dx = p2.x - p1.x;
+            float dy = p2.y - p1.y;
+            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+            if (anti_aliased)
+            {
+                // Offsets at first point (segment normal) and second point (fixed normal), see ImPolylineComputeOffsets()
+                float dm_x = dy;
+                float dm_y = -dx;
+                IM_FIXNORMAL2F(dm_x, dm_y);
+                for (int v = 0; v < vtx_stride; v++)
+                {
+                    const float scale = layout.Scales[v];
+                    const ImU32 vtx_col = item_col & layout.ColMasks[v];
+                    ImDrawVert* vtx1 = &vtx_write[v];
+                    ImDrawVert* vtx2 = &vtx_write[vtx_stride + v];
+                    if (scale == 0.0f)
+                    {
+                        IM_DRAWVERT_WRITE_POS(*vtx1, p1.x, p1.y);
+                        IM_DRAWVERT_WRITE_POS(*vtx2, p2.x, p2.y);
+                    }
+                    else
+                    {
+                        IM_DRAWVERT_WRITE_POS(*vtx1, p1.x + dy * scale, p1.y + -dx * scale);
+                        IM_DRAWVERT_WRITE_POS(*vtx2, p2.x + dm_x * scale, p2.y + dm_y * scale);
+                    }
+                    IM_DRAWVERT_WRITE_UV(*vtx1, layout.Uvs[v].x, layout.Uvs[v].y);
+                    IM_DRAWVERT_WRITE_UV(*vtx2, layout.Uvs[v].x, layout.Uvs[v].y);
+                    vtx1->col = vtx2->col = vtx_col;
+                }
+                ImPolylineWriteIndices(idx_write, idx, 1, 2, vtx_stride, false); // Single segment: scalar code
+            }
+            else
+            {
+                // Same as AddPolyline() [PATH 4]
+                dx *= (thickness * 0.5f);
+                dy *= (thickness * 0.5f);
+                IM_DRAWVERT_WRITE_POS(vtx_write[0], p1.x + dy, p1.y - dx); IM_DRAWVERT_WRITE_UV(vtx_write[0], opaque_uv.x, opaque_uv.y); vtx_write[0].col = item_col;
+                IM_DRAWVERT_WRITE_POS(vtx_write[1], p2.x + dy, p2.y - dx); IM_DRAWVERT_WRITE_UV(vtx_write[1], opaque_uv.x, opaque_uv.y); vtx_write[1].col = item_col;
+                IM_DRAWVERT_WRITE_POS(vtx_write[2], p2.x - dy, p2.y + dx); IM_DRAWVERT_WRITE_UV(vtx_write[2], opaque_uv.x, opaque_uv.y); vtx_write[2].col = item_col;
+                IM_DRAWVERT_WRITE_POS(vtx_write[3], p1.x - dy, p1.y + dx); IM_DRAWVERT_WRITE_UV(vtx_write[3], opaque_uv.x, opaque_uv.y); vtx_write[3].col = item_col;
+                idx_write[0] = (ImDrawIdx)(idx); idx_write[1] = (ImDrawIdx)(idx + 1); idx_write[2] = (ImDrawIdx)(idx + 2);
+                idx_write[3] = (ImDrawIdx)(idx); idx_write[4] = (ImDrawIdx)(idx + 2); idx_write[5] = (ImDrawIdx)(idx + 3);
+            }
+            vtx_write += vtx_per_item;
+            idx_write += idx_per_item;
+            idx += (unsigned int)vtx_per_item;
+        }
+        const int skipped_count = (chunk_end - chunk_start) - (int)(vtx_write - _VtxWritePtr) / vtx_per_item;
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = idx;
+        PrimUnreserve(skipped_count * idx_per_item, skipped_count * vtx_per_item);
+    }
+}
+
+// Circles all share the same radius and tessellation, which we compute once.
+// Equivalent to calling AddCircleFilled() for each item (vertices may differ by rounding errors as the shape is computed around (0,0)).
+void ImDrawList::AddCircleFilledBatch(const ImVec2* centers, int count, float radius, ImU32 col, int num_segments, const ImU32* cols, ImDrawFlags flags)
+{
+    if (radius < 0.5f || count <= 0)
+        return;
+
+    // Build the shape around (0,0) at the end of _Path, same as AddCircleFilled()
+    const int path_start = _Path.Size;
+    if (num_segments <= 0)
+    {
+        _PathArcToFastEx(ImVec2(0.0f, 0.0f), radius, 0, IM_DRAWLIST_ARCFAST_SAMPLE_MAX, 0);
+        _Path.Size--;
+    }
+    else
+    {
+        num_segments = ImClamp(num_segments, 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
+        const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
+        PathArcTo(ImVec2(0.0f, 0.0f), radius, 0.0f, a_max, num_segments - 1);
+    }
+    const ImVec2* points = _Path.Data + path_start;
+    const int points_count = _Path.Size - path_start;
+    if (points_count < 3)
+    {
+        _Path.Size = path_start;
+        return;
+    }
+
+    // Compute inner/outer vertex offsets once, same as AddConvexPolyFilled()
+    const bool anti_aliased = (Flags & ImDrawListFlags_AntiAliasedFill) != 0;
+    const int vtx_per_item = anti_aliased ? points_count * 2 : points_count;
+    const int idx_per_item = anti_aliased ? (points_count - 2) * 3 + points_count * 6 : (points_count - 2) * 3;
+    _TempBuffer.reserve_discard(points_count * 3);
+    ImVec2* temp_normals = _TempBuffer.Data;
+    ImVec2* temp_offsets = temp_normals + points_count; // 1 (non-AA) or 2 (AA) offsets per point
+    if (anti_aliased)
+    {
+        const float AA_SIZE = _FringeScale;
+        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        {
+            float dx = points[i1].x - points[i0].x;
+            float dy = points[i1].y - points[i0].y;
+            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+            temp_normals[i0].x = dy;
+            temp_normals[i0].y = -dx;
+        }
+        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        {
+            float dm_x = (temp_normals[i0].x + temp_normals[i1].x) * 0.5f;
+            float dm_y = (temp_normals[i0].y + temp_normals[i1].y) * 0.5f;
+            IM_FIXNORMAL2F(dm_x, dm_y);
+            dm_x *= AA_SIZE * 0.5f;
+            dm_y *= AA_SIZE * 0.5f;
+            temp_offsets[i1 * 2 + 0] = ImVec2(points[i1].x - dm_x, points[i1].y - dm_y); // Inner
+            temp_offsets[i1 * 2 + 1] = ImVec2(points[i1].x + dm_x, points[i1].y + dm_y); // Outer
+        }
+    }
+    else
+    {
+        for (int i = 0; i < points_count; i++)
+            temp_offsets[i] = points[i];
+    }
+    _Path.Size = path_start;
+
+    const bool cull = (flags & ImDrawFlags_CullToClipRect) != 0;
+    const ImVec4 clip_rect = _CmdHeader.ClipRect;
+    const float cull_extent = radius + _FringeScale;
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    for (int chunk_start = 0, chunk_end = 0; chunk_start < count; chunk_start = chunk_end)
+    {
+        chunk_end = chunk_start + ImDrawListBatchCalcChunkSize(this, count - chunk_start, vtx_per_item);
+        PrimReserve((chunk_end - chunk_start) * idx_per_item, (chunk_end - chunk_start) * vtx_per_item);
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int idx = _VtxCurrentIdx;
+        for (int n = chunk_start; n < chunk_end; n++)
+        {
+            const ImU32 item_col = cols ? cols[n] : col;
+            const ImVec2 center = centers[n];
+            if ((item_col & IM_COL32_A_MASK) == 0 || (cull && ImDrawListBatchIsCulled(clip_rect, center.x - cull_extent, center.y - cull_extent, center.x + cull_extent, center.y + cull_extent)))
+                continue;
+
+            // Vertices
+            const ImU32 col_trans = item_col & ~IM_COL32_A_MASK;
+            for (int i = 0; i < vtx_per_item; i++)
+            {
+                IM_DRAWVERT_WRITE_POS(vtx_write[i], center.x + temp_offsets[i].x, center.y + temp_offsets[i].y);
+                IM_DRAWVERT_WRITE_UV(vtx_write[i], uv.x, uv.y);
+                vtx_write[i].col = (anti_aliased && (i & 1)) ? col_trans : item_col;
+            }
+
+            // Indices for fill, then for fringes
+            const unsigned int vtx_step = anti_aliased ? 2 : 1;
+            for (int i = 2; i < points_count; i++)
+            {
+                idx_write[0] = (ImDrawIdx)(idx); idx_write[1] = (ImDrawIdx)(idx + (i - 1) * vtx_step); idx_write[2] = (ImDrawIdx)(idx + i * vtx_step);
+                idx_write += 3;
+            }
+            if (anti_aliased)
+            {
+                const unsigned int vtx_inner_idx = idx;
+                const unsigned int vtx_outer_idx = idx + 1;
+                for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+                {
+                    idx_write[0] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1)); idx_write[1] = (ImDrawIdx)(vtx_inner_idx + (i0 << 1)); idx_write[2] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1));
+                    idx_write[3] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1)); idx_write[4] = (ImDrawIdx)(vtx_outer_idx + (i1 << 1)); idx_write[5] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1));
+                    idx_write += 6;
+                }
+            }
+            vtx_write += vtx_per_item;
+            idx += (unsigned int)vtx_per_item;
+        }
+        const int skipped_count = (chunk_end - chunk_start) - (int)(vtx_write - _VtxWritePtr) / vtx_per_item;
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = idx;
+        PrimUnreserve(skipped_count * idx_per_item, skipped_count * vtx_per_item);
+    }
+}
+
 // Ellipse
 void ImDrawList::AddEllipse(const ImVec2& center, const ImVec2& radius, ImU32 col, float rot, int num_segments, float thickness)
 {
@@ -2026,8 +2502,8 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
         unsigned int vtx_inner_idx = _VtxCurrentIdx;
         unsigned int vtx_outer_idx = _VtxCurrentIdx + 1;
 
-        _Data->TempBuffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
-        triangulator.Init(points, points_count, _Data->TempBuffer.Data);
+        _TempBuffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
+        triangulator.Init(points, points_count, _TempBuffer.Data);
         while (triangulator._TrianglesLeft > 0)
         {
             triangulator.GetNextTriangle(triangle);
@@ -2036,8 +2512,8 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
         }
 
         // Compute normals
-        _Data->TempBuffer.reserve_discard(points_count);
-        ImVec2* temp_normals = _Data->TempBuffer.Data;
+        _TempBuffer.reserve_discard(points_count);
+        ImVec2* temp_normals = _TempBuffer.Data;
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
             const ImVec2& p0 = points[i0];
@@ -2061,8 +2537,8 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
             dm_y *= AA_SIZE * 0.5f;
 
             // Add vertices
-            _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
-            _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
+            IM_DRAWVERT_WRITE_POS(_VtxWritePtr[0], points[i1].x - dm_x, points[i1].y - dm_y); IM_DRAWVERT_WRITE_UV(_VtxWritePtr[0], uv.x, uv.y); _VtxWritePtr[0].col = col;        // Inner
+            IM_DRAWVERT_WRITE_POS(_VtxWritePtr[1], points[i1].x + dm_x, points[i1].y + dm_y); IM_DRAWVERT_WRITE_UV(_VtxWritePtr[1], uv.x, uv.y); _VtxWritePtr[1].col = col_trans;  // Outer
             _VtxWritePtr += 2;
 
             // Add indexes for fringes
@@ -2080,11 +2556,11 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
         PrimReserve(idx_count, vtx_count);
         for (int i = 0; i < vtx_count; i++)
         {
-            _VtxWritePtr[0].pos = points[i]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
+            IM_DRAWVERT_WRITE_POS(_VtxWritePtr[0], points[i].x, points[i].y); IM_DRAWVERT_WRITE_UV(_VtxWritePtr[0], uv.x, uv.y); _VtxWritePtr[0].col = col;
             _VtxWritePtr++;
         }
-        _Data->TempBuffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
-        triangulator.Init(points, points_count, _Data->TempBuffer.Data);
+        _TempBuffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
+        triangulator.Init(points, points_count, _TempBuffer.Data);
         while (triangulator._TrianglesLeft > 0)
         {
             triangulator.GetNextTriangle(triangle);
@@ -2252,6 +2728,8 @@ void ImDrawData::Clear()
     DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.0f, 0.0f);
     OwnerViewport = NULL;
     Textures = NULL;
+    DamageTracked = false;
+    DamageRects.resize(0);
 }
 
 // Important: 'out_list' is generally going to be draw_data->CmdLists, but may be another temporary list
@@ -2334,34 +2812,320 @@ void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
     for (ImDrawList* draw_list : CmdLists)
         for (ImDrawCmd& cmd : draw_list->CmdBuffer)
             cmd.ClipRect = ImVec4(cmd.ClipRect.x * fb_scale.x, cmd.ClipRect.y * fb_scale.y, cmd.ClipRect.z * fb_scale.x, cmd.ClipRect.w * fb_scale.y);
+    for (ImVec4& rect : DamageRects)
+        rect = ImVec4(rect.x * fb_scale.x, rect.y * fb_scale.y, rect.z * fb_scale.x, rect.w * fb_scale.y);
 }
 
 //-----------------------------------------------------------------------------
-// [SECTION] Helpers ShadeVertsXXX functions
+// [SECTION] ImDrawDamageTracker
+//-----------------------------------------------------------------------------
+// Compute ImDrawData::DamageRects[] when io.ConfigDamageTracking is enabled. See comments above ImDrawDamageTracker in imgui_internal.h.
+// Hashes are only used to detect changes, they are not required to be of high quality: a collision would merely miss a redraw.
 //-----------------------------------------------------------------------------
 
-// Generic linear color gradient, write to RGB fields, leave A untouched.
-void ImGui::ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1)
+static inline ImU32 ImDrawDamageHashCombine(ImU32 h, ImU32 v)
 {
-    ImVec2 gradient_extent = gradient_p1 - gradient_p0;
-    float gradient_inv_length2 = 1.0f / ImLengthSqr(gradient_extent);
-    ImDrawVert* vert_start = draw_list->VtxBuffer.Data + vert_start_idx;
-    ImDrawVert* vert_end = draw_list->VtxBuffer.Data + vert_end_idx;
-    const int col0_r = (int)(col0 >> IM_COL32_R_SHIFT) & 0xFF;
-    const int col0_g = (int)(col0 >> IM_COL32_G_SHIFT) & 0xFF;
-    const int col0_b = (int)(col0 >> IM_COL32_B_SHIFT) & 0xFF;
-    const int col_delta_r = ((int)(col1 >> IM_COL32_R_SHIFT) & 0xFF) - col0_r;
-    const int col_delta_g = ((int)(col1 >> IM_COL32_G_SHIFT) & 0xFF) - col0_g;
-    const int col_delta_b = ((int)(col1 >> IM_COL32_B_SHIFT) & 0xFF) - col0_b;
-    for (ImDrawVert* vert = vert_start; vert < vert_end; vert++)
-    {
-        float d = ImDot(vert->pos - gradient_p0, gradient_extent);
-        float t = ImClamp(d * gradient_inv_length2, 0.0f, 1.0f);
-        int r = (int)(col0_r + col_delta_r * t);
-        int g = (int)(col0_g + col_delta_g * t);
-        int b = (int)(col0_b + col_delta_b * t);
-        vert->col = (r << IM_COL32_R_SHIFT) | (g << IM_COL32_G_SHIFT) | (b << IM_COL32_B_SHIFT) | (vert->col & IM_COL32_A_MASK);
-    }
+    return (h ^ v) * 16777619u; // FNV-1a prime. Each step is a bijection of 'h' for a given 'v' and vice-versa, so a single differing input always changes the result.
+}
+
+static inline ImU32 ImDrawDamageHashFloat(ImU32 h, float v)
+{
+    ImU32 bits;
+    memcpy(&bits, &v, sizeof(bits));
+    return ImDrawDamageHashCombine(h, bits);
+}
+
+static ImU32 ImDrawDamageHashCmd(const ImDrawCmd* cmd)
+{
+    ImU32 h = ImHashData(&cmd->TexRef._TexData, sizeof(cmd->TexRef._TexData));
+    h = ImHashData(&cmd->TexRef._TexID, sizeof(cmd->TexRef._TexID), h);
+    h = ImHashData(&cmd->UserCallback, sizeof(cmd->UserCallback), h);
+    h = ImHashData(&cmd->UserCallbackData, sizeof(cmd->UserCallbackData), h);
+    h = ImDrawDamageHashFloat(h, cmd->ClipRect.x);
+    h = ImDrawDamageHashFloat(h, cmd->ClipRect.y);
+    h = ImDrawDamageHashFloat(h, cmd->ClipRect.z);
+    h = ImDrawDamageHashFloat(h, cmd->ClipRect.w);
+    return h;
+}
+
+static inline void ImDrawDamageSetEntryRect(ImDrawDamageEntry* entry, const ImRect& r)
+{
+    if (!(r.Min.x < r.Max.x && r.Min.y < r.Max.y))
+    {
+        entry->Rect[0] = entry->Rect[1] = entry->Rect[2] = entry->Rect[3] = 0;
+        return;
+    }
+    // Round outward to integers (floor/ceil), valid within ImS16 range
+    const float x1 = ImClamp(r.Min.x, -32768.0f, 32767.0f), y1 = ImClamp(r.Min.y, -32768.0f, 32767.0f);
+    const float x2 = ImClamp(r.Max.x, -32768.0f, 32767.0f), y2 = ImClamp(r.Max.y, -32768.0f, 32767.0f);
+    entry->Rect[0] = (ImS16)((int)(x1 + 32768.0f) - 32768);
+    entry->Rect[1] = (ImS16)((int)(y1 + 32768.0f) - 32768);
+    entry->Rect[2] = (ImS16)(32768 - (int)(32768.0f - x2));
+    entry->Rect[3] = (ImS16)(32768 - (int)(32768.0f - y2));
+}
+
+// Add a rectangle to output, keeping output rectangles non-overlapping and under IM_DRAWDATA_DAMAGE_RECTS_MAX.
+static void ImDrawDamageAddRect(ImVector<ImVec4>* out_rects, ImRect r, const ImRect& display_rect)
+{
+    r.ClipWithFull(display_rect);
+    if (r.Min.x >= r.Max.x || r.Min.y >= r.Max.y)
+        return;
+
+    // Merge with all overlapping rectangles (merging may create new overlaps, so restart until stable)
+    for (int n = 0; n < out_rects->Size; n++)
+    {
+        const ImVec4& o = out_rects->Data[n];
+        if (r.Min.x >= o.z || r.Max.x <= o.x || r.Min.y >= o.w || r.Max.y <= o.y)
+            continue;
+        if (r.Min.x >= o.x && r.Min.y >= o.y && r.Max.x <= o.z && r.Max.y <= o.w)
+            return; // Fully contained: most frequent case
+        r.Add(ImRect(o));
+        out_rects->erase(out_rects->Data + n);
+        n = -1;
+    }
+    out_rects->push_back(r.ToVec4());
+    if (out_rects->Size <= IM_DRAWDATA_DAMAGE_RECTS_MAX)
+        return;
+
+    // Too many rectangles: merge the pair which adds the least area
+    int best_a = 0, best_b = 1;
+    float best_cost = FLT_MAX;
+    for (int a = 0; a < out_rects->Size; a++)
+        for (int b = a + 1; b < out_rects->Size; b++)
+        {
+            ImRect ra(out_rects->Data[a]), rb(out_rects->Data[b]);
+            ImRect ru = ra;
+            ru.Add(rb);
+            const float cost = ru.GetArea() - ra.GetArea() - rb.GetArea();
+            if (cost < best_cost)
+            {
+                best_cost = cost;
+                best_a = a;
+                best_b = b;
+            }
+        }
+    ImRect merged(out_rects->Data[best_a]);
+    merged.Add(ImRect(out_rects->Data[best_b]));
+    out_rects->erase(out_rects->Data + best_b); // best_b > best_a
+    out_rects->erase(out_rects->Data + best_a);
+    ImDrawDamageAddRect(out_rects, merged, display_rect);
+}
+
+// Add rectangles of a range of entries. Consecutive overlapping/touching rectangles (e.g. glyphs of a same line) are coalesced first.
+static void ImDrawDamageAddEntries(ImVector<ImVec4>* out_rects, const ImDrawDamageEntry* entries, int entry_begin, int entry_end, const ImRect& display_rect)
+{
+    ImRect pending(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (int n = entry_begin; n < entry_end; n++)
+    {
+        const ImDrawDamageEntry& entry = entries[n];
+        if (entry.Rect[0] >= entry.Rect[2] || entry.Rect[1] >= entry.Rect[3])
+            continue;
+        const ImRect r((float)entry.Rect[0], (float)entry.Rect[1], (float)entry.Rect[2], (float)entry.Rect[3]);
+        if (r.Min.x > pending.Max.x || r.Max.x < pending.Min.x || r.Min.y > pending.Max.y || r.Max.y < pending.Min.y)
+        {
+            if (pending.Min.x < pending.Max.x)
+                ImDrawDamageAddRect(out_rects, pending, display_rect);
+            pending = r;
+        }
+        else
+        {
+            pending.Add(r);
+        }
+    }
+    if (pending.Min.x < pending.Max.x)
+        ImDrawDamageAddRect(out_rects, pending, display_rect);
+}
+
+// Compare a draw list with last frame's version of it
+static void ImDrawDamageDiffList(ImVector<ImVec4>* out_rects, const ImDrawDamageEntry* prev_entries, int prev_count, const ImDrawDamageEntry* curr_entries, int curr_count, const ImRect& display_rect)
+{
+    // Skip common prefix and suffix
+    const int min_count = ImMin(prev_count, curr_count);
+    int prefix = 0;
+    while (prefix < min_count && prev_entries[prefix].Hash == curr_entries[prefix].Hash)
+        prefix++;
+    int suffix = 0;
+    while (suffix < min_count - prefix && prev_entries[prev_count - 1 - suffix].Hash == curr_entries[curr_count - 1 - suffix].Hash)
+        suffix++;
+    const int prev_end = prev_count - suffix;
+    const int curr_end = curr_count - suffix;
+    if (prev_end != curr_end)
+    {
+        // Entries were added or removed (e.g. text changed length)
+        ImDrawDamageAddEntries(out_rects, prev_entries, prefix, prev_end, display_rect);
+        ImDrawDamageAddEntries(out_rects, curr_entries, prefix, curr_end, display_rect);
+        return;
+    }
+
+    // Same amount of entries: only output different entries (e.g. text changed without changing length, color changes)
+    for (int n = prefix; n < curr_end; n++)
+    {
+        if (prev_entries[n].Hash == curr_entries[n].Hash)
+            continue;
+        int n_end = n + 1;
+        while (n_end < curr_end && prev_entries[n_end].Hash != curr_entries[n_end].Hash)
+            n_end++;
+        ImDrawDamageAddEntries(out_rects, prev_entries, n, n_end, display_rect);
+        ImDrawDamageAddEntries(out_rects, curr_entries, n, n_end, display_rect);
+        n = n_end;
+    }
+}
+
+void ImDrawDamageTracker::Clear()
+{
+    for (ImDrawDamageFrame& frame : Frames)
+    {
+        frame.Lists.clear();
+        frame.Entries.clear();
+    }
+    TempVtxHashes.clear();
+    TempListsMatched.clear();
+    HasLastFrame = false;
+}
+
+void ImDrawDamageTracker::Update(ImDrawData* draw_data)
+{
+    const ImDrawDamageFrame& prev = Frames[FrameIdx];
+    FrameIdx ^= 1;
+    ImDrawDamageFrame& curr = Frames[FrameIdx];
+    curr.Lists.resize(0);
+    curr.Entries.resize(0);
+    curr.DisplayPos = draw_data->DisplayPos;
+    curr.DisplaySize = draw_data->DisplaySize;
+    curr.FramebufferScale = draw_data->FramebufferScale;
+
+    // Build entries for current frame
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        ImDrawDamageList list;
+        list.DrawList = draw_list;
+        list.EntriesOffset = curr.Entries.Size;
+
+        // Hash each vertex once, triangles will combine the hashes of their vertices
+        const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data;
+        TempVtxHashes.resize(draw_list->VtxBuffer.Size);
+        for (int vtx_n = 0; vtx_n < draw_list->VtxBuffer.Size; vtx_n++)
+        {
+            // Independent multiplications (shorter dependency chain than chaining ImDrawDamageHashCombine()), each still a bijection of its input.
+            const ImDrawVert& v = vtx_buffer[vtx_n];
+            ImU32 bits[4] = { 0, 0, 0, 0 };
+            memcpy(&bits[0], &v.pos, sizeof(v.pos)); // 8 bytes, or 4 bytes with IMGUI_USE_COMPACT_DRAWVERT
+            memcpy(&bits[2], &v.uv, sizeof(v.uv));
+            TempVtxHashes.Data[vtx_n] = (bits[0] * 0x9E3779B1u) ^ (bits[1] * 0x85EBCA77u) ^ (bits[2] * 0xC2B2AE3Du) ^ (bits[3] * 0x27D4EB2Fu) ^ (v.col * 0x165667B1u);
+        }
+
+        int entries_count = 0;
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+            entries_count += (cmd.UserCallback != NULL) ? 1 : (int)(cmd.ElemCount / 3);
+        curr.Entries.resize(curr.Entries.Size + entries_count);
+        ImDrawDamageEntry* entry = curr.Entries.Data + list.EntriesOffset;
+
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            // Command state is folded into the hash of each triangle, so e.g. a clip rect change only damages affected triangles.
+            // User callbacks are output as a single entry covering their clip rect.
+            const ImRect clip_rect(cmd.ClipRect);
+            const ImU32 cmd_hash = ImDrawDamageHashCmd(&cmd);
+            if (cmd.UserCallback != NULL)
+            {
+                entry->Hash = cmd_hash;
+                ImDrawDamageSetEntryRect(entry++, clip_rect);
+                continue;
+            }
+
+            const ImDrawIdx* idx_buffer = draw_list->IdxBuffer.Data + cmd.IdxOffset;
+            const ImU32* vtx_hashes = TempVtxHashes.Data + cmd.VtxOffset;
+            const ImDrawVert* cmd_vtx_buffer = vtx_buffer + cmd.VtxOffset;
+            for (unsigned int idx_n = 0; idx_n + 3 <= cmd.ElemCount; idx_n += 3)
+            {
+                const unsigned int i0 = idx_buffer[idx_n], i1 = idx_buffer[idx_n + 1], i2 = idx_buffer[idx_n + 2];
+                const ImVec2 p0 = ImDrawVertGetPos(cmd_vtx_buffer[i0]), p1 = ImDrawVertGetPos(cmd_vtx_buffer[i1]), p2 = ImDrawVertGetPos(cmd_vtx_buffer[i2]);
+                ImRect tri_rect(ImMin(ImMin(p0, p1), p2), ImMax(ImMax(p0, p1), p2));
+                tri_rect.ClipWithFull(clip_rect);
+                entry->Hash = ImDrawDamageHashCombine(ImDrawDamageHashCombine(ImDrawDamageHashCombine(cmd_hash, vtx_hashes[i0]), vtx_hashes[i1]), vtx_hashes[i2]);
+                ImDrawDamageSetEntryRect(entry++, tri_rect);
+            }
+        }
+        list.EntriesCount = entries_count;
+        curr.Lists.push_back(list);
+    }
+
+    // Compare with last frame
+    ImVector<ImVec4>* out_rects = &draw_data->DamageRects;
+    const ImRect display_rect(draw_data->DisplayPos, draw_data->DisplayPos + draw_data->DisplaySize);
+    out_rects->resize(0);
+    draw_data->DamageTracked = true;
+    if (!HasLastFrame || prev.DisplayPos.x != curr.DisplayPos.x || prev.DisplayPos.y != curr.DisplayPos.y || prev.DisplaySize.x != curr.DisplaySize.x || prev.DisplaySize.y != curr.DisplaySize.y || prev.FramebufferScale.x != curr.FramebufferScale.x || prev.FramebufferScale.y != curr.FramebufferScale.y)
+    {
+        HasLastFrame = true;
+        ImDrawDamageAddRect(out_rects, ImRect(ImFloor(display_rect.Min), ImVec2(ImCeil(display_rect.Max.x), ImCeil(display_rect.Max.y))), display_rect);
+        return;
+    }
+
+    // Match draw lists by pointer. A draw list which moved down in z-order relative to others is fully damaged.
+    TempListsMatched.resize(prev.Lists.Size);
+    memset(TempListsMatched.Data, 0, (size_t)TempListsMatched.size_in_bytes());
+    int prev_list_last = -1;
+    for (const ImDrawDamageList& curr_list : curr.Lists)
+    {
+        const ImDrawDamageEntry* curr_entries = curr.Entries.Data + curr_list.EntriesOffset;
+        int prev_list_n = -1;
+        for (int n = 0; n < prev.Lists.Size; n++)
+            if (prev.Lists[n].DrawList == curr_list.DrawList && !TempListsMatched[n])
+            {
+                prev_list_n = n;
+                break;
+            }
+        if (prev_list_n == -1)
+        {
+            ImDrawDamageAddEntries(out_rects, curr_entries, 0, curr_list.EntriesCount, display_rect);
+            continue;
+        }
+        TempListsMatched[prev_list_n] = true;
+        const ImDrawDamageList& prev_list = prev.Lists[prev_list_n];
+        const ImDrawDamageEntry* prev_entries = prev.Entries.Data + prev_list.EntriesOffset;
+        if (prev_list_n < prev_list_last)
+        {
+            ImDrawDamageAddEntries(out_rects, prev_entries, 0, prev_list.EntriesCount, display_rect);
+            ImDrawDamageAddEntries(out_rects, curr_entries, 0, curr_list.EntriesCount, display_rect);
+            continue;
+        }
+        prev_list_last = prev_list_n;
+        ImDrawDamageDiffList(out_rects, prev_entries, prev_list.EntriesCount, curr_entries, curr_list.EntriesCount, display_rect);
+    }
+
+    // Draw lists which are not rendered anymore
+    for (int n = 0; n < prev.Lists.Size; n++)
+        if (!TempListsMatched[n])
+            ImDrawDamageAddEntries(out_rects, prev.Entries.Data + prev.Lists[n].EntriesOffset, 0, prev.Lists[n].EntriesCount, display_rect);
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] Helpers ShadeVertsXXX functions
+//-----------------------------------------------------------------------------
+
+// Generic linear color gradient, write to RGB fields, leave A untouched.
+void ImGui::ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1)
+{
+    ImVec2 gradient_extent = gradient_p1 - gradient_p0;
+    float gradient_inv_length2 = 1.0f / ImLengthSqr(gradient_extent);
+    ImDrawVert* vert_start = draw_list->VtxBuffer.Data + vert_start_idx;
+    ImDrawVert* vert_end = draw_list->VtxBuffer.Data + vert_end_idx;
+    const int col0_r = (int)(col0 >> IM_COL32_R_SHIFT) & 0xFF;
+    const int col0_g = (int)(col0 >> IM_COL32_G_SHIFT) & 0xFF;
+    const int col0_b = (int)(col0 >> IM_COL32_B_SHIFT) & 0xFF;
+    const int col_delta_r = ((int)(col1 >> IM_COL32_R_SHIFT) & 0xFF) - col0_r;
+    const int col_delta_g = ((int)(col1 >> IM_COL32_G_SHIFT) & 0xFF) - col0_g;
+    const int col_delta_b = ((int)(col1 >> IM_COL32_B_SHIFT) & 0xFF) - col0_b;
+    for (ImDrawVert* vert = vert_start; vert < vert_end; vert++)
+    {
+        float d = ImDot(ImDrawVertGetPos(*vert) - gradient_p0, gradient_extent);
+        float t = ImClamp(d * gradient_inv_length2, 0.0f, 1.0f);
+        int r = (int)(col0_r + col_delta_r * t);
+        int g = (int)(col0_g + col_delta_g * t);
+        int b = (int)(col0_b + col_delta_b * t);
+        vert->col = (r << IM_COL32_R_SHIFT) | (g << IM_COL32_G_SHIFT) | (b << IM_COL32_B_SHIFT) | (vert->col & IM_COL32_A_MASK);
+    }
 }
 
 // Distribute UV over (a, b) rectangle
@@ -2380,12 +3144,12 @@ void ImGui::ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int ve
         const ImVec2 min = ImMin(uv_a, uv_b);
         const ImVec2 max = ImMax(uv_a, uv_b);
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale), min, max);
+            ImDrawVertSetUV(*vertex, ImClamp(uv_a + ImMul(ImDrawVertGetPos(*vertex) - a, scale), min, max));
     }
     else
     {
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale);
+            ImDrawVertSetUV(*vertex, uv_a + ImMul(ImDrawVertGetPos(*vertex) - a, scale));
     }
 }
 
@@ -2394,7 +3158,7 @@ void ImGui::ShadeVertsTransformPos(ImDrawList* draw_list, int vert_start_idx, in
     ImDrawVert* vert_start = draw_list->VtxBuffer.Data + vert_start_idx;
     ImDrawVert* vert_end = draw_list->VtxBuffer.Data + vert_end_idx;
     for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-        vertex->pos = ImRotate(vertex->pos- pivot_in, cos_a, sin_a) + pivot_out;
+        ImDrawVertSetPos(*vertex, ImRotate(ImDrawVertGetPos(*vertex) - pivot_in, cos_a, sin_a) + pivot_out);
 }
 
 //-----------------------------------------------------------------------------
@@ -2411,6 +3175,7 @@ ImFontConfig::ImFontConfig()
     GlyphMaxAdvanceX = FLT_MAX;
     RasterizerMultiply = 1.0f;
     RasterizerDensity = 1.0f;
+    SdfSize = IM_FONTGLYPH_SDF_DEFAULT_SIZE;
     EllipsisChar = 0;
 }
 
@@ -2560,7 +3325,7 @@ void ImTextureData::DestroyPixels()
 // - ImFontAtlasPackAddRect()
 // - ImFontAtlasPackGetRect()
 //-----------------------------------------------------------------------------
-// - ImFontBaked_BuildGrowIndex()
+// - ImFontBaked_BuildGetIndexSlot()
 // - ImFontBaked_BuildLoadGlyph()
 // - ImFontBaked_BuildLoadGlyphAdvanceX()
 // - ImFontAtlasDebugLogTextureRequests()
@@ -2623,6 +3388,35 @@ static const ImVec2 FONT_ATLAS_DEFAULT_TEX_CURSOR_DATA[ImGuiMouseCursor_COUNT][3
 #define IM_FONTGLYPH_INDEX_UNUSED           ((ImU16)-1) // 0xFFFF
 #define IM_FONTGLYPH_INDEX_NOT_FOUND        ((ImU16)-2) // 0xFFFE
 
+// ImFontBaked::IndexAdvanceX[] and IndexLookup[] are stored in pages of 256 codepoints, only allocated when a glyph in their range is loaded.
+// IndexPages[codepoint >> 8] is the page index. Page 0 always stores codepoints 0..255, so the most common lookups can skip the indirection.
+// Page 1 is shared by all ranges without any loaded glyph, and is never written to.
+#define IM_FONTBAKED_INDEX_PAGE_SHIFT       8
+#define IM_FONTBAKED_INDEX_PAGE_SIZE        (1 << IM_FONTBAKED_INDEX_PAGE_SHIFT)
+#define IM_FONTBAKED_INDEX_PAGE_EMPTY       1
+
+static inline float ImFontBaked_IndexGetAdvanceX(const ImFontBaked* baked, unsigned int c)
+{
+    const unsigned int page_n = c >> IM_FONTBAKED_INDEX_PAGE_SHIFT;
+    if (page_n >= (unsigned int)baked->IndexPages.Size)
+        return -1.0f;
+    if (page_n == 0)
+        return baked->IndexAdvanceX.Data[c];
+    return baked->IndexAdvanceX.Data[(baked->IndexPages.Data[page_n] << IM_FONTBAKED_INDEX_PAGE_SHIFT) | (c & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1))];
+}
+
+static inline int ImFontBaked_IndexGetLookup(const ImFontBaked* baked, unsigned int c)
+{
+    const unsigned int page_n = c >> IM_FONTBAKED_INDEX_PAGE_SHIFT;
+    if (page_n >= (unsigned int)baked->IndexPages.Size)
+        return IM_FONTGLYPH_INDEX_UNUSED;
+    if (page_n == 0)
+        return baked->IndexLookup.Data[c];
+    return baked->IndexLookup.Data[(baked->IndexPages.Data[page_n] << IM_FONTBAKED_INDEX_PAGE_SHIFT) | (c & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1))];
+}
+
+static int ImFontBaked_BuildGetIndexSlot(ImFontBaked* baked, unsigned int codepoint);
+
 ImFontAtlas::ImFontAtlas()
 {
     memset(this, 0, sizeof(*this));
@@ -2632,6 +3426,7 @@ ImFontAtlas::ImFontAtlas()
     TexMinHeight = 128;
     TexMaxWidth = 8192;
     TexMaxHeight = 8192;
+    TexPageSize = 1024;
     TexRef._TexID = ImTextureID_Invalid;
     RendererHasTextures = false; // Assumed false by default, as apps can call e.g Atlas::Build() after backend init and before ImGui can update.
     TexNextUniqueID = 1;
@@ -2733,6 +3528,10 @@ static void ImFontAtlasBuildUpdateRendererHasTexturesFromContext(ImFontAtlas* at
 void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool renderer_has_textures)
 {
     IM_ASSERT(atlas->Builder == NULL || atlas->Builder->FrameCount < frame_count); // Protection against being called twice.
+#if !defined(IMGUI_ENABLE_THREAD_LOCAL_CONTEXT) && !defined(GImGui)
+    // Contexts on different threads each need their current context pointer, e.g. to record deferred loads.
+    IM_ASSERT((atlas->Flags & ImFontAtlasFlags_SharedAcrossThreads) == 0 && "ImFontAtlasFlags_SharedAcrossThreads requires '#define IMGUI_ENABLE_THREAD_LOCAL_CONTEXT' or your own thread local GImGui.");
+#endif
     atlas->RendererHasTextures = renderer_has_textures;
 
     // Check that font atlas was built or backend support texture reload in which case we can build now
@@ -2755,6 +3554,16 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
     for (ImFont* font : atlas->Fonts)
         font->LastBaked = NULL;
 
+    // Commit glyphs loaded asynchronously (ImFontAtlasFlags_AsyncGlyphLoading)
+    ImFontAtlasAsyncGlyphsFlush(atlas);
+
+    // Load glyphs and sizes requested by contexts during their last frame (ImFontAtlasFlags_SharedAcrossThreads)
+    if (atlas->Flags & ImFontAtlasFlags_SharedAcrossThreads)
+        ImFontAtlasDeferredLoadsCommit(atlas);
+
+    // Discard least recently used baked fonts if over budget
+    ImFontAtlasBuildDiscardBakesOverBudget(atlas, atlas->BakedMemoryBudget);
+
     // Garbage collect BakedPool
     if (builder->BakedDiscardedCount > 0)
     {
@@ -2775,6 +3584,9 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
         builder->BakedDiscardedCount = 0;
     }
 
+    // Discard unused text layouts (ImFontAtlasFlags_TextLayoutCache)
+    ImFontAtlasTextRunsDiscardUnused(atlas);
+
     // Update texture status
     for (int tex_n = 0; tex_n < atlas->TexList.Size; tex_n++)
     {
@@ -2786,6 +3598,8 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
             tex->UpdateRect.x = tex->UpdateRect.y = (unsigned short)~0;
             tex->UpdateRect.w = tex->UpdateRect.h = 0;
         }
+        if (atlas->Flags & ImFontAtlasFlags_SharedAcrossThreads)
+            tex->RefCount = (unsigned short)atlas->RefCount; // Not updated by contexts (see ImGui::UpdateTexturesEndFrame())
         if (tex->Status == ImTextureStatus_WantCreate && atlas->RendererHasTextures)
             IM_ASSERT(tex->TexID == ImTextureID_Invalid && tex->BackendUserData == NULL && "Backend set texture's TexID/BackendUserData but did not update Status to OK.");
 
@@ -2824,6 +3638,10 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
             tex_n--;
         }
     }
+
+    // Start rasterizing glyphs queued by deferred loads: contexts don't do it at the end of their frame (ImFontAtlasFlags_SharedAcrossThreads)
+    if (atlas->Flags & ImFontAtlasFlags_SharedAcrossThreads)
+        ImFontAtlasAsyncGlyphsStart(atlas);
 }
 
 void ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch, unsigned char* dst_pixels, ImTextureFormat dst_fmt, int dst_pitch, int w, int h)
@@ -2865,8 +3683,8 @@ void ImFontAtlasTextureBlockConvert(const unsigned char* src_pixels, ImTextureFo
 // Post-process hooks may eventually be added here.
 void ImFontAtlasTextureBlockPostProcess(ImFontAtlasPostProcessData* data)
 {
-    // Multiply operator (legacy)
-    if (data->FontSrc->RasterizerMultiply != 1.0f)
+    // Multiply operator (legacy). Meaningless on signed distance fields.
+    if (data->FontSrc->RasterizerMultiply != 1.0f && !data->FontBaked->UseSDF)
         ImFontAtlasTextureBlockPostProcessMultiply(data, data->FontSrc->RasterizerMultiply);
 }
 
@@ -3002,6 +3820,7 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg_in)
 {
     // Sanity Checks
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas!");
+    ImFontAtlasAsyncGlyphsCancel(this); // Sources[] may be reallocated
     IM_ASSERT((font_cfg_in->FontData != NULL && font_cfg_in->FontDataSize > 0) || (font_cfg_in->FontLoader != NULL));
     //IM_ASSERT(font_cfg_in->SizePixels > 0.0f && "Is ImFontConfig struct correctly initialized?");
     IM_ASSERT(font_cfg_in->RasterizerDensity > 0.0f && "Is ImFontConfig struct correctly initialized?");
@@ -3217,6 +4036,14 @@ static void ImFontAtlasBuildNotifySetFont(ImFontAtlas* atlas, ImFont* old_font,
     }
 }
 
+// Glyphs advances of baked fonts may have changed: invalidate text sizes memoized by contexts using this atlas
+static void ImFontAtlasBuildNotifyBakedChanged(ImFontAtlas* atlas)
+{
+    for (ImDrawListSharedData* shared_data : atlas->DrawListSharedDatas)
+        if (ImGuiContext* ctx = shared_data->Context)
+            ImGui::ClearTextSizeMemo(ctx);
+}
+
 void ImFontAtlas::RemoveFont(ImFont* font)
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas!");
@@ -3232,6 +4059,10 @@ void ImFontAtlas::RemoveFont(ImFont* font)
     bool removed = Fonts.find_erase(font);
     IM_ASSERT(removed);
     IM_UNUSED(removed);
+    for (ImDrawListSharedData* shared_data : DrawListSharedDatas)
+        for (int req_n = 0; req_n < shared_data->FontDeferredLoads.Size; req_n++)
+            if (shared_data->FontDeferredLoads[req_n].Font == font)
+                shared_data->FontDeferredLoads.erase(&shared_data->FontDeferredLoads[req_n--]);
 
     ImFontAtlasBuildUpdatePointers(this);
 
@@ -3383,6 +4214,13 @@ void ImFontAtlasBuildMain(ImFontAtlas* atlas)
 
 void ImFontAtlasBuildGetOversampleFactors(ImFontConfig* src, ImFontBaked* baked, int* out_oversample_h, int* out_oversample_v)
 {
+    // Signed distance fields are interpolated by renderer: no oversampling
+    if (baked->UseSDF)
+    {
+        *out_oversample_h = *out_oversample_v = 1;
+        return;
+    }
+
     // Automatically disable horizontal oversampling over size 36
     const float raster_size = baked->Size * baked->RasterizerDensity * src->RasterizerDensity;
     *out_oversample_h = (src->OversampleH != 0) ? src->OversampleH : (raster_size > 36.0f || src->PixelSnapH) ? 1 : 2;
@@ -3420,6 +4258,7 @@ void ImFontAtlasBuildSetupFontLoader(ImFontAtlas* atlas, const ImFontLoader* fon
 void ImFontAtlasBuildLegacyPreloadAllGlyphRanges(ImFontAtlas* atlas)
 {
     atlas->Builder->PreloadedAllGlyphsRanges = true;
+    atlas->Builder->DeferredLoadsDisabled++;
     for (ImFont* font : atlas->Fonts)
     {
         ImFontBaked* baked = font->GetFontBaked(font->LegacySize);
@@ -3435,6 +4274,7 @@ void ImFontAtlasBuildLegacyPreloadAllGlyphRanges(ImFontAtlas* atlas)
                     baked->FindGlyph((ImWchar)c);
         }
     }
+    atlas->Builder->DeferredLoadsDisabled--;
 }
 
 // FIXME: May make ImFont::Sources a ImSpan<> and move ownership to ImFontAtlas
@@ -3588,7 +4428,9 @@ bool ImFontAtlasFontInitOutput(ImFontAtlas* atlas, ImFont* font)
 // Keep source/input FontData
 void ImFontAtlasFontDestroyOutput(ImFontAtlas* atlas, ImFont* font)
 {
+    ImFontAtlasAsyncGlyphsCancel(atlas);
     font->ClearOutputData();
+    ImFontAtlasBuildNotifyBakedChanged(atlas);
     for (ImFontConfig* src : font->Sources)
     {
         const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
@@ -3622,7 +4464,7 @@ void ImFontAtlasFontSourceAddToFont(ImFontAtlas* atlas, ImFont* font, ImFontConf
 
 void ImFontAtlasFontDestroySourceData(ImFontAtlas* atlas, ImFontConfig* src)
 {
-    IM_UNUSED(atlas);
+    ImFontAtlasAsyncGlyphsCancel(atlas);
     if (src->FontDataOwnedByAtlas)
         IM_FREE(src->FontData);
     src->FontData = NULL;
@@ -3634,7 +4476,9 @@ void ImFontAtlasFontDestroySourceData(ImFontAtlas* atlas, ImFontConfig* src)
 // Create a compact, baked "..." if it doesn't exist, by using the ".".
 // This may seem overly complicated right now but the point is to exercise and improve a technique which should be increasingly used.
 // FIXME-NEWATLAS: This borrows too much from FontLoader's FontLoadGlyph() handlers and suggest that we should add further helpers.
-static ImFontGlyph* ImFontAtlasBuildSetupFontBakedEllipsis(ImFontAtlas* atlas, ImFontBaked* baked)
+// Sets *out_dot_pending and returns NULL when the "." glyph has no pixels yet (ImFontAtlasFlags_AsyncGlyphLoading), caller may retry once it is committed.
+static bool ImFontAtlasAsyncGlyphsIsPending(ImFontAtlas* atlas, ImFontBaked* baked, const ImFontGlyph* glyph);
+static ImFontGlyph* ImFontAtlasBuildSetupFontBakedEllipsis(ImFontAtlas* atlas, ImFontBaked* baked, bool* out_dot_pending)
 {
     ImFont* font = baked->ContainerFont;
     IM_ASSERT(font->EllipsisChar != 0);
@@ -3644,21 +4488,31 @@ static ImFontGlyph* ImFontAtlasBuildSetupFontBakedEllipsis(ImFontAtlas* atlas, I
         dot_glyph = baked->FindGlyphNoFallback((ImWchar)0xFF0E);
     if (dot_glyph == NULL)
         return NULL;
+    if (dot_glyph->PackId == ImFontAtlasRectId_Invalid)
+    {
+        *out_dot_pending = ImFontAtlasAsyncGlyphsIsPending(atlas, baked, dot_glyph);
+        return NULL;
+    }
     ImFontAtlasRectId dot_r_id = dot_glyph->PackId; // Deep copy to avoid invalidation of glyphs and rect pointers
     ImTextureRect* dot_r = ImFontAtlasPackGetRect(atlas, dot_r_id);
     const int dot_spacing = 1;
-    const float dot_step = (dot_glyph->X1 - dot_glyph->X0) + dot_spacing;
+    const int dot_padding = baked->UseSDF ? IM_FONTGLYPH_SDF_PADDING : 0; // Signed distance fields: dots overlap in their padding
+    const float dot_step = (dot_glyph->X1 - dot_glyph->X0) - dot_padding * 2 + dot_spacing;
+    const int dot_step_px = dot_r->w - dot_padding * 2 + dot_spacing;
 
-    ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, (dot_r->w * 3 + dot_spacing * 2), dot_r->h);
+    const ImWchar dot_codepoint = (ImWchar)dot_glyph->Codepoint;
+    ImFontAtlasRectId pack_id = ImFontAtlasPackAddGlyphRect(atlas, (dot_step_px * 2 + dot_r->w), dot_r->h, baked->UseSDF);
     ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
+    dot_glyph = baked->FindGlyphNoFallback(dot_codepoint); // May have been moved to another texture page
+    dot_r_id = dot_glyph->PackId;
 
     ImFontGlyph glyph_in = {};
     ImFontGlyph* glyph = &glyph_in;
     glyph->Codepoint = font->EllipsisChar;
-    glyph->AdvanceX = ImMax(dot_glyph->AdvanceX, dot_glyph->X0 + dot_step * 3.0f - dot_spacing); // FIXME: Slightly odd for normally mono-space fonts but since this is used for trailing contents.
+    glyph->AdvanceX = ImMax(dot_glyph->AdvanceX, dot_glyph->X0 + dot_padding + dot_step * 3.0f - dot_spacing); // FIXME: Slightly odd for normally mono-space fonts but since this is used for trailing contents.
     glyph->X0 = dot_glyph->X0;
     glyph->Y0 = dot_glyph->Y0;
-    glyph->X1 = dot_glyph->X0 + dot_step * 3 - dot_spacing;
+    glyph->X1 = dot_glyph->X0 + dot_padding * 2 + dot_step * 3 - dot_spacing;
     glyph->Y1 = dot_glyph->Y1;
     glyph->Visible = true;
     glyph->PackId = pack_id;
@@ -3668,9 +4522,27 @@ static ImFontGlyph* ImFontAtlasBuildSetupFontBakedEllipsis(ImFontAtlas* atlas, I
     // Copy to texture, post-process and queue update for backend
     // FIXME-NEWATLAS-V2: Dot glyph is already post-processed as this point, so this would damage it.
     dot_r = ImFontAtlasPackGetRect(atlas, dot_r_id);
-    ImTextureData* tex = atlas->TexData;
-    for (int n = 0; n < 3; n++)
-        ImFontAtlasTextureBlockCopy(tex, dot_r->x, dot_r->y, tex, r->x + (dot_r->w + dot_spacing) * n, r->y, dot_r->w, dot_r->h);
+    ImTextureData* dot_tex = ImFontAtlasPackGetRectTexture(atlas, dot_r_id);
+    ImTextureData* tex = ImFontAtlasPackGetRectTexture(atlas, pack_id);
+    if (dot_padding == 0)
+    {
+        for (int n = 0; n < 3; n++)
+            ImFontAtlasTextureBlockCopy(dot_tex, dot_r->x, dot_r->y, tex, r->x + dot_step_px * n, r->y, dot_r->w, dot_r->h);
+    }
+    else
+    {
+        // Merge overlapping distance fields by keeping the highest value (== union of shapes)
+        IM_ASSERT(dot_tex->Format == tex->Format);
+        ImFontAtlasTextureBlockFill(tex, r->x, r->y, r->w, r->h, IM_COL32(255, 255, 255, 0));
+        for (int n = 0; n < 3; n++)
+            for (int y = 0; y < dot_r->h; y++)
+            {
+                const unsigned char* src = (const unsigned char*)dot_tex->GetPixelsAt(dot_r->x, dot_r->y + y);
+                unsigned char* dst = (unsigned char*)tex->GetPixelsAt(r->x + dot_step_px * n, r->y + y);
+                for (int x = 0; x < dot_r->w * tex->BytesPerPixel; x++)
+                    dst[x] = ImMax(dst[x], src[x]);
+            }
+    }
     ImFontAtlasTextureBlockQueueUpload(atlas, tex, r->x, r->y, r->w, r->h);
 
     return glyph;
@@ -3762,19 +4634,37 @@ void ImFontAtlasBakedDiscardFontGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBa
     IM_ASSERT(font->FallbackChar != c && font->EllipsisChar != c); // Unsupported for simplicity
     IM_ASSERT(glyph >= baked->Glyphs.Data && glyph < baked->Glyphs.Data + baked->Glyphs.Size);
     IM_UNUSED(font);
-    baked->IndexLookup[c] = IM_FONTGLYPH_INDEX_UNUSED;
-    baked->IndexAdvanceX[c] = baked->FallbackAdvanceX;
+    const int index_slot = ImFontBaked_BuildGetIndexSlot(baked, c);
+    baked->IndexLookup[index_slot] = IM_FONTGLYPH_INDEX_UNUSED;
+    baked->IndexAdvanceX[index_slot] = baked->FallbackAdvanceX;
+    ImFontAtlasTextRunsInvalidateBaked(atlas, baked);
+    ImFontAtlasBuildNotifyBakedChanged(atlas);
+}
+
+// Signed distance field fonts (ImFontFlags_SDF) need support from renderer backend and from loaders of all sources.
+static bool ImFontAtlasFontCanUseSDF(ImFontAtlas* atlas, ImFont* font)
+{
+    if ((font->Flags & ImFontFlags_SDF) == 0 || !atlas->RendererHasTextures || !atlas->RendererHasSdfTextures)
+        return false;
+    for (ImFontConfig* src : font->Sources)
+    {
+        const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+        if (!loader->FontBakedSupportsSDF)
+            return false;
+    }
+    return true;
 }
 
 ImFontBaked* ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density, ImGuiID baked_id)
 {
-    IMGUI_DEBUG_LOG_FONT("[font] Created baked %.2fpx\n", font_size);
     ImFontBaked* baked = atlas->Builder->BakedPool.push_back(ImFontBaked());
     baked->Size = font_size;
     baked->RasterizerDensity = font_rasterizer_density;
     baked->BakedId = baked_id;
     baked->ContainerFont = font;
     baked->LastUsedFrame = atlas->Builder->FrameCount;
+    baked->UseSDF = ImFontAtlasFontCanUseSDF(atlas, font);
+    IMGUI_DEBUG_LOG_FONT("[font] Created baked %.2fpx%s\n", font_size, baked->UseSDF ? " (SDF)" : "");
 
     // Initialize backend data
     size_t loader_data_size = 0;
@@ -3794,6 +4684,10 @@ ImFontBaked* ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_si
     }
 
     ImFontAtlasBuildSetupFontBakedBlanks(atlas, baked);
+
+    // Contexts on other threads cannot lazily load the fallback glyph (ImFontAtlasFlags_SharedAcrossThreads)
+    if (atlas->Flags & ImFontAtlasFlags_SharedAcrossThreads)
+        ImFontAtlasBuildSetupFontBakedFallback(baked);
     return baked;
 }
 
@@ -3812,7 +4706,7 @@ ImFontBaked* ImFontAtlasBakedGetClosestMatch(ImFontAtlas* atlas, ImFont* font, f
                 continue;
             if (step_n == 0 && baked->RasterizerDensity != font_rasterizer_density) // First try with same density
                 continue;
-            if (baked->Size > font_size && (closest_larger_match == NULL || baked->Size < closest_larger_match->Size))
+            if (baked->Size >= font_size && (closest_larger_match == NULL || baked->Size < closest_larger_match->Size))
                 closest_larger_match = baked;
             if (baked->Size < font_size && (closest_smaller_match == NULL || baked->Size > closest_smaller_match->Size))
                 closest_smaller_match = baked;
@@ -3829,6 +4723,7 @@ ImFontBaked* ImFontAtlasBakedGetClosestMatch(ImFontAtlas* atlas, ImFont* font, f
 void ImFontAtlasBakedDiscard(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked)
 {
     ImFontAtlasBuilder* builder = atlas->Builder;
+    ImFontAtlasAsyncGlyphsCancel(atlas);
     IMGUI_DEBUG_LOG_FONT("[font] Discard baked %.2f for \"%s\"\n", baked->Size, font->GetDebugName());
 
     for (ImFontGlyph& glyph : baked->Glyphs)
@@ -3850,11 +4745,25 @@ void ImFontAtlasBakedDiscard(ImFontAtlas* atlas, ImFont* font, ImFontBaked* bake
     }
     builder->BakedMap.SetVoidPtr(baked->BakedId, NULL);
     builder->BakedDiscardedCount++;
+    ImFontAtlasTextRunsInvalidateBaked(atlas, baked);
+    ImFontAtlasBuildNotifyBakedChanged(atlas);
     baked->ClearOutputData();
     baked->WantDestroy = true;
     font->LastBaked = NULL;
 }
 
+// Approximate memory used by a baked font: glyph pixels (excluding padding) + glyph data + lookup tables.
+int ImFontAtlasBakedGetMemoryUsage(ImFontAtlas* atlas, ImFontBaked* baked)
+{
+    int usage = (int)sizeof(ImFontBaked);
+    usage += baked->MetricsTotalSurface * ImTextureDataGetFormatBytesPerPixel(atlas->TexData->Format);
+    usage += baked->Glyphs.Capacity * (int)sizeof(ImFontGlyph);
+    usage += baked->IndexAdvanceX.Capacity * (int)sizeof(float);
+    usage += baked->IndexLookup.Capacity * (int)sizeof(ImU16);
+    usage += baked->IndexPages.Capacity * (int)sizeof(ImU16);
+    return usage;
+}
+
 // use unused_frames==0 to discard everything.
 void ImFontAtlasFontDiscardBakes(ImFontAtlas* atlas, ImFont* font, int unused_frames)
 {
@@ -3885,6 +4794,51 @@ void ImFontAtlasBuildDiscardBakes(ImFontAtlas* atlas, int unused_frames)
     }
 }
 
+static int IMGUI_CDECL ImFontBaked_CompareByLastUsedFrame(const void* lhs, const void* rhs)
+{
+    const ImFontBaked* a = *(const ImFontBaked* const*)lhs;
+    const ImFontBaked* b = *(const ImFontBaked* const*)rhs;
+    return (a->LastUsedFrame != b->LastUsedFrame) ? (a->LastUsedFrame - b->LastUsedFrame) : (int)(a->BakedId > b->BakedId) - (int)(a->BakedId < b->BakedId);
+}
+
+// Discard least recently used baked fonts until memory usage fits in 'budget' (in bytes). budget==0: only update BakedMemoryUsage.
+// - Baked fonts used during the current or previous frame, or with ImFontFlags_LockBakedSizes, are never discarded.
+// - Discarded glyphs leave unused space in the texture, which is reclaimed by the next repack, or immediately when a texture page becomes empty (ImFontAtlasFlags_TexturePages).
+void ImFontAtlasBuildDiscardBakesOverBudget(ImFontAtlas* atlas, int budget)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    int usage = 0;
+    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+        if (!builder->BakedPool[baked_n].WantDestroy)
+            usage += ImFontAtlasBakedGetMemoryUsage(atlas, &builder->BakedPool[baked_n]);
+    builder->BakedMemoryUsage = usage;
+    if (budget <= 0 || usage <= budget)
+        return;
+
+    ImVector<ImFontBaked*> candidates;
+    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+    {
+        ImFontBaked* baked = &builder->BakedPool[baked_n];
+        if (baked->LastUsedFrame + 2 > builder->FrameCount)
+            continue;
+        if (baked->WantDestroy || (baked->ContainerFont->Flags & ImFontFlags_LockBakedSizes))
+            continue;
+        candidates.push_back(baked);
+    }
+    if (candidates.Size > 1)
+        ImQsort(candidates.Data, (size_t)candidates.Size, sizeof(ImFontBaked*), ImFontBaked_CompareByLastUsedFrame);
+    for (ImFontBaked* baked : candidates)
+    {
+        if (usage <= budget)
+            break;
+        usage -= ImFontAtlasBakedGetMemoryUsage(atlas, baked);
+        IMGUI_DEBUG_LOG_FONT("[font] Evict baked %.2f for \"%s\" (over budget)\n", baked->Size, baked->ContainerFont->GetDebugName());
+        ImFontAtlasBakedDiscard(atlas, baked->ContainerFont, baked);
+        builder->BakedEvictedCount++;
+    }
+    builder->BakedMemoryUsage = usage;
+}
+
 // Those functions are designed to facilitate changing the underlying structures for ImFontAtlas to store an array of ImDrawListSharedData*
 void ImFontAtlasAddDrawListSharedData(ImFontAtlas* atlas, ImDrawListSharedData* data)
 {
@@ -3978,6 +4932,64 @@ ImTextureData* ImFontAtlasTextureAdd(ImFontAtlas* atlas, int w, int h)
     return new_tex;
 }
 
+// Create an additional texture page (ImFontAtlasFlags_TexturePages, ImFontFlags_SDF). Return 0 if all pages are used.
+static int ImFontAtlasPageAdd(ImFontAtlas* atlas, bool sdf)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    int page_idx = 1;
+    while (page_idx < IM_FONTATLAS_PAGES_MAX && builder->Pages[page_idx] != NULL)
+        page_idx++;
+    if (page_idx == IM_FONTATLAS_PAGES_MAX)
+        return 0;
+
+    IM_ASSERT(ImIsPowerOfTwo(atlas->TexPageSize));
+    const int tex_w = ImMin(atlas->TexPageSize, atlas->TexMaxWidth);
+    const int tex_h = ImMin(atlas->TexPageSize, atlas->TexMaxHeight);
+    ImTextureData* tex = IM_NEW(ImTextureData)();
+    tex->UniqueID = atlas->TexNextUniqueID++;
+    tex->Create(atlas->TexDesiredFormat, tex_w, tex_h);
+    tex->UseColors = sdf ? false : atlas->TexPixelsUseColors;
+    tex->UseSDF = sdf;
+    atlas->TexList.insert(atlas->TexList.end() - 1, tex); // Keep TexData == TexList.back()
+
+    ImFontAtlasPage* page = IM_NEW(ImFontAtlasPage)();
+    page->Tex = tex;
+    // Leave padding on top-left edges too, as bilinear filtering clamps to edge (in main texture, top-left corner is used by custom rectangles)
+    const int pack_padding = atlas->TexGlyphPadding;
+    page->PackNodes.resize(tex_w / 2);
+    stbrp_init_target((stbrp_context*)(void*)&page->PackContext, tex_w - pack_padding, tex_h - pack_padding, page->PackNodes.Data, page->PackNodes.Size);
+    page->RectsCount = 0;
+    builder->Pages[page_idx] = page;
+    builder->PagesCount++;
+    IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: add page %d %dx%d%s\n", tex->UniqueID, page_idx, tex_w, tex_h, sdf ? " (SDF)" : "");
+    return page_idx;
+}
+
+// Destroy a texture page. Its texture will be destroyed next frame.
+static void ImFontAtlasPageRelease(ImFontAtlas* atlas, int page_idx)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImFontAtlasPage* page = builder->Pages[page_idx];
+    IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: release page %d\n", page->Tex->UniqueID, page_idx);
+    page->Tex->WantDestroyNextFrame = true;
+    IM_DELETE(page);
+    builder->Pages[page_idx] = NULL;
+    builder->PagesCount--;
+    builder->PagesReleasedCount++;
+    if (builder->PagesCurrent == page_idx)
+        builder->PagesCurrent = 0;
+    if (builder->PagesCurrentSDF == page_idx)
+        builder->PagesCurrentSDF = 0;
+}
+
+ImTextureData* ImFontAtlasPageGetTexture(ImFontAtlas* atlas, int page_idx)
+{
+    if (page_idx == 0)
+        return atlas->TexData;
+    IM_ASSERT(atlas->Builder->Pages[page_idx] != NULL);
+    return atlas->Builder->Pages[page_idx]->Tex;
+}
+
 #if 0
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 #include "../stb/stb_image_write.h"
@@ -3990,6 +5002,9 @@ static void ImFontAtlasDebugWriteTexToDisk(ImTextureData* tex, const char* descr
 }
 #endif
 
+static ImFontAtlasRectId ImFontAtlasPackReuseRectEntry(ImFontAtlas* atlas, ImFontAtlasRectEntry* index_entry);
+static void              ImFontAtlasPackCompactRects(ImFontAtlas* atlas);
+
 void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
 {
     ImFontAtlasBuilder* builder = atlas->Builder;
@@ -4020,6 +5035,13 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
         ImTextureRect& old_r = old_rects[index_entry.TargetIndex];
         if (old_r.w == 0 && old_r.h == 0)
             continue;
+        if (index_entry.PageIdx != 0)
+        {
+            // Rectangles stored in texture pages (ImFontAtlasFlags_TexturePages) are not moved
+            builder->Rects.push_back(old_r);
+            ImFontAtlasPackReuseRectEntry(atlas, &index_entry);
+            continue;
+        }
         ImFontAtlasRectId new_r_id = ImFontAtlasPackAddRect(atlas, old_r.w, old_r.h, &index_entry);
         if (new_r_id == ImFontAtlasRectId_Invalid)
         {
@@ -4037,14 +5059,15 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
         ImTextureRect* new_r = ImFontAtlasPackGetRect(atlas, new_r_id);
         ImFontAtlasTextureBlockCopy(old_tex, old_r.x, old_r.y, new_tex, new_r->x, new_r->y, new_r->w, new_r->h);
     }
-    IM_ASSERT(old_rects.Size == builder->Rects.Size + builder->RectsDiscardedCount);
+    IM_ASSERT(old_rects.Size == builder->Rects.Size + builder->RectsDiscardedCount + builder->RectsDiscardedInPagesCount);
     builder->RectsDiscardedCount = 0;
     builder->RectsDiscardedSurface = 0;
+    builder->RectsDiscardedInPagesCount = 0;
 
     // Patch glyphs UV
     for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
         for (ImFontGlyph& glyph : builder->BakedPool[baked_n].Glyphs)
-            if (glyph.PackId != ImFontAtlasRectId_Invalid)
+            if (glyph.PackId != ImFontAtlasRectId_Invalid && glyph.PageIdx == 0)
             {
                 ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph.PackId);
                 glyph.U0 = (r->x) * atlas->TexUvScale.x;
@@ -4052,6 +5075,7 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
                 glyph.U1 = (r->x + r->w) * atlas->TexUvScale.x;
                 glyph.V1 = (r->y + r->h) * atlas->TexUvScale.y;
             }
+    builder->TextRunsGeneration++;
 
     // Update other cached UV
     ImFontAtlasBuildUpdateLinesTexData(atlas);
@@ -4166,8 +5190,12 @@ void ImFontAtlasTextureCompact(ImFontAtlas* atlas)
     ImTextureData* old_tex = atlas->TexData;
     ImVec2i old_tex_size = ImVec2i(old_tex->Width, old_tex->Height);
     ImVec2i new_tex_size = ImFontAtlasTextureGetSizeEstimate(atlas);
-    if (builder->RectsDiscardedCount == 0 && new_tex_size.x == old_tex_size.x && new_tex_size.y == old_tex_size.y)
+    if (builder->RectsDiscardedSurface == 0 && new_tex_size.x == old_tex_size.x && new_tex_size.y == old_tex_size.y)
+    {
+        if (builder->RectsDiscardedInPagesCount > 0)
+            ImFontAtlasPackCompactRects(atlas);
         return;
+    }
 
     ImFontAtlasTextureRepack(atlas, new_tex_size.x, new_tex_size.y);
 }
@@ -4219,6 +5247,7 @@ void ImFontAtlasBuildInit(ImFontAtlas* atlas)
 // Destroy builder and all cached glyphs. Do not destroy actual fonts.
 void ImFontAtlasBuildDestroy(ImFontAtlas* atlas)
 {
+    ImFontAtlasAsyncGlyphsCancel(atlas);
     for (ImFont* font : atlas->Fonts)
         ImFontAtlasFontDestroyOutput(atlas, font);
     if (atlas->Builder && atlas->FontLoader && atlas->FontLoader->LoaderShutdown)
@@ -4226,6 +5255,13 @@ void ImFontAtlasBuildDestroy(ImFontAtlas* atlas)
         atlas->FontLoader->LoaderShutdown(atlas);
         IM_ASSERT(atlas->FontLoaderData == NULL);
     }
+    if (atlas->Builder)
+        for (int page_n = 1; page_n < IM_FONTATLAS_PAGES_MAX; page_n++)
+            if (atlas->Builder->Pages[page_n] != NULL)
+                ImFontAtlasPageRelease(atlas, page_n);
+    if (atlas->Builder)
+        ImFontAtlasTextRunsClear(atlas);
+    ImFontAtlasBuildNotifyBakedChanged(atlas);
     IM_DELETE(atlas->Builder);
     atlas->Builder = NULL;
 }
@@ -4267,6 +5303,7 @@ static ImFontAtlasRectId ImFontAtlasPackAllocRectEntry(ImFontAtlas* atlas, int r
     }
     index_entry->TargetIndex = rect_idx;
     index_entry->IsUsed = 1;
+    index_entry->PageIdx = 0;
     return ImFontAtlasRectId_Make(index_idx, index_entry->Generation);
 }
 
@@ -4295,11 +5332,25 @@ void ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
     index_entry->IsUsed = false;
     index_entry->TargetIndex = builder->RectsIndexFreeListStart;
     index_entry->Generation++;
-
-    const int pack_padding = atlas->TexGlyphPadding;
     builder->RectsIndexFreeListStart = index_idx;
-    builder->RectsDiscardedCount++;
-    builder->RectsDiscardedSurface += (rect->w + pack_padding) * (rect->h + pack_padding);
+
+    const int page_idx = index_entry->PageIdx;
+    if (page_idx == 0)
+    {
+        const int pack_padding = atlas->TexGlyphPadding;
+        builder->RectsDiscardedCount++;
+        builder->RectsDiscardedSurface += (rect->w + pack_padding) * (rect->h + pack_padding);
+    }
+    else
+    {
+        // Texture pages are never repacked: destroy page when it becomes empty.
+        const int pack_padding = atlas->TexGlyphPadding;
+        ImFontAtlasPage* page = builder->Pages[page_idx];
+        builder->RectsDiscardedInPagesCount++;
+        page->RectsSurface -= (rect->w + pack_padding) * (rect->h + pack_padding);
+        if (--page->RectsCount == 0)
+            ImFontAtlasPageRelease(atlas, page_idx);
+    }
     rect->w = rect->h = 0; // Clear rectangle so it won't be packed again
 }
 
@@ -4383,41 +5434,241 @@ ImTextureRect* ImFontAtlasPackGetRectSafe(ImFontAtlas* atlas, ImFontAtlasRectId
     return &builder->Rects[index_entry->TargetIndex];
 }
 
-// Important! This assume by ImFontConfig::GlyphExcludeRanges[] is a SMALL ARRAY (e.g. <10 entries)
-// Use "Input Glyphs Overlap Detection Tool" to display a list of glyphs provided by multiple sources in order to set this array up.
-static bool ImFontAtlasBuildAcceptCodepointForSource(ImFontConfig* src, ImWchar codepoint)
+// Return texture storing a rectangle: atlas->TexData unless using ImFontAtlasFlags_TexturePages.
+ImTextureData* ImFontAtlasPackGetRectTexture(ImFontAtlas* atlas, ImFontAtlasRectId id)
 {
-    if (const ImWchar* exclude_list = src->GlyphExcludeRanges)
-        for (; exclude_list[0] != 0; exclude_list += 2)
-            if (codepoint >= exclude_list[0] && codepoint <= exclude_list[1])
-                return false;
-    return true;
+    IM_ASSERT(id != ImFontAtlasRectId_Invalid);
+    ImFontAtlasRectEntry* index_entry = &atlas->Builder->RectsIndex[ImFontAtlasRectId_GetIndex(id)];
+    IM_ASSERT(index_entry->Generation == ImFontAtlasRectId_GetGeneration(id) && index_entry->IsUsed);
+    return ImFontAtlasPageGetTexture(atlas, index_entry->PageIdx);
 }
 
-static void ImFontBaked_BuildGrowIndex(ImFontBaked* baked, int new_size)
+// Pack into a given page, without resizing any texture.
+static ImFontAtlasRectId ImFontAtlasPagePackRect(ImFontAtlas* atlas, int page_idx, int w, int h)
 {
-    IM_ASSERT(baked->IndexAdvanceX.Size == baked->IndexLookup.Size);
-    if (new_size <= baked->IndexLookup.Size)
-        return;
-    baked->IndexAdvanceX.resize(new_size, -1.0f);
-    baked->IndexLookup.resize(new_size, IM_FONTGLYPH_INDEX_UNUSED);
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (page_idx == 0)
+    {
+        builder->LockDisableResize = true;
+        ImFontAtlasRectId r_id = ImFontAtlasPackAddRect(atlas, w, h);
+        builder->LockDisableResize = false;
+        return r_id;
+    }
+
+    ImFontAtlasPage* page = builder->Pages[page_idx];
+    const int pack_padding = atlas->TexGlyphPadding;
+    stbrp_rect pack_r = {};
+    pack_r.w = w + pack_padding;
+    pack_r.h = h + pack_padding;
+    stbrp_pack_rects((stbrp_context*)(void*)&page->PackContext, &pack_r, 1);
+    if (!pack_r.was_packed)
+        return ImFontAtlasRectId_Invalid;
+
+    ImTextureRect r = { (unsigned short)(pack_r.x + pack_padding), (unsigned short)(pack_r.y + pack_padding), (unsigned short)w, (unsigned short)h };
+    builder->Rects.push_back(r);
+    page->RectsCount++;
+    page->RectsSurface += pack_r.w * pack_r.h;
+    ImFontAtlasRectId r_id = ImFontAtlasPackAllocRectEntry(atlas, builder->Rects.Size - 1);
+    builder->RectsIndex[ImFontAtlasRectId_GetIndex(r_id)].PageIdx = page_idx;
+    return r_id;
 }
 
-static void ImFontAtlas_FontHookRemapCodepoint(ImFontAtlas* atlas, ImFont* font, ImWchar* c)
+// Remove discarded rectangles from Rects[] without moving any pixels.
+// Rectangles discarded from texture pages are otherwise only removed by the next repack of the main texture.
+static void ImFontAtlasPackCompactRects(ImFontAtlas* atlas)
 {
-    IM_UNUSED(atlas);
-    if (font->RemapPairs.Data.Size != 0)
-        *c = (ImWchar)font->RemapPairs.GetInt((ImGuiID)*c, (int)*c);
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImVector<ImTextureRect> old_rects;
+    old_rects.swap(builder->Rects);
+    builder->Rects.reserve(old_rects.Size - builder->RectsDiscardedCount - builder->RectsDiscardedInPagesCount);
+    for (ImFontAtlasRectEntry& index_entry : builder->RectsIndex)
+        if (index_entry.IsUsed)
+        {
+            builder->Rects.push_back(old_rects[index_entry.TargetIndex]);
+            ImFontAtlasPackReuseRectEntry(atlas, &index_entry);
+        }
+    IM_ASSERT(old_rects.Size == builder->Rects.Size + builder->RectsDiscardedCount + builder->RectsDiscardedInPagesCount);
+    builder->RectsDiscardedCount = 0; // Keep RectsDiscardedSurface: space is still lost in main texture until next repack.
+    builder->RectsDiscardedInPagesCount = 0;
 }
 
-static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codepoint, float* only_load_advance_x)
+// Move glyphs out of sparsely used pages into a new page, so those pages can be destroyed.
+// Without this, a few glyphs of long-lived baked fonts (loaded over time) would keep every page alive.
+static void ImFontAtlasPageEvacuateSparsePages(ImFontAtlas* atlas, int dst_page_idx)
 {
-    ImFont* font = baked->ContainerFont;
-    ImFontAtlas* atlas = font->ContainerAtlas;
-    if (atlas->Locked || (font->Flags & ImFontFlags_NoLoadGlyphs))
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImTextureData* dst_tex = builder->Pages[dst_page_idx]->Tex;
+    const int page_surface = dst_tex->Width * dst_tex->Height;
+    ImU32 src_pages_mask = 0;
+    int src_pages_surface = 0;
+    for (int page_n = 1; page_n < IM_FONTATLAS_PAGES_MAX; page_n++)
+        if (ImFontAtlasPage* page = builder->Pages[page_n])
+            if (page_n != dst_page_idx && page->Tex->UseSDF == dst_tex->UseSDF && page->RectsSurface * 4 <= page_surface && src_pages_surface + page->RectsSurface <= page_surface / 2)
+            {
+                src_pages_mask |= 1u << page_n;
+                src_pages_surface += page->RectsSurface;
+            }
+    if (src_pages_mask == 0)
+        return;
+    builder->TextRunsGeneration++;
+
+    const ImVec2 uv_scale = ImVec2(1.0f / dst_tex->Width, 1.0f / dst_tex->Height);
+    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
     {
-        // Lazily load fallback glyph
-        if (baked->FallbackGlyphIndex == -1 && baked->LoadNoFallback == 0)
+        ImFontBaked* baked = &builder->BakedPool[baked_n];
+        if (baked->WantDestroy)
+            continue;
+        for (ImFontGlyph& glyph : baked->Glyphs)
+        {
+            if (glyph.PackId == ImFontAtlasRectId_Invalid || (src_pages_mask & (1u << glyph.PageIdx)) == 0)
+                continue;
+            ImTextureData* src_tex = ImFontAtlasPageGetTexture(atlas, glyph.PageIdx);
+            ImTextureRect src_r = *ImFontAtlasPackGetRect(atlas, glyph.PackId);
+            ImFontAtlasRectId dst_r_id = ImFontAtlasPagePackRect(atlas, dst_page_idx, src_r.w, src_r.h);
+            if (dst_r_id == ImFontAtlasRectId_Invalid)
+                return;
+            ImTextureRect* dst_r = ImFontAtlasPackGetRect(atlas, dst_r_id);
+            ImFontAtlasTextureBlockCopy(src_tex, src_r.x, src_r.y, dst_tex, dst_r->x, dst_r->y, dst_r->w, dst_r->h);
+            ImFontAtlasTextureBlockQueueUpload(atlas, dst_tex, dst_r->x, dst_r->y, dst_r->w, dst_r->h);
+            ImFontAtlasPackDiscardRect(atlas, glyph.PackId); // Source page is destroyed along with its last rectangle.
+            glyph.PackId = dst_r_id;
+            glyph.PageIdx = dst_page_idx;
+            glyph.U0 = (dst_r->x) * uv_scale.x;
+            glyph.V0 = (dst_r->y) * uv_scale.y;
+            glyph.U1 = (dst_r->x + dst_r->w) * uv_scale.x;
+            glyph.V1 = (dst_r->y + dst_r->h) * uv_scale.y;
+        }
+    }
+}
+
+// Pack a glyph rectangle. Same as ImFontAtlasPackAddRect() unless using ImFontAtlasFlags_TexturePages: once the main texture
+// reached TexPageSize, glyphs are packed into additional textures instead of growing and repacking the main texture.
+// Custom rectangles always use the main texture. Signed distance field glyphs ('sdf == true') always use their own pages.
+// Important: Calling this may recreate a new texture and therefore change atlas->TexData
+ImFontAtlasRectId ImFontAtlasPackAddGlyphRect(ImFontAtlas* atlas, int w, int h, bool sdf)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    const int pack_padding = atlas->TexGlyphPadding;
+    const int page_w = ImMin(atlas->TexPageSize, atlas->TexMaxWidth);
+    const int page_h = ImMin(atlas->TexPageSize, atlas->TexMaxHeight);
+    if (sdf)
+    {
+        IM_ASSERT(atlas->RendererHasTextures && atlas->RendererHasSdfTextures);
+        ImFontAtlasRectId r_id = builder->PagesCurrentSDF ? ImFontAtlasPagePackRect(atlas, builder->PagesCurrentSDF, w, h) : ImFontAtlasRectId_Invalid;
+        if (r_id != ImFontAtlasRectId_Invalid || w + pack_padding > page_w || h + pack_padding > page_h)
+            return r_id;
+        ImFontAtlasBuildDiscardBakes(atlas, 2);
+        if (builder->RectsDiscardedInPagesCount > builder->Rects.Size / 2)
+            ImFontAtlasPackCompactRects(atlas);
+        const int page_idx = ImFontAtlasPageAdd(atlas, true);
+        if (page_idx == 0)
+            return ImFontAtlasRectId_Invalid;
+        builder->PagesCurrentSDF = page_idx;
+        r_id = ImFontAtlasPagePackRect(atlas, page_idx, w, h);
+        ImFontAtlasPageEvacuateSparsePages(atlas, page_idx);
+        return r_id;
+    }
+    if ((atlas->Flags & ImFontAtlasFlags_TexturePages) == 0 || !atlas->RendererHasTextures || builder->LockDisableResize)
+        return ImFontAtlasPackAddRect(atlas, w, h);
+    if (w + pack_padding > page_w || h + pack_padding > page_h)
+        return ImFontAtlasPackAddRect(atlas, w, h);
+
+    // Main texture grows until reaching page size, then is never repacked to make space for glyphs
+    ImFontAtlasRectId r_id = ImFontAtlasPagePackRect(atlas, builder->PagesCurrent, w, h);
+    while (r_id == ImFontAtlasRectId_Invalid && builder->PagesCurrent == 0 && (atlas->TexData->Width < page_w || atlas->TexData->Height < page_h))
+    {
+        ImFontAtlasTextureGrow(atlas);
+        r_id = ImFontAtlasPagePackRect(atlas, 0, w, h);
+    }
+    if (r_id != ImFontAtlasRectId_Invalid)
+        return r_id;
+
+    // Current page is full: discard unused baked fonts (which may release whole pages) and open a new page.
+    ImFontAtlasBuildDiscardBakes(atlas, 2);
+    if (builder->RectsDiscardedInPagesCount > builder->Rects.Size / 2)
+        ImFontAtlasPackCompactRects(atlas);
+    const int page_idx = ImFontAtlasPageAdd(atlas, false);
+    if (page_idx == 0)
+        return ImFontAtlasPackAddRect(atlas, w, h); // Out of pages: grow main texture
+    builder->PagesCurrent = page_idx;
+    r_id = ImFontAtlasPagePackRect(atlas, page_idx, w, h);
+    ImFontAtlasPageEvacuateSparsePages(atlas, page_idx);
+    return r_id;
+}
+
+// Important! This assume by ImFontConfig::GlyphExcludeRanges[] is a SMALL ARRAY (e.g. <10 entries)
+// Use "Input Glyphs Overlap Detection Tool" to display a list of glyphs provided by multiple sources in order to set this array up.
+static bool ImFontAtlasBuildAcceptCodepointForSource(ImFontConfig* src, ImWchar codepoint)
+{
+    if (const ImWchar* exclude_list = src->GlyphExcludeRanges)
+        for (; exclude_list[0] != 0; exclude_list += 2)
+            if (codepoint >= exclude_list[0] && codepoint <= exclude_list[1])
+                return false;
+    return true;
+}
+
+static int ImFontBaked_BuildAddIndexPage(ImFontBaked* baked)
+{
+    const int page_idx = baked->IndexLookup.Size >> IM_FONTBAKED_INDEX_PAGE_SHIFT;
+    IM_ASSERT(page_idx <= 0xFFFF);
+    const int new_size = baked->IndexLookup.Size + IM_FONTBAKED_INDEX_PAGE_SIZE;
+    baked->IndexAdvanceX.reserve(new_size); // Exact allocations: avoid wasting memory with large fonts, pages are rarely added.
+    baked->IndexLookup.reserve(new_size);
+    baked->IndexAdvanceX.resize(new_size, -1.0f);
+    baked->IndexLookup.resize(new_size, IM_FONTGLYPH_INDEX_UNUSED);
+    return page_idx;
+}
+
+// Return index into IndexAdvanceX[]/IndexLookup[] for writing, allocating page if needed.
+static int ImFontBaked_BuildGetIndexSlot(ImFontBaked* baked, unsigned int codepoint)
+{
+    IM_ASSERT(baked->IndexAdvanceX.Size == baked->IndexLookup.Size);
+    if (baked->IndexPages.Size == 0)
+    {
+        ImFontBaked_BuildAddIndexPage(baked); // Codepoints 0..255
+        ImFontBaked_BuildAddIndexPage(baked); // Shared empty page
+        baked->IndexPages.push_back(0);
+    }
+    const int page_n = (int)(codepoint >> IM_FONTBAKED_INDEX_PAGE_SHIFT);
+    if (page_n >= baked->IndexPages.Size)
+    {
+        baked->IndexPages.reserve(page_n + 1);
+        baked->IndexPages.resize(page_n + 1, IM_FONTBAKED_INDEX_PAGE_EMPTY);
+    }
+    if (baked->IndexPages.Data[page_n] == IM_FONTBAKED_INDEX_PAGE_EMPTY)
+        baked->IndexPages.Data[page_n] = (ImU16)ImFontBaked_BuildAddIndexPage(baked);
+    return (baked->IndexPages.Data[page_n] << IM_FONTBAKED_INDEX_PAGE_SHIFT) | (int)(codepoint & (IM_FONTBAKED_INDEX_PAGE_SIZE - 1));
+}
+
+static void ImFontAtlas_FontHookRemapCodepoint(ImFontAtlas* atlas, ImFont* font, ImWchar* c)
+{
+    IM_UNUSED(atlas);
+    if (font->RemapPairs.Data.Size != 0)
+        *c = (ImWchar)font->RemapPairs.GetInt((ImGuiID)*c, (int)*c);
+}
+
+static ImFontGlyph* ImFontAtlasAsyncGlyphsQueue(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, const ImFontGlyph* in_glyph, ImWchar codepoint, const ImFontAtlasGlyphBitmap* bitmap);
+static inline bool  ImFontAtlasDeferredLoadsEnabled(ImFontAtlas* atlas);
+static void         ImFontAtlasDeferredLoadsAdd(ImFontAtlas* atlas, ImFont* font, float size, float rasterizer_density, int codepoint);
+static bool         ImFontAtlasGlyphCacheLoadGlyph(ImFontAtlas* atlas, ImFontBaked* baked, ImWchar codepoint, float* only_load_advance_x, ImFontGlyph** out_glyph);
+
+static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codepoint, float* only_load_advance_x)
+{
+    ImFont* font = baked->ContainerFont;
+    ImFontAtlas* atlas = font->ContainerAtlas;
+    if (ImFontAtlasDeferredLoadsEnabled(atlas))
+    {
+        // Use fallback glyph until next ImFontAtlasUpdateNewFrame() loads it (ImFontAtlasFlags_SharedAcrossThreads)
+        if ((font->Flags & ImFontFlags_NoLoadGlyphs) == 0)
+            ImFontAtlasDeferredLoadsAdd(atlas, font, baked->Size, baked->RasterizerDensity, (int)codepoint);
+        if (only_load_advance_x)
+            *only_load_advance_x = baked->FallbackAdvanceX;
+        return NULL;
+    }
+    if (atlas->Locked || (font->Flags & ImFontFlags_NoLoadGlyphs))
+    {
+        // Lazily load fallback glyph
+        if (baked->FallbackGlyphIndex == -1 && baked->LoadNoFallback == 0)
             ImFontAtlasBuildSetupFontBakedFallback(baked);
         return NULL;
     }
@@ -4432,8 +5683,28 @@ static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codep
     // Special hook
     // FIXME-NEWATLAS: it would be nicer if this used a more standardized way of hooking
     if (codepoint == font->EllipsisChar && font->EllipsisAutoBake)
-        if (ImFontGlyph* glyph = ImFontAtlasBuildSetupFontBakedEllipsis(atlas, baked))
+    {
+        bool dot_pending = false;
+        if (ImFontGlyph* glyph = ImFontAtlasBuildSetupFontBakedEllipsis(atlas, baked, &dot_pending))
+            return glyph;
+        if (dot_pending)
+        {
+            // Use fallback glyph without marking index, so we retry once the "." glyph is rasterized (ImFontAtlasFlags_AsyncGlyphLoading)
+            if (baked->FallbackGlyphIndex == -1 && baked->LoadNoFallback == 0)
+                ImFontAtlasBuildSetupFontBakedFallback(baked);
+            if (only_load_advance_x)
+                *only_load_advance_x = baked->FallbackAdvanceX;
+            return NULL;
+        }
+    }
+
+    // Persistent glyph cache
+    if (atlas->GlyphCacheData.Size > 0)
+    {
+        ImFontGlyph* glyph;
+        if (ImFontAtlasGlyphCacheLoadGlyph(atlas, baked, src_codepoint, only_load_advance_x, &glyph))
             return glyph;
+    }
 
     // Call backend
     char* loader_user_data_p = (char*)baked->FontLoaderDatas;
@@ -4443,42 +5714,813 @@ static ImFontGlyph* ImFontBaked_BuildLoadGlyph(ImFontBaked* baked, ImWchar codep
         const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
         if (!src->GlyphExcludeRanges || ImFontAtlasBuildAcceptCodepointForSource(src, codepoint))
         {
-            if (only_load_advance_x == NULL)
+            if (only_load_advance_x == NULL && (atlas->Flags & ImFontAtlasFlags_AsyncGlyphLoading) && atlas->RendererHasTextures && loader->FontBakedRasterizeGlyphThreadSafe)
+            {
+                // Asynchronous mode: add glyph with its metrics but no pixels, rasterize later.
+                ImFontGlyph glyph_buf;
+                ImFontAtlasGlyphBitmap bitmap = {};
+                if (loader->FontBakedRasterizeGlyph(atlas, src, baked, loader_user_data_p, codepoint, &glyph_buf, &bitmap))
+                {
+                    glyph_buf.Codepoint = src_codepoint;
+                    glyph_buf.SourceIdx = src_n;
+                    return ImFontAtlasAsyncGlyphsQueue(atlas, baked, src, &glyph_buf, codepoint, &bitmap);
+                }
+            }
+            else if (only_load_advance_x == NULL)
+            {
+                ImFontGlyph glyph_buf;
+                if (loader->FontBakedLoadGlyph(atlas, src, baked, loader_user_data_p, codepoint, &glyph_buf, NULL))
+                {
+                    // FIXME: Add hooks for e.g. #7962
+                    glyph_buf.Codepoint = src_codepoint;
+                    glyph_buf.SourceIdx = src_n;
+                    return ImFontAtlasBakedAddFontGlyph(atlas, baked, src, &glyph_buf);
+                }
+            }
+            else
+            {
+                // Special mode but only loading glyphs metrics. Will rasterize and pack later.
+                if (loader->FontBakedLoadGlyph(atlas, src, baked, loader_user_data_p, codepoint, NULL, only_load_advance_x))
+                {
+                    ImFontAtlasBakedAddFontGlyphAdvancedX(atlas, baked, src, codepoint, *only_load_advance_x);
+                    return NULL;
+                }
+            }
+        }
+        loader_user_data_p += loader->FontBakedSrcLoaderDataSize;
+        src_n++;
+    }
+
+    // Lazily load fallback glyph
+    if (baked->LoadNoFallback)
+        return NULL;
+    if (baked->FallbackGlyphIndex == -1)
+        ImFontAtlasBuildSetupFontBakedFallback(baked);
+
+    // Mark index as not found, so we don't attempt the search twice
+    const int index_slot = ImFontBaked_BuildGetIndexSlot(baked, codepoint);
+    baked->IndexAdvanceX[index_slot] = baked->FallbackAdvanceX;
+    baked->IndexLookup[index_slot] = IM_FONTGLYPH_INDEX_NOT_FOUND;
+    return NULL;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Batched and asynchronous glyph loading
+//-----------------------------------------------------------------------------------------------------------------------------
+// - ImFontBaked::PreloadGlyphs(): query all glyphs, rasterize them (possibly in parallel using atlas->ParallelFor), then pack and copy them in one pass.
+// - ImFontAtlasFlags_AsyncGlyphLoading: ImFontBaked_BuildLoadGlyph() adds glyphs with their metrics but no pixels (Visible == false) and queues them.
+//   They are rasterized by a background task started at the end of the frame (atlas->BackgroundTaskStart), and committed by next ImFontAtlasUpdateNewFrame().
+//   Without a background task they are rasterized by next ImFontAtlasUpdateNewFrame(). Queued glyphs refer to their ImFontBaked by id, as pointers don't cross frames.
+//   Anything which may invalidate data read by the task (adding fonts, discarding baked fonts, destroying sources...) calls ImFontAtlasAsyncGlyphsCancel() first.
+// - Special glyphs, missing glyphs and loaders not implementing FontBakedRasterizeGlyph() go through the regular path.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+// Set UV from packed rectangle
+static void ImFontAtlasBakedSetFontGlyphUV(ImFontAtlas* atlas, ImFontBaked* baked, ImFontGlyph* glyph)
+{
+    ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph->PackId);
+    IM_ASSERT(glyph->U0 == 0.0f && glyph->V0 == 0.0f && glyph->U1 == 0.0f && glyph->V1 == 0.0f);
+    glyph->PageIdx = atlas->Builder->RectsIndex[ImFontAtlasRectId_GetIndex(glyph->PackId)].PageIdx;
+    const ImVec2 uv_scale = (glyph->PageIdx == 0) ? atlas->TexUvScale : ImVec2(1.0f / atlas->Builder->Pages[glyph->PageIdx]->Tex->Width, 1.0f / atlas->Builder->Pages[glyph->PageIdx]->Tex->Height);
+    glyph->U0 = (r->x) * uv_scale.x;
+    glyph->V0 = (r->y) * uv_scale.y;
+    glyph->U1 = (r->x + r->w) * uv_scale.x;
+    glyph->V1 = (r->y + r->h) * uv_scale.y;
+    baked->MetricsTotalSurface += r->w * r->h;
+}
+
+static int ImFontAtlasGlyphJobGetPixelsSize(const ImFontAtlasGlyphJob* job)
+{
+    return job->Bitmap.Width * job->Bitmap.Height * ImTextureDataGetFormatBytesPerPixel(job->Bitmap.Format);
+}
+
+// May be called from any thread when loader->FontBakedRasterizeGlyphThreadSafe is set.
+static void ImFontAtlasGlyphJobRasterize(ImFontAtlas* atlas, ImFontAtlasGlyphJob* job, unsigned char* pixels)
+{
+    const ImFontLoader* loader = job->Src->FontLoader ? job->Src->FontLoader : atlas->FontLoader;
+    job->Bitmap.Pixels = pixels + job->PixelsOffset;
+    job->Rasterized = loader->FontBakedRasterizeGlyph(atlas, job->Src, job->Baked, job->LoaderData, job->Codepoint, &job->Glyph, &job->Bitmap);
+}
+
+static int IMGUI_CDECL ImFontAtlasGlyphJob_CompareByHeight(const void* lhs, const void* rhs)
+{
+    const ImFontAtlasGlyphJob* a = (const ImFontAtlasGlyphJob*)lhs;
+    const ImFontAtlasGlyphJob* b = (const ImFontAtlasGlyphJob*)rhs;
+    if (int d = b->Bitmap.Height - a->Bitmap.Height)
+        return d;
+    return (int)a->Glyph.Codepoint - (int)b->Glyph.Codepoint;
+}
+
+// Pack all rectangles first, tallest first, so texture grows/repacks happen before we copy anything.
+// Then register glyphs (or fill placeholder glyphs) and copy pixels.
+static void ImFontAtlasGlyphJobsCommit(ImFontAtlas* atlas, ImVector<ImFontAtlasGlyphJob>& jobs, const unsigned char* pixels)
+{
+    ImQsort(jobs.Data, (size_t)jobs.Size, sizeof(ImFontAtlasGlyphJob), ImFontAtlasGlyphJob_CompareByHeight);
+    for (ImFontAtlasGlyphJob& job : jobs)
+    {
+        if (!job.Rasterized || !job.Glyph.Visible)
+            continue;
+        ImFontAtlasRectId pack_id = ImFontAtlasPackAddGlyphRect(atlas, job.Bitmap.Width, job.Bitmap.Height, job.Baked->UseSDF);
+        if (pack_id == ImFontAtlasRectId_Invalid)
+        {
+            // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
+            IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
+            job.Rasterized = false;
+            continue;
+        }
+        job.Glyph.PackId = pack_id;
+    }
+
+    for (ImFontAtlasGlyphJob& job : jobs)
+    {
+        if (!job.Rasterized)
+            continue;
+        ImFontGlyph* glyph;
+        if (job.GlyphIdx == -1)
+        {
+            glyph = ImFontAtlasBakedAddFontGlyph(atlas, job.Baked, job.Src, &job.Glyph);
+        }
+        else
+        {
+            glyph = &job.Baked->Glyphs[job.GlyphIdx];
+            glyph->Visible = true;
+            glyph->PackId = job.Glyph.PackId;
+            ImFontAtlasBakedSetFontGlyphUV(atlas, job.Baked, glyph);
+        }
+        if (glyph->PackId != ImFontAtlasRectId_Invalid)
+        {
+            ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph->PackId);
+            ImFontAtlasBakedSetFontGlyphBitmap(atlas, job.Baked, job.Src, glyph, r, pixels + job.PixelsOffset, job.Bitmap.Format, job.Bitmap.Width * ImTextureDataGetFormatBytesPerPixel(job.Bitmap.Format));
+        }
+    }
+}
+
+struct ImFontAtlasPreloadGlyphsData
+{
+    ImFontAtlas*                    Atlas;
+    ImVector<ImFontAtlasGlyphJob>   Jobs;
+    ImVector<int>                   DeferredJobs;
+    ImVector<unsigned char>         Pixels;
+};
+
+static void ImFontAtlasBakedPreloadGlyphs_RasterizeDeferred(void* user_data, int index)
+{
+    ImFontAtlasPreloadGlyphsData* data = (ImFontAtlasPreloadGlyphsData*)user_data;
+    ImFontAtlasGlyphJobRasterize(data->Atlas, &data->Jobs[data->DeferredJobs[index]], data->Pixels.Data);
+}
+
+static int IMGUI_CDECL ImWcharCompare(const void* lhs, const void* rhs)
+{
+    return (int)*(const ImWchar*)lhs - (int)*(const ImWchar*)rhs;
+}
+
+void ImFontAtlasBakedPreloadGlyphs(ImFontAtlas* atlas, ImFontBaked* baked, const ImWchar* codepoints, int codepoints_count)
+{
+    ImFont* font = baked->ContainerFont;
+    if (atlas->Locked || (font->Flags & ImFontFlags_NoLoadGlyphs) || codepoints_count <= 0)
+        return;
+
+    // Sort and remove duplicates
+    ImVector<ImWchar> sorted_codepoints;
+    sorted_codepoints.resize(codepoints_count);
+    memcpy(sorted_codepoints.Data, codepoints, (size_t)codepoints_count * sizeof(ImWchar));
+    ImQsort(sorted_codepoints.Data, (size_t)sorted_codepoints.Size, sizeof(ImWchar), ImWcharCompare);
+
+    ImFontAtlasPreloadGlyphsData data;
+    data.Atlas = atlas;
+    data.Jobs.reserve(sorted_codepoints.Size);
+
+    // Query glyphs metrics and bitmap sizes.
+    // Glyphs which cannot be rasterized concurrently are rasterized right away.
+    for (int codepoint_n = 0; codepoint_n < sorted_codepoints.Size; codepoint_n++)
+    {
+        const ImWchar src_codepoint = sorted_codepoints[codepoint_n];
+        if (codepoint_n > 0 && src_codepoint == sorted_codepoints[codepoint_n - 1])
+            continue;
+        if (ImFontBaked_IndexGetLookup(baked, src_codepoint) != IM_FONTGLYPH_INDEX_UNUSED)
+            continue;
+
+        ImWchar codepoint = src_codepoint;
+        ImFontAtlas_FontHookRemapCodepoint(atlas, font, &codepoint);
+        if (codepoint == font->EllipsisChar && font->EllipsisAutoBake)
+        {
+            ImFontBaked_BuildLoadGlyph(baked, src_codepoint, NULL);
+            continue;
+        }
+        ImFontGlyph* cached_glyph;
+        if (atlas->GlyphCacheData.Size > 0 && ImFontAtlasGlyphCacheLoadGlyph(atlas, baked, src_codepoint, NULL, &cached_glyph))
+            continue;
+
+        ImFontAtlasGlyphJob job;
+        bool job_ready = false;
+        char* loader_user_data_p = (char*)baked->FontLoaderDatas;
+        int src_n = 0;
+        for (ImFontConfig* src : font->Sources)
+        {
+            const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+            if (!src->GlyphExcludeRanges || ImFontAtlasBuildAcceptCodepointForSource(src, codepoint))
+            {
+                if (loader->FontBakedRasterizeGlyph == NULL)
+                    break;
+                job = ImFontAtlasGlyphJob();
+                if (loader->FontBakedRasterizeGlyph(atlas, src, baked, loader_user_data_p, codepoint, &job.Glyph, &job.Bitmap))
+                {
+                    job.Glyph.Codepoint = src_codepoint;
+                    job.Glyph.SourceIdx = src_n;
+                    job.Baked = baked;
+                    job.Src = src;
+                    job.LoaderData = loader_user_data_p;
+                    job.Codepoint = codepoint;
+                    job_ready = true;
+                    break;
+                }
+            }
+            loader_user_data_p += loader->FontBakedSrcLoaderDataSize;
+            src_n++;
+        }
+        if (!job_ready)
+        {
+            ImFontBaked_BuildLoadGlyph(baked, src_codepoint, NULL);
+            continue;
+        }
+
+        job.Rasterized = !job.Glyph.Visible;
+        if (job.Glyph.Visible)
+        {
+            const int pixels_size = ImFontAtlasGlyphJobGetPixelsSize(&job);
+            job.PixelsOffset = data.Pixels.Size;
+            data.Pixels.resize(data.Pixels.Size + pixels_size);
+            memset(data.Pixels.Data + job.PixelsOffset, 0, (size_t)pixels_size);
+            const ImFontLoader* loader = job.Src->FontLoader ? job.Src->FontLoader : atlas->FontLoader;
+            if (loader->FontBakedRasterizeGlyphThreadSafe)
+                data.DeferredJobs.push_back(data.Jobs.Size);
+            else
+                ImFontAtlasGlyphJobRasterize(atlas, &job, data.Pixels.Data);
+        }
+        data.Jobs.push_back(job);
+    }
+
+    // Rasterize
+    if (atlas->ParallelFor != NULL && data.DeferredJobs.Size > 1)
+        atlas->ParallelFor(ImFontAtlasBakedPreloadGlyphs_RasterizeDeferred, &data, data.DeferredJobs.Size, atlas->ParallelForUserData);
+    else
+        for (int n = 0; n < data.DeferredJobs.Size; n++)
+            ImFontAtlasBakedPreloadGlyphs_RasterizeDeferred(&data, n);
+
+    ImFontAtlasGlyphJobsCommit(atlas, data.Jobs, data.Pixels.Data);
+}
+
+// Add glyph without pixels, to be rasterized later
+static ImFontGlyph* ImFontAtlasAsyncGlyphsQueue(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, const ImFontGlyph* in_glyph, ImWchar codepoint, const ImFontAtlasGlyphBitmap* bitmap)
+{
+    ImFontGlyph placeholder_glyph = *in_glyph;
+    placeholder_glyph.Visible = false;
+    ImFontGlyph* glyph = ImFontAtlasBakedAddFontGlyph(atlas, baked, src, &placeholder_glyph);
+    if (in_glyph->Visible)
+    {
+        ImFontAtlasGlyphJob job;
+        job.Glyph = *in_glyph;
+        job.BakedId = baked->BakedId;
+        job.GlyphIdx = baked->Glyphs.index_from_ptr(glyph);
+        job.Codepoint = codepoint;
+        job.Bitmap = *bitmap;
+        atlas->Builder->AsyncGlyphsQueued.push_back(job);
+    }
+    return glyph;
+}
+
+// Return true if glyph is a placeholder waiting to be rasterized and committed.
+// Glyphs only referenced by a running task are still safe to check: the task doesn't write BakedId/GlyphIdx.
+static bool ImFontAtlasAsyncGlyphsIsPending(ImFontAtlas* atlas, ImFontBaked* baked, const ImFontGlyph* glyph)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    const int glyph_idx = baked->Glyphs.index_from_ptr(glyph);
+    for (const ImFontAtlasGlyphJob& job : builder->AsyncGlyphsQueued)
+        if (job.BakedId == baked->BakedId && job.GlyphIdx == glyph_idx)
+            return true;
+    for (const ImFontAtlasGlyphJob& job : builder->AsyncGlyphsRunning)
+        if (job.BakedId == baked->BakedId && job.GlyphIdx == glyph_idx)
+            return true;
+    return false;
+}
+
+// Resolve queued glyphs (skipping those whose ImFontBaked was discarded) and allocate their pixels.
+static void ImFontAtlasAsyncGlyphsPrepare(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    IM_ASSERT(!builder->AsyncTaskRunning && builder->AsyncGlyphsRunning.Size == 0);
+    builder->AsyncGlyphsPixels.resize(0);
+    for (ImFontAtlasGlyphJob& job : builder->AsyncGlyphsQueued)
+    {
+        ImFontBaked* baked = (ImFontBaked*)builder->BakedMap.GetVoidPtr(job.BakedId);
+        if (baked == NULL || job.GlyphIdx >= baked->Glyphs.Size)
+            continue;
+        const ImFontGlyph* glyph = &baked->Glyphs[job.GlyphIdx];
+        if (glyph->Codepoint != job.Glyph.Codepoint || glyph->Visible || glyph->PackId != ImFontAtlasRectId_Invalid || (int)glyph->SourceIdx >= baked->ContainerFont->Sources.Size)
+            continue;
+
+        char* loader_user_data_p = (char*)baked->FontLoaderDatas;
+        for (int src_n = 0; src_n < (int)glyph->SourceIdx; src_n++)
+        {
+            ImFontConfig* src = baked->ContainerFont->Sources[src_n];
+            loader_user_data_p += (src->FontLoader ? src->FontLoader : atlas->FontLoader)->FontBakedSrcLoaderDataSize;
+        }
+        job.Baked = baked;
+        job.Src = baked->ContainerFont->Sources[glyph->SourceIdx];
+        job.LoaderData = loader_user_data_p;
+
+        const int pixels_size = ImFontAtlasGlyphJobGetPixelsSize(&job);
+        job.PixelsOffset = builder->AsyncGlyphsPixels.Size;
+        builder->AsyncGlyphsPixels.resize(builder->AsyncGlyphsPixels.Size + pixels_size);
+        memset(builder->AsyncGlyphsPixels.Data + job.PixelsOffset, 0, (size_t)pixels_size);
+        builder->AsyncGlyphsRunning.push_back(job);
+    }
+    builder->AsyncGlyphsQueued.resize(0);
+}
+
+static void ImFontAtlasAsyncGlyphsTask(void* user_data)
+{
+    ImFontAtlas* atlas = (ImFontAtlas*)user_data;
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    for (ImFontAtlasGlyphJob& job : builder->AsyncGlyphsRunning)
+        ImFontAtlasGlyphJobRasterize(atlas, &job, builder->AsyncGlyphsPixels.Data);
+}
+
+// Start background task rasterizing queued glyphs. Called at the end of the frame.
+void ImFontAtlasAsyncGlyphsStart(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder == NULL || builder->AsyncTaskRunning || builder->AsyncGlyphsQueued.Size == 0 || atlas->BackgroundTaskStart == NULL)
+        return;
+    IM_ASSERT(atlas->BackgroundTaskWait != NULL && "Need to set both BackgroundTaskStart and BackgroundTaskWait!");
+    ImFontAtlasAsyncGlyphsPrepare(atlas);
+    if (builder->AsyncGlyphsRunning.Size == 0)
+        return;
+    builder->AsyncTaskRunning = true;
+    atlas->BackgroundTaskStart(ImFontAtlasAsyncGlyphsTask, atlas, atlas->BackgroundTaskUserData);
+}
+
+// Wait for background task and commit its output. Rasterize remaining queued glyphs if we don't have a background task.
+void ImFontAtlasAsyncGlyphsFlush(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder->AsyncTaskRunning)
+    {
+        atlas->BackgroundTaskWait(atlas->BackgroundTaskUserData);
+        builder->AsyncTaskRunning = false;
+    }
+    else if (builder->AsyncGlyphsQueued.Size > 0 && atlas->BackgroundTaskStart == NULL)
+    {
+        ImFontAtlasAsyncGlyphsPrepare(atlas);
+        ImFontAtlasAsyncGlyphsTask(atlas);
+    }
+    if (builder->AsyncGlyphsRunning.Size > 0)
+    {
+        ImFontAtlasGlyphJobsCommit(atlas, builder->AsyncGlyphsRunning, builder->AsyncGlyphsPixels.Data);
+        builder->AsyncGlyphsRunning.resize(0);
+        builder->AsyncGlyphsCommitCount++;
+        builder->TextRunsGeneration++;
+    }
+}
+
+// Wait for background task and put its glyphs back in the queue, before modifying data it may be reading.
+void ImFontAtlasAsyncGlyphsCancel(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder == NULL || !builder->AsyncTaskRunning)
+        return;
+    atlas->BackgroundTaskWait(atlas->BackgroundTaskUserData);
+    builder->AsyncTaskRunning = false;
+    for (ImFontAtlasGlyphJob& job : builder->AsyncGlyphsRunning)
+        builder->AsyncGlyphsQueued.push_back(job);
+    builder->AsyncGlyphsRunning.resize(0);
+}
+
+// Rasterize and commit all pending glyphs right away.
+static void ImFontAtlasAsyncGlyphsFinish(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImFontAtlasAsyncGlyphsCancel(atlas);
+    if (builder->AsyncGlyphsQueued.Size == 0)
+        return;
+    ImFontAtlasAsyncGlyphsPrepare(atlas);
+    ImFontAtlasAsyncGlyphsTask(atlas);
+    ImFontAtlasGlyphJobsCommit(atlas, builder->AsyncGlyphsRunning, builder->AsyncGlyphsPixels.Data);
+    builder->AsyncGlyphsRunning.resize(0);
+    builder->AsyncGlyphsCommitCount++;
+    builder->TextRunsGeneration++;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Deferred loading (ImFontAtlasFlags_SharedAcrossThreads)
+//-----------------------------------------------------------------------------------------------------------------------------
+// Contexts running on different threads may read the atlas at any time during their frame, so it is not modified then:
+// - A missing glyph is drawn with the fallback glyph, a missing size with the closest baked size.
+// - They are recorded in ImDrawListSharedData::FontDeferredLoads[] of the requesting context (found with GImGui, which needs to be thread local).
+// - ImFontAtlasUpdateNewFrame() loads requests of all contexts using the atlas. It must not run during a frame of any of them.
+// - Without a current context (e.g. main thread between frames), the atlas is modified right away.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+static inline bool ImFontAtlasDeferredLoadsEnabled(ImFontAtlas* atlas)
+{
+    return (atlas->Flags & ImFontAtlasFlags_SharedAcrossThreads) && atlas->Builder->DeferredLoadsDisabled == 0 && GImGui != NULL;
+}
+
+static void ImFontAtlasDeferredLoadsAdd(ImFontAtlas* atlas, ImFont* font, float size, float rasterizer_density, int codepoint)
+{
+    ImDrawListSharedData* shared_data = &GImGui->DrawListSharedData;
+    if (!atlas->DrawListSharedDatas.contains(shared_data))
+    {
+        IM_ASSERT(0 && "Atlas with ImFontAtlasFlags_SharedAcrossThreads is used by a context which doesn't use it!");
+        return;
+    }
+    for (const ImFontAtlasDeferredLoad& req : shared_data->FontDeferredLoads)
+        if (req.Font == font && req.Codepoint == codepoint && req.Size == size && req.RasterizerDensity == rasterizer_density)
+            return;
+    ImFontAtlasDeferredLoad req = { font, size, rasterizer_density, codepoint };
+    shared_data->FontDeferredLoads.push_back(req);
+    if (codepoint >= 0 || atlas->Builder->BakedMap.GetVoidPtr(ImFontAtlasBakedGetId(font->FontId, size, rasterizer_density)) == NULL)
+        ImGui::RequestRedrawEx(0.0f, "Font deferred loading"); // Draw again once loaded (not needed for only marking baked font as used)
+}
+
+// Called by ImFontAtlasUpdateNewFrame()
+void ImFontAtlasDeferredLoadsCommit(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    builder->DeferredLoadsDisabled++;
+
+    // Mark all used baked fonts first, as making space for new glyphs may discard unused ones.
+    for (ImDrawListSharedData* shared_data : atlas->DrawListSharedDatas)
+        for (const ImFontAtlasDeferredLoad& req : shared_data->FontDeferredLoads)
+            if (ImFontBaked* baked = (ImFontBaked*)builder->BakedMap.GetVoidPtr(ImFontAtlasBakedGetId(req.Font->FontId, req.Size, req.RasterizerDensity)))
+                baked->LastUsedFrame = builder->FrameCount;
+
+    int glyphs_loaded = 0;
+    for (ImDrawListSharedData* shared_data : atlas->DrawListSharedDatas)
+    {
+        for (const ImFontAtlasDeferredLoad& req : shared_data->FontDeferredLoads)
+        {
+            ImFontBaked* baked = ImFontAtlasBakedGetOrAdd(atlas, req.Font, req.Size, req.RasterizerDensity);
+            if (baked == NULL)
+                continue;
+            baked->LastUsedFrame = builder->FrameCount;
+            if (req.Codepoint >= 0 && ImFontBaked_IndexGetLookup(baked, (unsigned int)req.Codepoint) == IM_FONTGLYPH_INDEX_UNUSED)
+            {
+                ImFontBaked_BuildLoadGlyph(baked, (ImWchar)req.Codepoint, NULL);
+                glyphs_loaded++;
+            }
+        }
+        builder->DeferredLoadsCommitted += shared_data->FontDeferredLoads.Size;
+        shared_data->FontDeferredLoads.resize(0);
+    }
+
+    // Contexts cannot create a size: make sure every font has one they can fall back to.
+    for (ImFont* font : atlas->Fonts)
+        if (ImFontAtlasBakedGetClosestMatch(atlas, font, 1.0f, 1.0f) == NULL)
+            font->GetFontBaked(font->LegacySize > 0.0f ? font->LegacySize : 20.0f, 1.0f); // Same as default ImGuiStyle::FontSizeBase
+
+    // Text measured with fallback glyphs is now stale. Refresh retained windows.
+    if (glyphs_loaded > 0)
+    {
+        ImFontAtlasBuildNotifyBakedChanged(atlas);
+        builder->AsyncGlyphsCommitCount++;
+    }
+    builder->DeferredLoadsDisabled--;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------
+// Persistent glyph cache
+//-----------------------------------------------------------------------------------------------------------------------------
+// - ImFontAtlas::SaveGlyphCacheToMemory() stores metrics and pixels of loaded glyphs. ImFontAtlas::LoadGlyphCacheFromMemory() keeps a copy of
+//   that data, and ImFontBaked_BuildLoadGlyph() copies glyphs from it instead of calling the font loader when the key of the ImFontBaked matches.
+// - Font data is identified by its size and its first 64 KB, which for TTF/OTF include the table directory holding checksums of all tables.
+//   Baked fonts using a source without font data (e.g. custom loaders) are never cached.
+// - Cached pixels are read back from the texture, so they are already post-processed (e.g. RasterizerMultiply) and are copied as-is.
+//-----------------------------------------------------------------------------------------------------------------------------
+
+// Return 0 if baked font can't be cached.
+static ImGuiID ImFontAtlasGlyphCacheCalcBakedKey(ImFontAtlas* atlas, ImFontBaked* baked)
+{
+    ImFont* font = baked->ContainerFont;
+    ImGuiID key = ImHashData(&baked->Size, sizeof(baked->Size));
+    key = ImHashData(&baked->RasterizerDensity, sizeof(baked->RasterizerDensity), key);
+    key = ImHashData(&atlas->FontLoaderFlags, sizeof(atlas->FontLoaderFlags), key);
+    key = ImHashData(&font->EllipsisChar, sizeof(font->EllipsisChar), key);
+    if (baked->UseSDF)
+        key = ImHashStr("SDF", 0, key);
+    for (const ImGuiStoragePair& pair : font->RemapPairs.Data)
+    {
+        key = ImHashData(&pair.key, sizeof(pair.key), key);
+        key = ImHashData(&pair.val_i, sizeof(pair.val_i), key);
+    }
+    for (ImFontConfig* src : font->Sources)
+    {
+        if (src->FontData == NULL || src->FontDataSize <= 0)
+            return 0;
+        const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+        key = ImHashStr(loader->Name ? loader->Name : "", 0, key);
+        key = ImHashData(&src->FontDataSize, sizeof(src->FontDataSize), key);
+        key = ImHashData(src->FontData, (size_t)ImMin(src->FontDataSize, 64 * 1024), key);
+        const float settings_f[] = { src->SizePixels, src->GlyphOffset.x, src->GlyphOffset.y, src->GlyphMinAdvanceX, src->GlyphMaxAdvanceX, src->GlyphExtraAdvanceX, src->RasterizerMultiply, src->RasterizerDensity };
+        const int settings_i[] = { (int)src->FontNo, (int)src->FontLoaderFlags, src->OversampleH, src->OversampleV, src->PixelSnapH, src->PixelSnapV };
+        key = ImHashData(settings_f, sizeof(settings_f), key);
+        key = ImHashData(settings_i, sizeof(settings_i), key);
+        for (const ImWchar* p = src->GlyphExcludeRanges; p && *p; p++)
+            key = ImHashData(p, sizeof(*p), key);
+    }
+    return key ? key : 1;
+}
+
+static const ImFontGlyphCacheBaked* ImFontAtlasGlyphCacheFindBaked(ImFontAtlas* atlas, ImFontBaked* baked)
+{
+    if (atlas->GlyphCacheData.Size == 0)
+        return NULL;
+    const ImFontGlyphCacheHeader* header = (const ImFontGlyphCacheHeader*)(const void*)atlas->GlyphCacheData.Data;
+    const ImFontGlyphCacheBaked* cache_bakeds = (const ImFontGlyphCacheBaked*)(const void*)(header + 1);
+    if (baked->GlyphCacheIdx == 0)
+    {
+        baked->GlyphCacheIdx = -1;
+        if (ImGuiID key = ImFontAtlasGlyphCacheCalcBakedKey(atlas, baked))
+            for (ImU32 n = 0; n < header->BakedCount; n++)
+                if (cache_bakeds[n].Key == key && cache_bakeds[n].Size == baked->Size && cache_bakeds[n].RasterizerDensity == baked->RasterizerDensity)
+                {
+                    baked->GlyphCacheIdx = (int)n + 1;
+                    break;
+                }
+    }
+    return (baked->GlyphCacheIdx > 0) ? &cache_bakeds[baked->GlyphCacheIdx - 1] : NULL;
+}
+
+static const ImFontGlyphCacheGlyph* ImFontAtlasGlyphCacheFindGlyph(ImFontAtlas* atlas, const ImFontGlyphCacheBaked* cache_baked, ImU32 codepoint)
+{
+    const ImFontGlyphCacheGlyph* cache_glyphs = (const ImFontGlyphCacheGlyph*)(const void*)(atlas->GlyphCacheData.Data + cache_baked->GlyphsOffset);
+    int lo = 0;
+    int hi = (int)cache_baked->GlyphsCount;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi) >> 1;
+        if (cache_glyphs[mid].Codepoint < codepoint)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return (lo < (int)cache_baked->GlyphsCount && cache_glyphs[lo].Codepoint == codepoint) ? &cache_glyphs[lo] : NULL;
+}
+
+// Copy glyph from persistent cache. Return false if it isn't in the cache.
+static bool ImFontAtlasGlyphCacheLoadGlyph(ImFontAtlas* atlas, ImFontBaked* baked, ImWchar codepoint, float* only_load_advance_x, ImFontGlyph** out_glyph)
+{
+    const ImFontGlyphCacheBaked* cache_baked = ImFontAtlasGlyphCacheFindBaked(atlas, baked);
+    if (cache_baked == NULL)
+        return false;
+    const ImFontGlyphCacheGlyph* cache_glyph = ImFontAtlasGlyphCacheFindGlyph(atlas, cache_baked, codepoint);
+    if (cache_glyph == NULL || cache_glyph->SourceIdx >= baked->ContainerFont->Sources.Size)
+        return false;
+
+    *out_glyph = NULL;
+    if (only_load_advance_x != NULL)
+    {
+        *only_load_advance_x = cache_glyph->AdvanceX;
+        ImFontAtlasBakedAddFontGlyphAdvancedX(atlas, baked, NULL, codepoint, cache_glyph->AdvanceX);
+        return true;
+    }
+
+    ImFontGlyph glyph;
+    glyph.Codepoint = codepoint;
+    glyph.Colored = cache_glyph->Colored;
+    glyph.Visible = cache_glyph->Visible;
+    glyph.SourceIdx = cache_glyph->SourceIdx;
+    glyph.AdvanceX = cache_glyph->AdvanceX;
+    glyph.X0 = cache_glyph->X0;
+    glyph.Y0 = cache_glyph->Y0;
+    glyph.X1 = cache_glyph->X1;
+    glyph.Y1 = cache_glyph->Y1;
+    const int w = cache_glyph->Width;
+    const int h = cache_glyph->Height;
+    if (w > 0 && h > 0)
+    {
+        ImFontAtlasRectId pack_id = ImFontAtlasPackAddGlyphRect(atlas, w, h, baked->UseSDF);
+        if (pack_id == ImFontAtlasRectId_Invalid)
+        {
+            // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
+            IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
+            return false;
+        }
+        glyph.PackId = pack_id;
+    }
+
+    // Pixels are already post-processed: copy without calling ImFontAtlasBakedSetFontGlyphBitmap()
+    ImFontGlyph* out = ImFontAtlasBakedAddFontGlyph(atlas, baked, NULL, &glyph);
+    if (out->PackId != ImFontAtlasRectId_Invalid)
+    {
+        ImTextureData* tex = ImFontAtlasPackGetRectTexture(atlas, out->PackId);
+        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, out->PackId);
+        const ImTextureFormat src_fmt = (ImTextureFormat)cache_glyph->Format;
+        ImFontAtlasTextureBlockConvert(atlas->GlyphCacheData.Data + cache_glyph->PixelsOffset, src_fmt, w * ImTextureDataGetFormatBytesPerPixel(src_fmt), (unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h);
+        ImFontAtlasTextureBlockQueueUpload(atlas, tex, r->x, r->y, r->w, r->h);
+    }
+    *out_glyph = out;
+    return true;
+}
+
+static bool ImFontAtlasGlyphCacheValidate(const unsigned char* data, size_t data_size)
+{
+    if (data == NULL || data_size < sizeof(ImFontGlyphCacheHeader) || data_size > 0x7FFFFFFF)
+        return false;
+    const ImFontGlyphCacheHeader* header = (const ImFontGlyphCacheHeader*)(const void*)data;
+    if (memcmp(header->Magic, "IMGC", 4) != 0 || header->Version != IM_FONTGLYPHCACHE_VERSION || header->ImGuiVersion != IMGUI_VERSION_NUM)
+        return false;
+    if (sizeof(ImFontGlyphCacheHeader) + (ImU64)header->BakedCount * sizeof(ImFontGlyphCacheBaked) > data_size)
+        return false;
+    const ImFontGlyphCacheBaked* cache_bakeds = (const ImFontGlyphCacheBaked*)(const void*)(header + 1);
+    for (ImU32 baked_n = 0; baked_n < header->BakedCount; baked_n++)
+    {
+        const ImFontGlyphCacheBaked* cache_baked = &cache_bakeds[baked_n];
+        if ((cache_baked->GlyphsOffset & 3) != 0 || cache_baked->GlyphsOffset + (ImU64)cache_baked->GlyphsCount * sizeof(ImFontGlyphCacheGlyph) > data_size)
+            return false;
+        const ImFontGlyphCacheGlyph* cache_glyphs = (const ImFontGlyphCacheGlyph*)(const void*)(data + cache_baked->GlyphsOffset);
+        for (ImU32 glyph_n = 0; glyph_n < cache_baked->GlyphsCount; glyph_n++)
+        {
+            const ImFontGlyphCacheGlyph* cache_glyph = &cache_glyphs[glyph_n];
+            if (glyph_n > 0 && cache_glyph->Codepoint <= cache_glyphs[glyph_n - 1].Codepoint)
+                return false;
+            if (cache_glyph->Format != ImTextureFormat_RGBA32 && cache_glyph->Format != ImTextureFormat_Alpha8)
+                return false;
+            if (cache_glyph->PixelsOffset + (ImU64)cache_glyph->Width * cache_glyph->Height * ImTextureDataGetFormatBytesPerPixel((ImTextureFormat)cache_glyph->Format) > data_size)
+                return false;
+        }
+    }
+    return true;
+}
+
+static int IMGUI_CDECL ImFontGlyphCacheGlyph_CompareByCodepoint(const void* lhs, const void* rhs)
+{
+    const ImFontGlyphCacheGlyph* a = (const ImFontGlyphCacheGlyph*)lhs;
+    const ImFontGlyphCacheGlyph* b = (const ImFontGlyphCacheGlyph*)rhs;
+    return (a->Codepoint < b->Codepoint) ? -1 : (a->Codepoint > b->Codepoint) ? +1 : 0;
+}
+
+// Copy an entry of currently loaded cache. Pixels offsets are relative to 'out_pixels' until final layout is known.
+static void ImFontAtlasGlyphCacheCopyGlyph(ImFontAtlas* atlas, const ImFontGlyphCacheGlyph* cache_glyph, ImVector<ImFontGlyphCacheGlyph>* out_glyphs, ImVector<unsigned char>* out_pixels)
+{
+    const int pixels_size = cache_glyph->Width * cache_glyph->Height * ImTextureDataGetFormatBytesPerPixel((ImTextureFormat)cache_glyph->Format);
+    out_glyphs->push_back(*cache_glyph);
+    out_glyphs->back().PixelsOffset = (ImU32)out_pixels->Size;
+    out_pixels->resize(out_pixels->Size + pixels_size);
+    memcpy(out_pixels->Data + out_glyphs->back().PixelsOffset, atlas->GlyphCacheData.Data + cache_glyph->PixelsOffset, (size_t)pixels_size);
+}
+
+bool ImFontAtlas::LoadGlyphCacheFromDisk(const char* filename)
+{
+    size_t file_data_size = 0;
+    unsigned char* file_data = (unsigned char*)ImFileLoadToMemory(filename, "rb", &file_data_size);
+    if (!file_data)
+        return false;
+    bool ret = LoadGlyphCacheFromMemory(file_data, file_data_size);
+    IM_FREE(file_data);
+    return ret;
+}
+
+// Return false and clear cache if data is invalid or was saved by a different version.
+bool ImFontAtlas::LoadGlyphCacheFromMemory(const void* data, size_t data_size)
+{
+    GlyphCacheData.clear();
+    if (Builder != NULL)
+        for (int baked_n = 0; baked_n < Builder->BakedPool.Size; baked_n++)
+            Builder->BakedPool[baked_n].GlyphCacheIdx = 0;
+    if (!ImFontAtlasGlyphCacheValidate((const unsigned char*)data, data_size))
+        return false;
+    GlyphCacheData.resize((int)data_size);
+    memcpy(GlyphCacheData.Data, data, data_size);
+    return true;
+}
+
+bool ImFontAtlas::SaveGlyphCacheToDisk(const char* filename)
+{
+    ImVector<unsigned char> data;
+    SaveGlyphCacheToMemory(&data);
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    bool ret = ImFileWrite(data.Data, 1, (ImU64)data.Size, f) == (ImU64)data.Size;
+    ImFileClose(f);
+    return ret;
+}
+
+void ImFontAtlas::SaveGlyphCacheToMemory(ImVector<unsigned char>* out_data)
+{
+    ImVector<ImFontGlyphCacheBaked> out_bakeds;
+    ImVector<ImFontGlyphCacheGlyph> out_glyphs;
+    ImVector<unsigned char> out_pixels;
+    ImVector<bool> cache_bakeds_used;
+    const ImFontGlyphCacheHeader* cache_header = GlyphCacheData.Size ? (const ImFontGlyphCacheHeader*)(const void*)GlyphCacheData.Data : NULL;
+    const ImFontGlyphCacheBaked* cache_bakeds = cache_header ? (const ImFontGlyphCacheBaked*)(const void*)(cache_header + 1) : NULL;
+    cache_bakeds_used.resize(cache_header ? (int)cache_header->BakedCount : 0, false);
+
+    ImFontAtlasBuilder* builder = Builder;
+    if (builder != NULL)
+    {
+        // Rasterize pending glyphs so they are included
+        if (!Locked)
+            ImFontAtlasAsyncGlyphsFinish(this);
+
+        // Glyphs currently loaded
+        ImTextureData* tex = TexData;
+        const int bytes_per_pixel = tex->BytesPerPixel;
+        for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+        {
+            ImFontBaked* baked = &builder->BakedPool[baked_n];
+            if (baked->WantDestroy)
+                continue;
+            ImFontGlyphCacheBaked out_baked;
+            out_baked.Key = ImFontAtlasGlyphCacheCalcBakedKey(this, baked);
+            if (out_baked.Key == 0)
+                continue;
+            out_baked.Size = baked->Size;
+            out_baked.RasterizerDensity = baked->RasterizerDensity;
+            out_baked.GlyphsOffset = (ImU32)out_glyphs.Size; // Index until final layout is known
+            for (const ImFontGlyph& glyph : baked->Glyphs)
             {
-                ImFontGlyph glyph_buf;
-                if (loader->FontBakedLoadGlyph(atlas, src, baked, loader_user_data_p, codepoint, &glyph_buf, NULL))
+                const bool has_pixels = (glyph.PackId != ImFontAtlasRectId_Invalid && tex->Pixels != NULL);
+                if (glyph.Visible && !has_pixels)
+                    continue;
+                ImFontGlyphCacheGlyph out_glyph = {};
+                out_glyph.Codepoint = glyph.Codepoint;
+                out_glyph.SourceIdx = (ImU8)glyph.SourceIdx;
+                out_glyph.Colored = (ImU8)glyph.Colored;
+                out_glyph.Visible = (ImU8)glyph.Visible;
+                out_glyph.Format = (ImU8)tex->Format;
+                out_glyph.AdvanceX = glyph.AdvanceX;
+                out_glyph.X0 = glyph.X0;
+                out_glyph.Y0 = glyph.Y0;
+                out_glyph.X1 = glyph.X1;
+                out_glyph.Y1 = glyph.Y1;
+                out_glyph.PixelsOffset = (ImU32)out_pixels.Size;
+                if (has_pixels)
                 {
-                    // FIXME: Add hooks for e.g. #7962
-                    glyph_buf.Codepoint = src_codepoint;
-                    glyph_buf.SourceIdx = src_n;
-                    return ImFontAtlasBakedAddFontGlyph(atlas, baked, src, &glyph_buf);
+                    ImTextureData* glyph_tex = ImFontAtlasPageGetTexture(this, glyph.PageIdx);
+                    ImTextureRect* r = ImFontAtlasPackGetRect(this, glyph.PackId);
+                    const int row_size = r->w * bytes_per_pixel;
+                    out_glyph.Width = r->w;
+                    out_glyph.Height = r->h;
+                    out_pixels.resize(out_pixels.Size + row_size * r->h);
+                    for (int y = 0; y < r->h; y++)
+                        memcpy(out_pixels.Data + out_glyph.PixelsOffset + y * row_size, glyph_tex->GetPixelsAt(r->x, r->y + y), (size_t)row_size);
                 }
+                out_glyphs.push_back(out_glyph);
             }
-            else
+
+            // Cached glyphs which haven't been loaded during this session
+            if (const ImFontGlyphCacheBaked* cache_baked = ImFontAtlasGlyphCacheFindBaked(this, baked))
             {
-                // Special mode but only loading glyphs metrics. Will rasterize and pack later.
-                if (loader->FontBakedLoadGlyph(atlas, src, baked, loader_user_data_p, codepoint, NULL, only_load_advance_x))
+                cache_bakeds_used[(int)(cache_baked - cache_bakeds)] = true;
+                const ImFontGlyphCacheGlyph* cache_glyphs = (const ImFontGlyphCacheGlyph*)(const void*)(GlyphCacheData.Data + cache_baked->GlyphsOffset);
+                for (ImU32 glyph_n = 0; glyph_n < cache_baked->GlyphsCount; glyph_n++)
                 {
-                    ImFontAtlasBakedAddFontGlyphAdvancedX(atlas, baked, src, codepoint, *only_load_advance_x);
-                    return NULL;
+                    const ImU32 codepoint = cache_glyphs[glyph_n].Codepoint;
+                    const int glyph_idx = ImFontBaked_IndexGetLookup(baked, codepoint);
+                    if (glyph_idx == IM_FONTGLYPH_INDEX_UNUSED || glyph_idx == IM_FONTGLYPH_INDEX_NOT_FOUND)
+                        ImFontAtlasGlyphCacheCopyGlyph(this, &cache_glyphs[glyph_n], &out_glyphs, &out_pixels);
                 }
             }
+            out_baked.GlyphsCount = (ImU32)out_glyphs.Size - out_baked.GlyphsOffset;
+            ImQsort(out_glyphs.Data + out_baked.GlyphsOffset, (size_t)out_baked.GlyphsCount, sizeof(ImFontGlyphCacheGlyph), ImFontGlyphCacheGlyph_CompareByCodepoint);
+            out_bakeds.push_back(out_baked);
         }
-        loader_user_data_p += loader->FontBakedSrcLoaderDataSize;
-        src_n++;
     }
 
-    // Lazily load fallback glyph
-    if (baked->LoadNoFallback)
-        return NULL;
-    if (baked->FallbackGlyphIndex == -1)
-        ImFontAtlasBuildSetupFontBakedFallback(baked);
-
-    // Mark index as not found, so we don't attempt the search twice
-    ImFontBaked_BuildGrowIndex(baked, codepoint + 1);
-    baked->IndexAdvanceX[codepoint] = baked->FallbackAdvanceX;
-    baked->IndexLookup[codepoint] = IM_FONTGLYPH_INDEX_NOT_FOUND;
-    return NULL;
+    // Entries of loaded cache which haven't been used during this session
+    for (int cache_baked_n = 0; cache_baked_n < cache_bakeds_used.Size; cache_baked_n++)
+    {
+        if (cache_bakeds_used[cache_baked_n])
+            continue;
+        const ImFontGlyphCacheBaked* cache_baked = &cache_bakeds[cache_baked_n];
+        ImFontGlyphCacheBaked out_baked = *cache_baked;
+        out_baked.GlyphsOffset = (ImU32)out_glyphs.Size;
+        const ImFontGlyphCacheGlyph* cache_glyphs = (const ImFontGlyphCacheGlyph*)(const void*)(GlyphCacheData.Data + cache_baked->GlyphsOffset);
+        for (ImU32 glyph_n = 0; glyph_n < cache_baked->GlyphsCount; glyph_n++)
+            ImFontAtlasGlyphCacheCopyGlyph(this, &cache_glyphs[glyph_n], &out_glyphs, &out_pixels);
+        out_bakeds.push_back(out_baked);
+    }
+
+    // Final layout
+    const ImU32 glyphs_offset = (ImU32)(sizeof(ImFontGlyphCacheHeader) + out_bakeds.size_in_bytes());
+    const ImU32 pixels_offset = glyphs_offset + (ImU32)out_glyphs.size_in_bytes();
+    for (ImFontGlyphCacheBaked& out_baked : out_bakeds)
+        out_baked.GlyphsOffset = glyphs_offset + out_baked.GlyphsOffset * (ImU32)sizeof(ImFontGlyphCacheGlyph);
+    for (ImFontGlyphCacheGlyph& out_glyph : out_glyphs)
+        out_glyph.PixelsOffset += pixels_offset;
+
+    ImFontGlyphCacheHeader header;
+    memcpy(header.Magic, "IMGC", 4);
+    header.Version = IM_FONTGLYPHCACHE_VERSION;
+    header.ImGuiVersion = IMGUI_VERSION_NUM;
+    header.BakedCount = (ImU32)out_bakeds.Size;
+    out_data->resize((int)pixels_offset + out_pixels.Size);
+    memcpy(out_data->Data, &header, sizeof(header));
+    memcpy(out_data->Data + sizeof(header), out_bakeds.Data, out_bakeds.size_in_bytes());
+    memcpy(out_data->Data + glyphs_offset, out_glyphs.Data, out_glyphs.size_in_bytes());
+    memcpy(out_data->Data + pixels_offset, out_pixels.Data, out_pixels.size_in_bytes());
 }
 
 static float ImFontBaked_BuildLoadGlyphAdvanceX(ImFontBaked* baked, ImWchar codepoint)
@@ -4570,6 +6612,7 @@ static bool ImGui_ImplStbTrueType_FontSrcInit(ImFontAtlas* atlas, ImFontConfig*
         IM_ASSERT_USER_ERROR(0, "stbtt_InitFont(): failed to parse FontData. It is correct and complete? Check FontDataSize.");
         return false;
     }
+    bd_font_data->FontInfo.userdata = NULL; // Non-NULL only for our worker thread copies, see ImStbTrueTypeMemAlloc()
     src->FontLoaderData = bd_font_data;
 
     const float ref_size = src->DstFont->Sources[0]->SizePixels;
@@ -4623,8 +6666,10 @@ static bool ImGui_ImplStbTrueType_FontBakedInit(ImFontAtlas* atlas, ImFontConfig
     return true;
 }
 
-static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void*, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
+static bool ImGui_ImplStbTrueType_FontBakedRasterizeGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void*, ImWchar codepoint, ImFontGlyph* out_glyph, ImFontAtlasGlyphBitmap* out_bitmap)
 {
+    IM_UNUSED(atlas);
+
     // Search for first font which has the glyph
     ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData;
     IM_ASSERT(bd_font_data);
@@ -4640,52 +6685,55 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
     const float scale_for_raster_x = bd_font_data->ScaleFactor * baked->Size * rasterizer_density * oversample_h;
     const float scale_for_raster_y = bd_font_data->ScaleFactor * baked->Size * rasterizer_density * oversample_v;
 
+    // Render with oversampling
+    // (those functions conveniently assert if pixels are not cleared, which is another safety layer)
+    // This may be called from any thread: use a copy of stbtt_fontinfo with 'userdata' set, so STBTT_malloc() doesn't call debug allocation hooks.
+    if (out_bitmap->Pixels != NULL)
+    {
+        stbtt_fontinfo font_info = bd_font_data->FontInfo;
+        font_info.userdata = &font_info;
+        if (baked->UseSDF)
+        {
+            int sdf_w, sdf_h, sdf_off_x, sdf_off_y;
+            unsigned char* sdf_pixels = stbtt_GetGlyphSDF(&font_info, scale_for_raster_x, glyph_index, IM_FONTGLYPH_SDF_PADDING, IM_FONTGLYPH_SDF_ONEDGE_VALUE, IM_FONTGLYPH_SDF_PIXEL_DIST_SCALE, &sdf_w, &sdf_h, &sdf_off_x, &sdf_off_y);
+            if (sdf_pixels == NULL)
+                return true;
+            IM_ASSERT(sdf_w == out_bitmap->Width && sdf_h == out_bitmap->Height);
+            memcpy(out_bitmap->Pixels, sdf_pixels, (size_t)(sdf_w * sdf_h));
+            stbtt_FreeSDF(sdf_pixels, font_info.userdata);
+            return true;
+        }
+        float sub_x, sub_y;
+        stbtt_MakeGlyphBitmapSubpixelPrefilter(&font_info, out_bitmap->Pixels, out_bitmap->Width, out_bitmap->Height, out_bitmap->Width,
+            scale_for_raster_x, scale_for_raster_y, 0, 0, oversample_h, oversample_v, &sub_x, &sub_y, glyph_index);
+        return true;
+    }
+
     // Obtain size and advance
     int x0, y0, x1, y1;
     int advance, lsb;
     stbtt_GetGlyphBitmapBoxSubpixel(&bd_font_data->FontInfo, glyph_index, scale_for_raster_x, scale_for_raster_y, 0, 0, &x0, &y0, &x1, &y1);
     stbtt_GetGlyphHMetrics(&bd_font_data->FontInfo, glyph_index, &advance, &lsb);
 
-    // Load metrics only mode
-    if (out_advance_x != NULL)
-    {
-        IM_ASSERT(out_glyph == NULL);
-        *out_advance_x = advance * scale_for_layout;
-        return true;
-    }
-
     // Prepare glyph
     out_glyph->Codepoint = codepoint;
     out_glyph->AdvanceX = advance * scale_for_layout;
 
-    // Pack and retrieve position inside texture atlas
     // (generally based on stbtt_PackFontRangesRenderIntoRects)
     const bool is_visible = (x0 != x1 && y0 != y1);
     if (is_visible)
     {
-        const int w = (x1 - x0 + oversample_h - 1);
-        const int h = (y1 - y0 + oversample_v - 1);
-        ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
-        if (pack_id == ImFontAtlasRectId_Invalid)
-        {
-            // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
-            IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
-            return false;
-        }
-        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
-
-        // Render
+        // Signed distance fields are padded on each side (same as stbtt_GetGlyphSDF()). Oversampling is disabled.
+        const int padding = baked->UseSDF ? IM_FONTGLYPH_SDF_PADDING : 0;
+        const int w = (x1 - x0 + oversample_h - 1) + padding * 2;
+        const int h = (y1 - y0 + oversample_v - 1) + padding * 2;
         stbtt_GetGlyphBitmapBox(&bd_font_data->FontInfo, glyph_index, scale_for_raster_x, scale_for_raster_y, &x0, &y0, &x1, &y1);
-        ImFontAtlasBuilder* builder = atlas->Builder;
-        builder->TempBuffer.resize(w * h * 1);
-        unsigned char* bitmap_pixels = builder->TempBuffer.Data;
-        memset(bitmap_pixels, 0, w * h * 1);
+        x0 -= padding;
+        y0 -= padding;
 
-        // Render with oversampling
-        // (those functions conveniently assert if pixels are not cleared, which is another safety layer)
-        float sub_x, sub_y;
-        stbtt_MakeGlyphBitmapSubpixelPrefilter(&bd_font_data->FontInfo, bitmap_pixels, w, h, w,
-            scale_for_raster_x, scale_for_raster_y, 0, 0, oversample_h, oversample_v, &sub_x, &sub_y, glyph_index);
+        // Same as values output by stbtt_MakeGlyphBitmapSubpixelPrefilter()
+        const float sub_x = (oversample_h > 0) ? (float)-(oversample_h - 1) / (2.0f * (float)oversample_h) : 0.0f;
+        const float sub_y = (oversample_v > 0) ? (float)-(oversample_v - 1) / (2.0f * (float)oversample_v) : 0.0f;
 
         const float ref_size = baked->ContainerFont->Sources[0]->SizePixels;
         const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
@@ -4701,15 +6749,65 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
         float recip_v = 1.0f / (oversample_v * rasterizer_density);
 
         // Register glyph
-        // r->x r->y are coordinates inside texture (in pixels)
         // glyph.X0, glyph.Y0 are drawing coordinates from base text position, and accounting for oversampling.
         out_glyph->X0 = x0 * recip_h + font_off_x;
         out_glyph->Y0 = y0 * recip_v + font_off_y;
-        out_glyph->X1 = (x0 + (int)r->w) * recip_h + font_off_x;
-        out_glyph->Y1 = (y0 + (int)r->h) * recip_v + font_off_y;
+        out_glyph->X1 = (x0 + w) * recip_h + font_off_x;
+        out_glyph->Y1 = (y0 + h) * recip_v + font_off_y;
         out_glyph->Visible = true;
+        out_bitmap->Width = w;
+        out_bitmap->Height = h;
+        out_bitmap->Format = ImTextureFormat_Alpha8;
+    }
+
+    return true;
+}
+
+static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
+{
+    // Load metrics only mode
+    if (out_advance_x != NULL)
+    {
+        IM_ASSERT(out_glyph == NULL);
+        ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData;
+        IM_ASSERT(bd_font_data);
+        int glyph_index = stbtt_FindGlyphIndex(&bd_font_data->FontInfo, (int)codepoint);
+        if (glyph_index == 0)
+            return false;
+        int advance, lsb;
+        stbtt_GetGlyphHMetrics(&bd_font_data->FontInfo, glyph_index, &advance, &lsb);
+        *out_advance_x = advance * bd_font_data->ScaleFactor * baked->Size;
+        return true;
+    }
+
+    ImFontAtlasGlyphBitmap bitmap = {};
+    if (!ImGui_ImplStbTrueType_FontBakedRasterizeGlyph(atlas, src, baked, loader_data_for_baked_src, codepoint, out_glyph, &bitmap))
+        return false;
+
+    // Pack and retrieve position inside texture atlas
+    if (out_glyph->Visible)
+    {
+        const int w = bitmap.Width;
+        const int h = bitmap.Height;
+        ImFontAtlasRectId pack_id = ImFontAtlasPackAddGlyphRect(atlas, w, h, baked->UseSDF);
+        if (pack_id == ImFontAtlasRectId_Invalid)
+        {
+            // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
+            IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
+            return false;
+        }
+        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
+
+        // Render
+        ImFontAtlasBuilder* builder = atlas->Builder;
+        builder->TempBuffer.resize(w * h * 1);
+        bitmap.Pixels = builder->TempBuffer.Data;
+        memset(bitmap.Pixels, 0, w * h * 1);
+        ImGui_ImplStbTrueType_FontBakedRasterizeGlyph(atlas, src, baked, loader_data_for_baked_src, codepoint, out_glyph, &bitmap);
+
+        // r->x r->y are coordinates inside texture (in pixels)
         out_glyph->PackId = pack_id;
-        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, bitmap_pixels, ImTextureFormat_Alpha8, w);
+        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, bitmap.Pixels, ImTextureFormat_Alpha8, w);
     }
 
     return true;
@@ -4725,6 +6823,9 @@ const ImFontLoader* ImFontAtlasGetFontLoaderForStbTruetype()
     loader.FontBakedInit = ImGui_ImplStbTrueType_FontBakedInit;
     loader.FontBakedDestroy = NULL;
     loader.FontBakedLoadGlyph = ImGui_ImplStbTrueType_FontBakedLoadGlyph;
+    loader.FontBakedRasterizeGlyph = ImGui_ImplStbTrueType_FontBakedRasterizeGlyph;
+    loader.FontBakedRasterizeGlyphThreadSafe = true;
+    loader.FontBakedSupportsSDF = true;
     return &loader;
 }
 
@@ -5062,6 +7163,7 @@ void ImFontBaked::ClearOutputData()
     Glyphs.clear();
     IndexAdvanceX.clear();
     IndexLookup.clear();
+    IndexPages.clear();
     FallbackGlyphIndex = -1;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
@@ -5112,17 +7214,8 @@ ImFontGlyph* ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked
     ImFontGlyph* glyph = &baked->Glyphs[glyph_idx];
     IM_ASSERT(baked->Glyphs.Size < 0xFFFE); // IndexLookup[] hold 16-bit values and -1/-2 are reserved.
 
-    // Set UV from packed rectangle
     if (glyph->PackId != ImFontAtlasRectId_Invalid)
-    {
-        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph->PackId);
-        IM_ASSERT(glyph->U0 == 0.0f && glyph->V0 == 0.0f && glyph->U1 == 0.0f && glyph->V1 == 0.0f);
-        glyph->U0 = (r->x) * atlas->TexUvScale.x;
-        glyph->V0 = (r->y) * atlas->TexUvScale.y;
-        glyph->U1 = (r->x + r->w) * atlas->TexUvScale.x;
-        glyph->V1 = (r->y + r->h) * atlas->TexUvScale.y;
-        baked->MetricsTotalSurface += r->w * r->h;
-    }
+        ImFontAtlasBakedSetFontGlyphUV(atlas, baked, glyph);
 
     if (src != NULL)
     {
@@ -5145,13 +7238,17 @@ ImFontGlyph* ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked
         glyph->AdvanceX = advance_x + src->GlyphExtraAdvanceX;
     }
     if (glyph->Colored)
+    {
         atlas->TexPixelsUseColors = atlas->TexData->UseColors = true;
+        if (glyph->PageIdx != 0)
+            ImFontAtlasPageGetTexture(atlas, glyph->PageIdx)->UseColors = true;
+    }
 
     // Update lookup tables
     const int codepoint = glyph->Codepoint;
-    ImFontBaked_BuildGrowIndex(baked, codepoint + 1);
-    baked->IndexAdvanceX[codepoint] = glyph->AdvanceX;
-    baked->IndexLookup[codepoint] = (ImU16)glyph_idx;
+    const int index_slot = ImFontBaked_BuildGetIndexSlot(baked, codepoint);
+    baked->IndexAdvanceX[index_slot] = glyph->AdvanceX;
+    baked->IndexLookup[index_slot] = (ImU16)glyph_idx;
     const int page_n = codepoint / 8192;
     baked->ContainerFont->Used8kPagesMap[page_n >> 3] |= 1 << (page_n & 7);
 
@@ -5177,14 +7274,14 @@ void ImFontAtlasBakedAddFontGlyphAdvancedX(ImFontAtlas* atlas, ImFontBaked* bake
         advance_x += src->GlyphExtraAdvanceX;
     }
 
-    ImFontBaked_BuildGrowIndex(baked, codepoint + 1);
-    baked->IndexAdvanceX[codepoint] = advance_x;
+    const int index_slot = ImFontBaked_BuildGetIndexSlot(baked, codepoint);
+    baked->IndexAdvanceX[index_slot] = advance_x;
 }
 
 // Copy to texture, post-process and queue update for backend
 void ImFontAtlasBakedSetFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, ImTextureRect* r, const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch)
 {
-    ImTextureData* tex = atlas->TexData;
+    ImTextureData* tex = (glyph->PackId != ImFontAtlasRectId_Invalid) ? ImFontAtlasPackGetRectTexture(atlas, glyph->PackId) : atlas->TexData;
     IM_ASSERT(r->x + r->w <= tex->Width && r->y + r->h <= tex->Height);
     ImFontAtlasTextureBlockConvert(src_pixels, src_fmt, src_pitch, (unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h);
     ImFontAtlasPostProcessData pp_data = { atlas, baked->ContainerFont, src, baked, glyph, tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h };
@@ -5200,13 +7297,12 @@ void ImFont::AddRemapChar(ImWchar from_codepoint, ImWchar to_codepoint)
 // Find glyph, load if necessary, return fallback if missing
 ImFontGlyph* ImFontBaked::FindGlyph(ImWchar c)
 {
-    if (c < (size_t)IndexLookup.Size) IM_LIKELY
+    const int i = ImFontBaked_IndexGetLookup(this, c);
+    if (i != IM_FONTGLYPH_INDEX_UNUSED) IM_LIKELY
     {
-        const int i = (int)IndexLookup.Data[c];
         if (i == IM_FONTGLYPH_INDEX_NOT_FOUND)
             return &Glyphs.Data[FallbackGlyphIndex];
-        if (i != IM_FONTGLYPH_INDEX_UNUSED)
-            return &Glyphs.Data[i];
+        return &Glyphs.Data[i];
     }
     ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(this, c, NULL);
     return glyph ? glyph : &Glyphs.Data[FallbackGlyphIndex];
@@ -5215,14 +7311,15 @@ ImFontGlyph* ImFontBaked::FindGlyph(ImWchar c)
 // Attempt to load but when missing, return NULL instead of FallbackGlyph
 ImFontGlyph* ImFontBaked::FindGlyphNoFallback(ImWchar c)
 {
-    if (c < (size_t)IndexLookup.Size) IM_LIKELY
+    const int i = ImFontBaked_IndexGetLookup(this, c);
+    if (i != IM_FONTGLYPH_INDEX_UNUSED) IM_LIKELY
     {
-        const int i = (int)IndexLookup.Data[c];
         if (i == IM_FONTGLYPH_INDEX_NOT_FOUND)
             return NULL;
-        if (i != IM_FONTGLYPH_INDEX_UNUSED)
-            return &Glyphs.Data[i];
+        return &Glyphs.Data[i];
     }
+    if (ImFontAtlasDeferredLoadsEnabled(ContainerFont->ContainerAtlas))
+        return ImFontBaked_BuildLoadGlyph(this, c, NULL); // Doesn't write to baked font (ImFontAtlasFlags_SharedAcrossThreads)
     LoadNoFallback = true; // This is actually a rare call, not done in hot-loop, so we prioritize not adding extra cruft to ImFontBaked_BuildLoadGlyph() call sites.
     ImFontGlyph* glyph = ImFontBaked_BuildLoadGlyph(this, c, NULL);
     LoadNoFallback = false;
@@ -5231,15 +7328,17 @@ ImFontGlyph* ImFontBaked::FindGlyphNoFallback(ImWchar c)
 
 bool ImFontBaked::IsGlyphLoaded(ImWchar c)
 {
-    if (c < (size_t)IndexLookup.Size) IM_LIKELY
-    {
-        const int i = (int)IndexLookup.Data[c];
-        if (i == IM_FONTGLYPH_INDEX_NOT_FOUND)
-            return false;
-        if (i != IM_FONTGLYPH_INDEX_UNUSED)
-            return true;
-    }
-    return false;
+    const int i = ImFontBaked_IndexGetLookup(this, c);
+    return i != IM_FONTGLYPH_INDEX_UNUSED && i != IM_FONTGLYPH_INDEX_NOT_FOUND;
+}
+
+// With ImFontAtlasFlags_SharedAcrossThreads, this needs to be called while no other thread is using the atlas.
+void ImFontBaked::PreloadGlyphs(const ImWchar* codepoints, int codepoints_count)
+{
+    ImFontAtlas* atlas = ContainerFont->ContainerAtlas;
+    atlas->Builder->DeferredLoadsDisabled++;
+    ImFontAtlasBakedPreloadGlyphs(atlas, this, codepoints, codepoints_count);
+    atlas->Builder->DeferredLoadsDisabled--;
 }
 
 // This is not fast query
@@ -5260,13 +7359,10 @@ bool ImFont::IsGlyphInFont(ImWchar c)
 IM_MSVC_RUNTIME_CHECKS_OFF
 float ImFontBaked::GetCharAdvance(ImWchar c)
 {
-    if ((int)c < IndexAdvanceX.Size)
-    {
-        // Missing glyphs fitting inside index will have stored FallbackAdvanceX already.
-        const float x = IndexAdvanceX.Data[c];
-        if (x >= 0.0f)
-            return x;
-    }
+    // Missing glyphs fitting inside index will have stored FallbackAdvanceX already.
+    const float x = ImFontBaked_IndexGetAdvanceX(this, c);
+    if (x >= 0.0f)
+        return x;
     return ImFontBaked_BuildLoadGlyphAdvanceX(this, c);
 }
 IM_MSVC_RUNTIME_CHECKS_RESTORE
@@ -5283,7 +7379,9 @@ ImGuiID ImFontAtlasBakedGetId(ImGuiID font_id, float baked_size, float rasterize
 // ImFontBaked pointers are valid for the entire frame but shall never be kept between frames.
 ImFontBaked* ImFont::GetFontBaked(float size, float density)
 {
-    ImFontBaked* baked = LastBaked;
+    // Substitute fonts not added to an atlas only have one baked font (see ImFontInitSubstitute())
+    if (FontId == 0)
+        return LastBaked;
 
     // Round font size
     // - ImGui::PushFont() will already round, but other paths calling GetFontBaked() directly also needs it (e.g. ImFontAtlasBuildPreloadAllGlyphRanges)
@@ -5291,11 +7389,30 @@ ImFontBaked* ImFont::GetFontBaked(float size, float density)
 
     if (density < 0.0f)
         density = CurrentRasterizerDensity;
-    if (baked && baked->Size == size && baked->RasterizerDensity == density)
-        return baked;
 
+    // Signed distance field fonts use a single baked size, scaled by RenderText()/CalcTextSize() callers.
+    if ((Flags & ImFontFlags_SDF) && ImFontAtlasFontCanUseSDF(ContainerAtlas, this))
+    {
+        size = Sources[0]->SdfSize;
+        density = 1.0f;
+    }
+
+    // Shared across threads: don't write to LastBaked or LastUsedFrame, next ImFontAtlasUpdateNewFrame() will mark baked font as used.
     ImFontAtlas* atlas = ContainerAtlas;
     ImFontAtlasBuilder* builder = atlas->Builder;
+    ImFontBaked* baked;
+    if (ImFontAtlasDeferredLoadsEnabled(atlas))
+    {
+        baked = ImFontAtlasBakedGetOrAdd(atlas, this, size, density);
+        if (baked != NULL && baked->LastUsedFrame != builder->FrameCount)
+            ImFontAtlasDeferredLoadsAdd(atlas, this, baked->Size, baked->RasterizerDensity, -1);
+        return baked;
+    }
+
+    baked = LastBaked;
+    if (baked && baked->Size == size && baked->RasterizerDensity == density)
+        return baked;
+
     baked = ImFontAtlasBakedGetOrAdd(atlas, this, size, density);
     if (baked == NULL)
         return NULL;
@@ -5304,6 +7421,50 @@ ImFontBaked* ImFont::GetFontBaked(float size, float density)
     return baked;
 }
 
+// Setup a font which is not added to the atlas and draws every character with the 'c' glyph of 'src_font' at current size (e.g. InputText() password font).
+// Reading from it never loads glyphs nor writes to atlas data, so it may be owned by a context while src_font is used by contexts on other threads.
+// Clear dst_font->ContainerAtlas and dst_font->LastBaked when done using it, as ~ImFont() would otherwise access the atlas.
+void ImFontInitSubstitute(ImFont* dst_font, ImFontBaked* dst_baked, ImFont* src_font, ImFontBaked* src_baked, ImWchar c)
+{
+    const ImFontGlyph* src_glyph = src_baked->FindGlyph(c);
+    dst_baked->Size = src_baked->Size;
+    dst_baked->RasterizerDensity = src_baked->RasterizerDensity;
+    dst_baked->Ascent = src_baked->Ascent;
+    dst_baked->Descent = src_baked->Descent;
+    dst_baked->UseSDF = src_baked->UseSDF;
+    dst_baked->LastUsedFrame = src_baked->LastUsedFrame;
+    dst_baked->GlyphCacheIdx = -1;
+    dst_baked->BakedId = 0;
+    dst_baked->ContainerFont = dst_font;
+    dst_baked->Glyphs.resize(1);
+    dst_baked->Glyphs[0] = *src_glyph;
+    dst_baked->FallbackGlyphIndex = 0;
+    dst_baked->FallbackAdvanceX = src_glyph->AdvanceX;
+
+    // All index pages point to a single page where every codepoint is marked as not found, so lookups always return the fallback glyph.
+    dst_baked->IndexPages.resize((IM_UNICODE_CODEPOINT_MAX + 1) >> IM_FONTBAKED_INDEX_PAGE_SHIFT);
+    memset(dst_baked->IndexPages.Data, 0, (size_t)dst_baked->IndexPages.size_in_bytes());
+    dst_baked->IndexLookup.resize(IM_FONTBAKED_INDEX_PAGE_SIZE);
+    dst_baked->IndexAdvanceX.resize(IM_FONTBAKED_INDEX_PAGE_SIZE);
+    for (int n = 0; n < IM_FONTBAKED_INDEX_PAGE_SIZE; n++)
+    {
+        dst_baked->IndexLookup.Data[n] = IM_FONTGLYPH_INDEX_NOT_FOUND;
+        dst_baked->IndexAdvanceX.Data[n] = src_glyph->AdvanceX;
+    }
+
+    dst_font->Flags = src_font->Flags | ImFontFlags_NoLoadGlyphs;
+    dst_font->LastBaked = dst_baked;
+    dst_font->ContainerAtlas = src_font->ContainerAtlas;
+    dst_font->CurrentRasterizerDensity = src_font->CurrentRasterizerDensity;
+    dst_font->FontId = 0;
+    dst_font->LegacySize = src_font->LegacySize;
+    dst_font->EllipsisChar = src_font->EllipsisChar;
+    dst_font->FallbackChar = c;
+#ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
+    dst_font->Scale = src_font->Scale;
+#endif
+}
+
 ImFontBaked* ImFontAtlasBakedGetOrAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density)
 {
     // FIXME-NEWATLAS: Design for picking a nearest size based on some criteria?
@@ -5311,18 +7472,21 @@ ImFontBaked* ImFontAtlasBakedGetOrAdd(ImFontAtlas* atlas, ImFont* font, float fo
     IM_ASSERT(font_size > 0.0f && font_rasterizer_density > 0.0f);
     ImGuiID baked_id = ImFontAtlasBakedGetId(font->FontId, font_size, font_rasterizer_density);
     ImFontAtlasBuilder* builder = atlas->Builder;
-    ImFontBaked** p_baked_in_map = (ImFontBaked**)builder->BakedMap.GetVoidPtrRef(baked_id);
-    ImFontBaked* baked = *p_baked_in_map;
+    const bool deferred = ImFontAtlasDeferredLoadsEnabled(atlas); // Map cannot be modified (ImFontAtlasFlags_SharedAcrossThreads)
+    ImFontBaked** p_baked_in_map = deferred ? NULL : (ImFontBaked**)builder->BakedMap.GetVoidPtrRef(baked_id);
+    ImFontBaked* baked = deferred ? (ImFontBaked*)builder->BakedMap.GetVoidPtr(baked_id) : *p_baked_in_map;
     if (baked != NULL)
     {
         IM_ASSERT(baked->Size == font_size && baked->ContainerFont == font && baked->BakedId == baked_id);
         return baked;
     }
 
-    // If atlas is locked, find closest match
+    // If atlas is locked, or size will be created by next ImFontAtlasUpdateNewFrame(), find closest match
     // FIXME-OPT: This is not an optimal query.
-    if ((font->Flags & ImFontFlags_LockBakedSizes) || atlas->Locked)
+    if ((font->Flags & ImFontFlags_LockBakedSizes) || atlas->Locked || deferred)
     {
+        if (deferred && (font->Flags & ImFontFlags_LockBakedSizes) == 0)
+            ImFontAtlasDeferredLoadsAdd(atlas, font, font_size, font_rasterizer_density, -1);
         baked = ImFontAtlasBakedGetClosestMatch(atlas, font, font_size, font_rasterizer_density);
         if (baked != NULL)
             return baked;
@@ -5331,6 +7495,11 @@ ImFontBaked* ImFontAtlasBakedGetOrAdd(ImFontAtlas* atlas, ImFont* font, float fo
             IM_ASSERT(!atlas->Locked && "Cannot use dynamic font size with a locked ImFontAtlas!"); // Locked because rendering backend does not support ImGuiBackendFlags_RendererHasTextures!
             return NULL;
         }
+        if (deferred)
+        {
+            IM_ASSERT(0 && "Font has no baked size yet. With ImFontAtlasFlags_SharedAcrossThreads, fonts need to be added before ImFontAtlasUpdateNewFrame().");
+            return NULL;
+        }
     }
 
     // Create new
@@ -5406,7 +7575,7 @@ const char* ImFont::CalcWordWrapPosition(float size, const char* text, const cha
         }
 
         // Optimized inline version of 'float char_width = GetCharAdvance((ImWchar)c);'
-        float char_width = (c < (unsigned int)baked->IndexAdvanceX.Size) ? baked->IndexAdvanceX.Data[c] : -1.0f;
+        float char_width = ImFontBaked_IndexGetAdvanceX(baked, c);
         if (char_width < 0.0f)
             char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c);
 
@@ -5494,6 +7663,30 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
             }
         }
 
+        // Fast path for runs of printable ASCII characters: no UTF-8 decoding, no line break checks, advances read from first index page.
+        // (same operations in same order as the generic path below, so results are identical)
+        if ((unsigned int)((unsigned char)*s - 0x20) < 0x60 && baked->IndexPages.Size > 0)
+        {
+            const char* ascii_end = ImTextSkipPrintableAscii(s, word_wrap_enabled ? word_wrap_eol : text_end);
+            bool reached_max_width = false;
+            for (; s < ascii_end; s++)
+            {
+                float char_width = baked->IndexAdvanceX.Data[(unsigned char)*s];
+                if (char_width < 0.0f)
+                    char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, (unsigned char)*s);
+                char_width *= scale;
+                if (line_width + char_width >= max_width)
+                {
+                    reached_max_width = true;
+                    break;
+                }
+                line_width += char_width;
+            }
+            if (reached_max_width)
+                break;
+            continue;
+        }
+
         // Decode and advance source
         const char* prev_s = s;
         unsigned int c = (unsigned int)*s;
@@ -5516,7 +7709,7 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
         }
 
         // Optimized inline version of 'float char_width = GetCharAdvance((ImWchar)c);'
-        float char_width = (c < (unsigned int)baked->IndexAdvanceX.Size) ? baked->IndexAdvanceX.Data[c] : -1.0f;
+        float char_width = ImFontBaked_IndexGetAdvanceX(baked, c);
         if (char_width < 0.0f)
             char_width = BuildLoadGlyphGetAdvanceOrFallback(baked, c);
         char_width *= scale;
@@ -5577,8 +7770,305 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
         if (y1 >= y2)
             return;
     }
+    if (glyph->PageIdx != 0)
+        draw_list->PushTexture(ImFontAtlasPageGetTexture(ContainerAtlas, glyph->PageIdx)->GetTexRef());
     draw_list->PrimReserve(6, 4);
     draw_list->PrimRectUV(ImVec2(x1, y1), ImVec2(x2, y2), ImVec2(u1, v1), ImVec2(u2, v2), col);
+    if (glyph->PageIdx != 0)
+        draw_list->PopTexture();
+}
+
+// Bind texture page used by RenderText() pass (ImFontAtlasFlags_TexturePages). Page 0 restores texture bound by caller.
+static void ImFont_RenderTextSetTexturePage(ImDrawList* draw_list, ImFontAtlas* atlas, int page_idx, bool* page_pushed)
+{
+    if (page_idx == 0)
+    {
+        if (*page_pushed)
+            draw_list->PopTexture();
+        *page_pushed = false;
+        return;
+    }
+    ImTextureRef tex_ref = ImFontAtlasPageGetTexture(atlas, page_idx)->GetTexRef();
+    if (*page_pushed)
+        draw_list->_SetTexture(tex_ref);
+    else
+        draw_list->PushTexture(tex_ref);
+    *page_pushed = true;
+}
+
+// Return slot storing index of run with given key, or empty slot where it may be added.
+static int* ImFontAtlasTextRunsFindSlot(ImFontAtlasBuilder* builder, ImGuiID key)
+{
+    const ImU32 mask = (ImU32)builder->TextRunsTable.Size - 1;
+    for (ImU32 slot = key & mask; ; slot = (slot + 1) & mask)
+    {
+        int* p_run_idx = &builder->TextRunsTable.Data[slot];
+        if (*p_run_idx == -1 || builder->TextRuns.Data[*p_run_idx].Key == key)
+            return p_run_idx;
+    }
+}
+
+static void ImFontAtlasTextRunsRebuildTable(ImFontAtlasBuilder* builder, int table_size)
+{
+    table_size = ImMax(table_size, 64);
+    while (table_size < (builder->TextRuns.Size + 1) * 2)
+        table_size *= 2;
+    builder->TextRunsTable.resize(table_size);
+    memset(builder->TextRunsTable.Data, -1, (size_t)table_size * sizeof(int));
+    for (int run_n = 0; run_n < builder->TextRuns.Size; run_n++)
+        *ImFontAtlasTextRunsFindSlot(builder, builder->TextRuns[run_n].Key) = run_n;
+}
+
+// Discard text layouts unused for IM_FONTATLAS_TEXTRUN_MAX_AGE frames (or for one frame if they were only seen once). Called by NewFrame().
+// Then compact text and quads storage if mostly unused (rebuilt or discarded runs leave unused ranges).
+void ImFontAtlasTextRunsDiscardUnused(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    const bool enabled = (atlas->Flags & ImFontAtlasFlags_TextLayoutCache) != 0;
+    int dst_n = 0;
+    int used_text = 0, used_quads = 0;
+    for (int src_n = 0; src_n < builder->TextRuns.Size; src_n++)
+    {
+        ImFontTextRun* run = &builder->TextRuns[src_n];
+        const int max_age = (run->Generation == -1) ? 1 : IM_FONTATLAS_TEXTRUN_MAX_AGE;
+        if (!enabled || run->LastUsedFrame + max_age < builder->FrameCount)
+            continue;
+        if (run->Generation == -1)
+            run->TextLen = run->QuadsCount = 0; // Will be rebuilt
+        used_text += run->TextLen;
+        used_quads += run->QuadsCount;
+        if (dst_n != src_n)
+            builder->TextRuns[dst_n] = *run;
+        dst_n++;
+    }
+    if (dst_n != builder->TextRuns.Size)
+    {
+        builder->TextRuns.Size = dst_n;
+        ImFontAtlasTextRunsRebuildTable(builder, builder->TextRunsTable.Size);
+    }
+
+    if (builder->TextRunsQuads.Size - used_quads <= ImMax(used_quads, 1024) && builder->TextRunsText.Size - used_text <= ImMax(used_text, 1024 * 8))
+        return;
+    builder->TextRunsTextCompact.resize(0);
+    builder->TextRunsQuadsCompact.resize(0);
+    builder->TextRunsTextCompact.reserve(used_text);
+    builder->TextRunsQuadsCompact.reserve(used_quads);
+    for (ImFontTextRun& run : builder->TextRuns)
+    {
+        const int text_offset = builder->TextRunsTextCompact.Size;
+        const int quads_offset = builder->TextRunsQuadsCompact.Size;
+        builder->TextRunsTextCompact.resize(text_offset + run.TextLen);
+        builder->TextRunsQuadsCompact.resize(quads_offset + run.QuadsCount);
+        if (run.TextLen > 0)
+            memcpy(builder->TextRunsTextCompact.Data + text_offset, builder->TextRunsText.Data + run.TextOffset, (size_t)run.TextLen);
+        if (run.QuadsCount > 0)
+            memcpy(builder->TextRunsQuadsCompact.Data + quads_offset, builder->TextRunsQuads.Data + run.QuadsOffset, (size_t)run.QuadsCount * sizeof(ImFontTextRunQuad));
+        run.TextOffset = text_offset;
+        run.QuadsOffset = quads_offset;
+    }
+    builder->TextRunsText.swap(builder->TextRunsTextCompact);
+    builder->TextRunsQuads.swap(builder->TextRunsQuadsCompact);
+}
+
+// Rebuild runs using glyphs of a baked font on next use
+void ImFontAtlasTextRunsInvalidateBaked(ImFontAtlas* atlas, ImFontBaked* baked)
+{
+    for (ImFontTextRun& run : atlas->Builder->TextRuns)
+        if (run.BakedId == baked->BakedId)
+            run.Generation = -1;
+}
+
+void ImFontAtlasTextRunsClear(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    builder->TextRuns.clear();
+    builder->TextRunsTable.clear();
+    builder->TextRunsText.clear();
+    builder->TextRunsQuads.clear();
+    builder->TextRunsTextCompact.clear();
+    builder->TextRunsQuadsCompact.clear();
+}
+
+// Lay out text at (0,0) without clipping. Same layout as RenderText(). Quads are appended to builder->TextRunsQuads[].
+static void ImFont_BuildTextRun(ImFont* font, ImFontBaked* baked, float size, const char* text_begin, const char* text_end, float wrap_width, ImFontTextRun* run)
+{
+    ImVector<ImFontTextRunQuad>& quads = font->ContainerAtlas->Builder->TextRunsQuads;
+    const float line_height = size;
+    const float scale = size / baked->Size;
+    const bool word_wrap_enabled = (wrap_width > 0.0f);
+    run->QuadsOffset = quads.Size;
+    run->BoundsMin = ImVec2(FLT_MAX, FLT_MAX);
+    run->BoundsMax = ImVec2(-FLT_MAX, -FLT_MAX);
+
+    run->BakedId = baked->BakedId;
+
+    float x = 0.0f;
+    float y = 0.0f;
+    ImU32 pages_mask = 0;
+    const char* word_wrap_eol = NULL;
+    const char* s = text_begin;
+    while (s < text_end)
+    {
+        if (word_wrap_enabled)
+        {
+            if (!word_wrap_eol)
+                word_wrap_eol = font->CalcWordWrapPosition(size, s, text_end, wrap_width - x);
+            if (s >= word_wrap_eol)
+            {
+                x = 0.0f;
+                y += line_height;
+                word_wrap_eol = NULL;
+                s = CalcWordWrapNextLineStartA(s, text_end); // Wrapping skips upcoming blanks
+                continue;
+            }
+        }
+
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+            s += 1;
+        else
+            s += ImTextCharFromUtf8(&c, s, text_end);
+        if (c < 32)
+        {
+            if (c == '\n')
+            {
+                x = 0.0f;
+                y += line_height;
+                continue;
+            }
+            if (c == '\r')
+                continue;
+        }
+
+        const ImFontGlyph* glyph = baked->FindGlyph((ImWchar)c);
+        if (glyph->Visible)
+        {
+            ImFontTextRunQuad q;
+            q.P0 = ImVec2(x + glyph->X0 * scale, y + glyph->Y0 * scale);
+            q.P1 = ImVec2(x + glyph->X1 * scale, y + glyph->Y1 * scale);
+            q.Uv0 = ImVec2(glyph->U0, glyph->V0);
+            q.Uv1 = ImVec2(glyph->U1, glyph->V1);
+            q.PageIdx = (ImU8)glyph->PageIdx;
+            q.Colored = glyph->Colored != 0;
+            quads.push_back(q);
+            run->BoundsMin = ImMin(run->BoundsMin, ImVec2(q.P0.x, ImMin(q.P0.y, y)));
+            run->BoundsMax = ImMax(run->BoundsMax, ImVec2(q.P1.x, ImMax(q.P1.y, y)));
+            pages_mask |= 1u << q.PageIdx;
+        }
+        x += glyph->AdvanceX * scale;
+    }
+
+    run->QuadsCount = quads.Size - run->QuadsOffset;
+
+    // Sort quads in the order RenderText() renders pages: page of first quad, then other pages in ascending order.
+    // (sorted copy is appended after our quads then moved back in place)
+    if (ImCountSetBits(pages_mask) > 1)
+    {
+        const int sorted_offset = quads.Size;
+        quads.reserve(quads._grow_capacity(sorted_offset + run->QuadsCount)); // Don't reallocate while pushing our own elements
+        const int first_page_idx = quads[run->QuadsOffset].PageIdx;
+        for (int page_n = -1; page_n < IM_FONTATLAS_PAGES_MAX; page_n++)
+        {
+            const int page_idx = (page_n == -1) ? first_page_idx : page_n;
+            if ((page_n != -1 && page_idx == first_page_idx) || (pages_mask & (1u << page_idx)) == 0)
+                continue;
+            for (int quad_n = run->QuadsOffset; quad_n < sorted_offset; quad_n++)
+                if (quads.Data[quad_n].PageIdx == page_idx)
+                    quads.push_back(quads.Data[quad_n]);
+        }
+        memcpy(quads.Data + run->QuadsOffset, quads.Data + sorted_offset, (size_t)run->QuadsCount * sizeof(ImFontTextRunQuad));
+        quads.resize(sorted_offset);
+    }
+}
+
+// Render text using cached layout (ImFontAtlasFlags_TextLayoutCache). Return false when RenderText() needs to take the regular path.
+static bool ImFont_RenderTextFromCache(ImFont* font, ImFontBaked* baked, ImDrawList* draw_list, float size, float x, float y, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width)
+{
+    ImFontAtlas* atlas = font->ContainerAtlas;
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    const int text_len = (int)(text_end - text_begin);
+    ImU32 size_bits, wrap_width_bits;
+    const float wrap_width_key = (wrap_width > 0.0f) ? wrap_width : 0.0f;
+    memcpy(&size_bits, &size, 4);
+    memcpy(&wrap_width_bits, &wrap_width_key, 4);
+    const ImU64 hash = ImHashData64(text_begin, (size_t)text_len, ((ImU64)baked->BakedId << 32) ^ ((ImU64)size_bits << 16) ^ wrap_width_bits);
+    const ImGuiID key = (ImGuiID)(hash ^ (hash >> 32));
+
+    if ((builder->TextRuns.Size + 1) * 2 > builder->TextRunsTable.Size)
+        ImFontAtlasTextRunsRebuildTable(builder, builder->TextRunsTable.Size * 2);
+    int* p_run_idx = ImFontAtlasTextRunsFindSlot(builder, key);
+    if (*p_run_idx == -1)
+    {
+        // First use: only register
+        *p_run_idx = builder->TextRuns.Size;
+        builder->TextRuns.push_back(ImFontTextRun());
+        builder->TextRuns.back().Key = key;
+        builder->TextRuns.back().LastUsedFrame = builder->FrameCount;
+        return false;
+    }
+    ImFontTextRun* run = &builder->TextRuns[*p_run_idx];
+    run->LastUsedFrame = builder->FrameCount;
+    if (run->Generation != builder->TextRunsGeneration || run->BakedId != baked->BakedId || run->TextLen != text_len || memcmp(builder->TextRunsText.Data + run->TextOffset, text_begin, (size_t)text_len) != 0)
+    {
+        // Previous text and quads of this run are left unused in storage, until next compaction
+        const int generation = builder->TextRunsGeneration;
+        run->TextOffset = builder->TextRunsText.Size;
+        run->TextLen = text_len;
+        builder->TextRunsText.resize(run->TextOffset + text_len);
+        memcpy(builder->TextRunsText.Data + run->TextOffset, text_begin, (size_t)text_len);
+        ImFont_BuildTextRun(font, baked, size, text_begin, text_end, wrap_width, run);
+        run->Generation = (builder->TextRunsGeneration == generation) ? generation : -1; // Loading glyphs may have moved other glyphs
+        if (run->Generation == -1)
+            return false;
+    }
+    if (run->QuadsCount == 0)
+        return true;
+    if (x + run->BoundsMin.x < clip_rect.x || y + run->BoundsMin.y < clip_rect.y || x + run->BoundsMax.x > clip_rect.z || y + run->BoundsMax.y > clip_rect.w)
+        return false;
+
+    // Output one batch of quads per texture page
+    const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
+    const ImFontTextRunQuad* quads = builder->TextRunsQuads.Data + run->QuadsOffset;
+    const ImFontTextRunQuad* quads_end = quads + run->QuadsCount;
+    int page_idx = 0;
+    bool page_pushed = false;
+    while (quads < quads_end)
+    {
+        const ImFontTextRunQuad* batch_end = quads + 1;
+        while (batch_end < quads_end && batch_end->PageIdx == quads->PageIdx)
+            batch_end++;
+        if (quads->PageIdx != page_idx)
+        {
+            page_idx = quads->PageIdx;
+            ImFont_RenderTextSetTexturePage(draw_list, atlas, page_idx, &page_pushed);
+        }
+
+        const int quads_count = (int)(batch_end - quads);
+        draw_list->PrimReserve(quads_count * 6, quads_count * 4);
+        ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+        ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+        unsigned int vtx_index = draw_list->_VtxCurrentIdx;
+        for (; quads < batch_end; quads++)
+        {
+            const float x1 = x + quads->P0.x, y1 = y + quads->P0.y, x2 = x + quads->P1.x, y2 = y + quads->P1.y;
+            const ImU32 glyph_col = quads->Colored ? col_untinted : col;
+            IM_DRAWVERT_WRITE_POS(vtx_write[0], x1, y1); vtx_write[0].col = glyph_col; IM_DRAWVERT_WRITE_UV(vtx_write[0], quads->Uv0.x, quads->Uv0.y);
+            IM_DRAWVERT_WRITE_POS(vtx_write[1], x2, y1); vtx_write[1].col = glyph_col; IM_DRAWVERT_WRITE_UV(vtx_write[1], quads->Uv1.x, quads->Uv0.y);
+            IM_DRAWVERT_WRITE_POS(vtx_write[2], x2, y2); vtx_write[2].col = glyph_col; IM_DRAWVERT_WRITE_UV(vtx_write[2], quads->Uv1.x, quads->Uv1.y);
+            IM_DRAWVERT_WRITE_POS(vtx_write[3], x1, y2); vtx_write[3].col = glyph_col; IM_DRAWVERT_WRITE_UV(vtx_write[3], quads->Uv0.x, quads->Uv1.y);
+            idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
+            idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
+            vtx_write += 4;
+            vtx_index += 4;
+            idx_write += 6;
+        }
+        draw_list->_VtxWritePtr = vtx_write;
+        draw_list->_IdxWritePtr = idx_write;
+        draw_list->_VtxCurrentIdx = vtx_index;
+    }
+    if (page_pushed)
+        draw_list->PopTexture();
+    return true;
 }
 
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
@@ -5597,6 +8087,14 @@ begin:
     const float line_height = size;
     ImFontBaked* baked = GetFontBaked(size);
 
+    // Reuse layout of text drawn on previous calls (cache is written to, so not available to contexts on multiple threads)
+    // - Substitute fonts have no unique identifier and are used for password text which shouldn't be stored.
+    // - Unwrapped printable ASCII text doesn't gain from it: the regular path below is as fast as reusing quads.
+    if ((ContainerAtlas->Flags & (ImFontAtlasFlags_TextLayoutCache | ImFontAtlasFlags_SharedAcrossThreads)) == ImFontAtlasFlags_TextLayoutCache && FontId != 0 && text_end > text_begin && text_end - text_begin <= IM_FONTATLAS_TEXTRUN_MAX_LENGTH)
+        if (wrap_width > 0.0f || ImTextSkipPrintableAscii(text_begin, text_end) != text_end)
+            if (ImFont_RenderTextFromCache(this, baked, draw_list, size, x, y, col, clip_rect, text_begin, text_end, wrap_width))
+                return;
+
     const float scale = size / baked->Size;
     const float origin_x = x;
     const bool word_wrap_enabled = (wrap_width > 0.0f);
@@ -5642,15 +8140,29 @@ begin:
     // Reserve vertices for remaining worse case (over-reserving is useful and easily amortized)
     const int vtx_count_max = (int)(text_end - s) * 4;
     const int idx_count_max = (int)(text_end - s) * 6;
-    const int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
+    const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
+
+    // With ImFontAtlasFlags_TexturePages glyphs may be stored in different textures: we render one texture per pass.
+    // The first pass may switch texture until it outputs a vertex. Glyphs stored in other textures are rendered by subsequent passes.
+    const char* pass_s = s;
+    const float pass_y = y;
+    int page_idx = 0;               // 0: texture bound by caller
+    ImU32 pages_pending = 0;        // Pages to render in subsequent passes
+    ImU32 pages_done = 0;
+    bool page_pushed = false;
+    bool page_locked = false;
+
+pass:
+    int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
     draw_list->PrimReserve(idx_count_max, vtx_count_max);
     ImDrawVert*  vtx_write = draw_list->_VtxWritePtr;
     ImDrawIdx*   idx_write = draw_list->_IdxWritePtr;
     unsigned int vtx_index = draw_list->_VtxCurrentIdx;
-    const int cmd_count = draw_list->CmdBuffer.Size;
-
-    const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
+    int cmd_count = draw_list->CmdBuffer.Size;
     const char* word_wrap_eol = NULL;
+    s = pass_s;
+    x = origin_x;
+    y = pass_y;
 
     while (s < text_end)
     {
@@ -5707,6 +8219,26 @@ begin:
             float y2 = y + glyph->Y1 * scale;
             if (x1 <= clip_rect.z && x2 >= clip_rect.x)
             {
+                // Glyph is stored in another texture page
+                if (glyph->PageIdx != page_idx)
+                {
+                    if (page_locked || vtx_write != draw_list->_VtxWritePtr)
+                    {
+                        pages_pending |= (1u << glyph->PageIdx) & ~pages_done;
+                        x += char_width;
+                        continue;
+                    }
+                    draw_list->PrimUnreserve(idx_count_max, vtx_count_max);
+                    page_idx = glyph->PageIdx;
+                    ImFont_RenderTextSetTexturePage(draw_list, ContainerAtlas, page_idx, &page_pushed);
+                    idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
+                    draw_list->PrimReserve(idx_count_max, vtx_count_max);
+                    vtx_write = draw_list->_VtxWritePtr;
+                    idx_write = draw_list->_IdxWritePtr;
+                    vtx_index = draw_list->_VtxCurrentIdx;
+                    cmd_count = draw_list->CmdBuffer.Size;
+                }
+
                 // Render a character
                 float u1 = glyph->U0;
                 float v1 = glyph->V0;
@@ -5748,10 +8280,10 @@ begin:
 
                 // We are NOT calling PrimRectUV() here because non-inlined causes too much overhead in a debug builds. Inlined here:
                 {
-                    vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
-                    vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
-                    vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
-                    vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+                    IM_DRAWVERT_WRITE_POS(vtx_write[0], x1, y1); vtx_write[0].col = glyph_col; IM_DRAWVERT_WRITE_UV(vtx_write[0], u1, v1);
+                    IM_DRAWVERT_WRITE_POS(vtx_write[1], x2, y1); vtx_write[1].col = glyph_col; IM_DRAWVERT_WRITE_UV(vtx_write[1], u2, v1);
+                    IM_DRAWVERT_WRITE_POS(vtx_write[2], x2, y2); vtx_write[2].col = glyph_col; IM_DRAWVERT_WRITE_UV(vtx_write[2], u2, v2);
+                    IM_DRAWVERT_WRITE_POS(vtx_write[3], x1, y2); vtx_write[3].col = glyph_col; IM_DRAWVERT_WRITE_UV(vtx_write[3], u1, v2);
                     idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
                     idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
                     vtx_write += 4;
@@ -5770,6 +8302,9 @@ begin:
         draw_list->CmdBuffer.pop_back();
         draw_list->PrimUnreserve(idx_count_max, vtx_count_max);
         draw_list->AddDrawCmd();
+        IM_ASSERT(!page_locked);
+        if (page_pushed)
+            draw_list->PopTexture();
         //IMGUI_DEBUG_LOG("RenderText: cancel and retry to missing glyphs.\n"); // [DEBUG]
         //draw_list->AddRectFilled(pos, pos + ImVec2(10, 10), IM_COL32(255, 0, 0, 255)); // [DEBUG]
         goto begin;
@@ -5784,6 +8319,21 @@ begin:
     draw_list->_VtxWritePtr = vtx_write;
     draw_list->_IdxWritePtr = idx_write;
     draw_list->_VtxCurrentIdx = vtx_index;
+
+    // Render glyphs stored in other texture pages
+    if (pages_pending != 0)
+    {
+        pages_done |= 1u << page_idx;
+        page_idx = 0;
+        while ((pages_pending & (1u << page_idx)) == 0)
+            page_idx++;
+        pages_pending &= ~(1u << page_idx);
+        ImFont_RenderTextSetTexturePage(draw_list, ContainerAtlas, page_idx, &page_pushed);
+        page_locked = true;
+        goto pass;
+    }
+    if (page_pushed)
+        draw_list->PopTexture();
 }
 
 //-----------------------------------------------------------------------------
@@ -63,11 +63,24 @@ Index of this file:
 #if (defined __SSE__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))) && !defined(IMGUI_DISABLE_SSE)
 #define IMGUI_ENABLE_SSE
 #include <immintrin.h>
+#if (defined __SSE2__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define IMGUI_ENABLE_SSE2   // Integer intrinsics
+#endif
 #if (defined __AVX__ || defined __SSE4_2__)
 #define IMGUI_ENABLE_SSE4_2
 #include <nmmintrin.h>
 #endif
 #endif
+// MSVC: _InterlockedXXX() functions for ImAtomicXXX() helpers
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+// Enable NEON intrinsics if available (AArch64 only, as we use vdivq_f32/vsqrtq_f32)
+#if (defined __aarch64__ || defined _M_ARM64) && !defined(IMGUI_DISABLE_NEON)
+#define IMGUI_ENABLE_NEON
+#include <arm_neon.h>
+#endif
 // Emscripten has partial SSE 4.2 support where _mm_crc32_u32 is not available. See https://emscripten.org/docs/porting/simd.html#id11 and #8213
 #if defined(IMGUI_ENABLE_SSE4_2) && !defined(IMGUI_USE_LEGACY_CRC32_ADLER) && !defined(__EMSCRIPTEN__)
 #define IMGUI_ENABLE_SSE4_2_CRC
@@ -140,6 +153,7 @@ struct ImGuiTextIndex;              // Maintain a line index for a text buffer.
 
 // ImDrawList/ImFontAtlas
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
+struct ImDrawDamageTracker;         // Helper to compute ImDrawData::DamageRects[] by comparing with last frame
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
 struct ImFontAtlasBuilder;          // Internal storage for incrementally packing and building a ImFontAtlas
 struct ImFontAtlasPostProcessData;  // Data available to potential texture post-processing functions
@@ -162,12 +176,16 @@ struct ImGuiMenuColumns;            // Simple column measurement, currently used
 struct ImGuiMultiSelectState;       // Multi-selection persistent state (for focused selection).
 struct ImGuiMultiSelectTempData;    // Multi-selection temporary state (while traversing).
 struct ImGuiNavItemData;            // Result of a keyboard/gamepad directional navigation move query result
+struct ImGuiNavMoveCandidate;       // An item scored by a directional navigation move request
+struct ImGuiNavMoveCandidates;      // Candidates of last directional navigation move request, used to skip scoring items which cannot win
 struct ImGuiMetricsConfig;          // Storage for ShowMetricsWindow() and DebugNodeXXX() functions
 struct ImGuiNextWindowData;         // Storage for SetNextWindow** functions
 struct ImGuiNextItemData;           // Storage for SetNextItem** functions
 struct ImGuiOldColumnData;          // Storage data for a single column for legacy Columns() api
 struct ImGuiOldColumns;             // Storage data for a columns set for legacy Columns() api
 struct ImGuiPopupData;              // Storage for current popup stack
+struct ImGuiProfiler;               // Storage for the built-in frame profiler (IMGUI_ENABLE_PROFILER)
+struct ImGuiProfilerZone;           // A recorded timing zone of the built-in frame profiler
 struct ImGuiSettingsHandler;        // Storage for one type registered in the .ini file
 struct ImGuiStyleMod;               // Stacked style modifier, backup of modified data so we can restore it
 struct ImGuiStyleVarInfo;           // Style variable information (e.g. to access style variables from an enum)
@@ -220,8 +238,12 @@ typedef ImU16 ImGuiTableDrawChannelIdx;
 //-----------------------------------------------------------------------------
 
 #ifndef GImGui
+#ifdef IMGUI_ENABLE_THREAD_LOCAL_CONTEXT
+extern thread_local ImGuiContext* GImGui; // Current implicit context pointer, one per thread
+#else
 extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 #endif
+#endif
 
 //-----------------------------------------------------------------------------
 // [SECTION] Macros
@@ -249,6 +271,19 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 #define IMGUI_DEBUG_LOG_FONT(...)       do { ImGuiContext* g2 = GImGui; if (g2 && g2->DebugLogFlags & ImGuiDebugLogFlags_EventFont) IMGUI_DEBUG_LOG(__VA_ARGS__); } while (0) // Called from ImFontAtlas function which may operate without a context.
 #define IMGUI_DEBUG_LOG_INPUTROUTING(...) do{if (g.DebugLogFlags & ImGuiDebugLogFlags_EventInputRouting)IMGUI_DEBUG_LOG(__VA_ARGS__); } while (0)
 
+// Profiler zones (see IMGUI_ENABLE_PROFILER in imconfig.h, compiled out by default)
+// - IMGUI_PROFILER_SCOPE(): record a zone until the end of the current C++ scope. _NAME must be a literal or persistent string.
+// - IMGUI_PROFILER_ZONE_BEGIN()/IMGUI_PROFILER_ZONE_END(): record a zone explicitly. Zones must be strictly nested and END must pass the same name.
+#ifdef IMGUI_ENABLE_PROFILER
+#define IMGUI_PROFILER_SCOPE(_NAME)                 ImGuiProfilerScope IM_CONCAT(profiler_scope_, __LINE__)(_NAME)
+#define IMGUI_PROFILER_ZONE_BEGIN(_NAME, _WINDOW)   ImGui::ProfilerZoneBegin(_NAME, _WINDOW)
+#define IMGUI_PROFILER_ZONE_END(_NAME)              ImGui::ProfilerZoneEnd(_NAME)
+#else
+#define IMGUI_PROFILER_SCOPE(_NAME)                 ((void)0)
+#define IMGUI_PROFILER_ZONE_BEGIN(_NAME, _WINDOW)   ((void)0)
+#define IMGUI_PROFILER_ZONE_END(_NAME)              ((void)0)
+#endif
+
 // Static Asserts
 #define IM_STATIC_ASSERT(_COND)         static_assert(_COND, "")
 
@@ -278,6 +313,8 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 #define IM_ROUND(_VAL)                  ((float)(int)((_VAL) + 0.5f))                           //
 #define IM_STRINGIFY_HELPER(_X)         #_X
 #define IM_STRINGIFY(_X)                IM_STRINGIFY_HELPER(_X)                                 // Preprocessor idiom to stringify e.g. an integer.
+#define IM_CONCAT_HELPER(_A, _B)        _A##_B
+#define IM_CONCAT(_A, _B)               IM_CONCAT_HELPER(_A, _B)                                // Preprocessor idiom to paste tokens after expansion, e.g. to make unique identifiers with __LINE__.
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
 #define IM_FLOOR IM_TRUNC
 #endif
@@ -367,6 +404,7 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 // Helpers: Hashing
 IMGUI_API ImGuiID       ImHashData(const void* data, size_t data_size, ImGuiID seed = 0);
 IMGUI_API ImGuiID       ImHashStr(const char* data, size_t data_size = 0, ImGuiID seed = 0);
+IMGUI_API ImU64         ImHashData64(const void* data, size_t data_size, ImU64 seed = 0);   // Process 8 bytes at a time: faster than ImHashData() on text, not compatible with it.
 
 // Helpers: Sorting
 #ifndef ImQsort
@@ -382,6 +420,23 @@ inline bool             ImIsPowerOfTwo(ImU64 v)             { return v != 0 && (
 inline int              ImUpperPowerOfTwo(int v)            { v--; v |= v >> 1; v |= v >> 2; v |= v >> 4; v |= v >> 8; v |= v >> 16; v++; return v; }
 inline unsigned int     ImCountSetBits(unsigned int v)      { unsigned int count = 0; while (v > 0) { v = v & (v - 1); count++; } return count; }
 
+// Helpers: Atomics (used by thread-safe io.PostXXX() functions). Loads have acquire semantic, stores and exchanges have release semantic.
+#if defined(_MSC_VER) && !defined(__clang__)
+inline ImU32            ImAtomicLoad(volatile ImU32* p)                                 { return (ImU32)_InterlockedOr((volatile long*)p, 0); }
+inline void             ImAtomicStore(volatile ImU32* p, ImU32 v)                       { _InterlockedExchange((volatile long*)p, (long)v); }
+inline ImU32            ImAtomicAdd(volatile ImU32* p, ImU32 v)                         { return (ImU32)_InterlockedExchangeAdd((volatile long*)p, (long)v); }
+inline bool             ImAtomicCompareExchange(volatile ImU32* p, ImU32 expected, ImU32 desired) { return (ImU32)_InterlockedCompareExchange((volatile long*)p, (long)desired, (long)expected) == expected; }
+inline void*            ImAtomicLoadPtr(void* volatile* p)                              { return _InterlockedCompareExchangePointer(p, NULL, NULL); }
+inline bool             ImAtomicCompareExchangePtr(void* volatile* p, void* expected, void* desired) { return _InterlockedCompareExchangePointer(p, desired, expected) == expected; }
+#else
+inline ImU32            ImAtomicLoad(volatile ImU32* p)                                 { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+inline void             ImAtomicStore(volatile ImU32* p, ImU32 v)                       { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+inline ImU32            ImAtomicAdd(volatile ImU32* p, ImU32 v)                         { return __atomic_fetch_add(p, v, __ATOMIC_ACQ_REL); }
+inline bool             ImAtomicCompareExchange(volatile ImU32* p, ImU32 expected, ImU32 desired) { return __atomic_compare_exchange_n(p, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE); }
+inline void*            ImAtomicLoadPtr(void* volatile* p)                              { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+inline bool             ImAtomicCompareExchangePtr(void* volatile* p, void* expected, void* desired) { return __atomic_compare_exchange_n(p, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE); }
+#endif
+
 // Helpers: String
 #define ImStrlen strlen
 #define ImMemchr memchr
@@ -427,6 +482,7 @@ IMGUI_API int           ImTextCountUtf8BytesFromChar(const char* in_text, const
 IMGUI_API int           ImTextCountUtf8BytesFromStr(const ImWchar* in_text, const ImWchar* in_text_end);                        // return number of bytes to express string in UTF-8
 IMGUI_API const char*   ImTextFindPreviousUtf8Codepoint(const char* in_text_start, const char* in_text_curr);                   // return previous UTF-8 code-point.
 IMGUI_API int           ImTextCountLines(const char* in_text, const char* in_text_end);                                         // return number of lines taken by text. trailing carriage return doesn't count as an extra line.
+IMGUI_API const char*   ImTextSkipPrintableAscii(const char* in_text, const char* in_text_end);                                 // return first byte which isn't printable ASCII (0x20..0x7F), or in_text_end. Uses SIMD when available.
 
 // Helpers: File System
 #ifdef IMGUI_DISABLE_FILE_FUNCTIONS
@@ -831,6 +887,26 @@ IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStorag
 #endif
 #define IM_DRAWLIST_ARCFAST_SAMPLE_MAX                          IM_DRAWLIST_ARCFAST_TABLE_SIZE // Sample index _PathArcToFastEx() for 360 angle.
 
+// ImDrawList: Write ImDrawVert position/UV from float components, packing them when using IMGUI_USE_COMPACT_DRAWVERT.
+// Using macros rather than ImDrawVertSetPos()/ImDrawVertSetUV() so default layout doesn't involve function calls in debug/non-inlined builds.
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#define IM_DRAWVERT_WRITE_POS(_VTX,_X,_Y)                       ((_VTX).pos[0] = ImDrawVertPackPos(_X), (_VTX).pos[1] = ImDrawVertPackPos(_Y))
+#define IM_DRAWVERT_WRITE_UV(_VTX,_U,_V)                        ((_VTX).uv[0] = ImDrawVertPackUV(_U), (_VTX).uv[1] = ImDrawVertPackUV(_V))
+#else
+#define IM_DRAWVERT_WRITE_POS(_VTX,_X,_Y)                       ((_VTX).pos.x = (_X), (_VTX).pos.y = (_Y))
+#define IM_DRAWVERT_WRITE_UV(_VTX,_U,_V)                        ((_VTX).uv.x = (_U), (_VTX).uv.y = (_V))
+#endif
+
+// Glyph or baked font size requested by a context while its font atlas cannot be modified (ImFontAtlasFlags_SharedAcrossThreads)
+// Stored in ImDrawListSharedData::FontDeferredLoads[] of the requesting context, loaded by next ImFontAtlasUpdateNewFrame().
+struct ImFontAtlasDeferredLoad
+{
+    ImFont*         Font;
+    float           Size;
+    float           RasterizerDensity;
+    int             Codepoint;                  // -1: only create the baked font if missing, and mark it as used.
+};
+
 // Data shared between all ImDrawList instances
 // Conceptually this could have been called e.g. ImDrawListSharedContext
 // Typically one ImGui context would create and maintain one of this.
@@ -848,9 +924,10 @@ struct IMGUI_API ImDrawListSharedData
     float           InitialFringeScale;         // Initial scale to apply to AA fringe
     ImDrawListFlags InitialFlags;               // Initial flags at the beginning of the frame (it is possible to alter flags on a per-drawlist basis afterwards)
     ImVec4          ClipRectFullscreen;         // Value for PushClipRectFullscreen()
-    ImVector<ImVec2> TempBuffer;                // Temporary write buffer
     ImVector<ImDrawList*> DrawLists;            // All draw lists associated to this ImDrawListSharedData
     ImGuiContext*   Context;                    // [OPTIONAL] Link to Dear ImGui context. 99% of ImDrawList/ImFontAtlas can function without an ImGui context, but this facilitate handling one legacy edge case.
+    ImVector<ImFontAtlasDeferredLoad> FontDeferredLoads; // Glyphs and sizes requested from an atlas using ImFontAtlasFlags_SharedAcrossThreads, loaded by next ImFontAtlasUpdateNewFrame()
+    bool            DebugPolylineNoSimd;        // [Debug] Use scalar code for AddPolyline() tessellation even when SIMD is available. Output is identical (example_benchmark checks it).
 
     // Lookup tables
     ImVec2          ArcFastVtx[IM_DRAWLIST_ARCFAST_TABLE_SIZE]; // Sample points on the quarter of the circle.
@@ -870,6 +947,47 @@ struct ImDrawDataBuilder
     ImDrawDataBuilder()                     { memset(this, 0, sizeof(*this)); }
 };
 
+// Damage tracking (io.ConfigDamageTracking): compare ImDrawData contents with last frame to output ImDrawData::DamageRects[].
+// - Each draw list is converted to a stream of entries: one per triangle (also covering its ImDrawCmd clip rect and texture) and one per user callback.
+// - Streams of a same draw list are compared with last frame's (common prefix/suffix, then entry by entry if remaining sizes match).
+// - Changed entries output their bounding box, clipped by their ImDrawCmd::ClipRect and rounded to integers.
+#define IM_DRAWDATA_DAMAGE_RECTS_MAX        8       // Maximum number of output rectangles. Closest rectangles are merged together past that.
+
+struct ImDrawDamageEntry
+{
+    ImU32               Hash;
+    ImS16               Rect[4];            // x1, y1, x2, y2. Stored as integers to save memory.
+};
+
+struct ImDrawDamageList
+{
+    const ImDrawList*   DrawList;           // Only used as an identifier, may be dangling for last frame data.
+    int                 EntriesOffset;      // Index into ImDrawDamageFrame::Entries[]
+    int                 EntriesCount;
+};
+
+struct ImDrawDamageFrame
+{
+    ImVector<ImDrawDamageList>  Lists;
+    ImVector<ImDrawDamageEntry> Entries;
+    ImVec2                      DisplayPos;
+    ImVec2                      DisplaySize;
+    ImVec2                      FramebufferScale;
+};
+
+struct ImDrawDamageTracker
+{
+    ImDrawDamageFrame   Frames[2];          // Current and last frame, alternating
+    int                 FrameIdx;           // Index of current frame in Frames[]
+    bool                HasLastFrame;
+    ImVector<ImU32>     TempVtxHashes;
+    ImVector<bool>      TempListsMatched;
+
+    ImDrawDamageTracker()                   { FrameIdx = 0; HasLastFrame = false; }
+    IMGUI_API void      Clear();
+    IMGUI_API void      Update(ImDrawData* draw_data);
+};
+
 struct ImFontStackData
 {
     ImFont*     Font;
@@ -1396,6 +1514,16 @@ struct ImGuiWindowStackData
     float                   DisabledOverrideReenableAlphaBackup;
 };
 
+// Entry of the uniform grid used by FindHoveredWindowEx() to only test windows overlapping the mouse position.
+// The grid persists across frames: Begin() only updates a window's entries when its OuterRectClipped changed.
+// Windows which are not submitted anymore are left in the grid, FindHoveredWindowEx() still checks every condition on candidates.
+#define IM_WINDOWS_HOVER_GRID_CELLS     16      // Number of cells on each axis, covering the main viewport. Windows and positions outside of it are clamped to border cells.
+struct ImGuiWindowHoverGridEntry
+{
+    ImRect                  Rect;                       // == Window->HoverGridRect
+    ImGuiWindow*            Window;
+};
+
 struct ImGuiShrinkWidthItem
 {
     int         Index;
@@ -1421,6 +1549,17 @@ struct ImGuiDeactivatedItemData
     bool        IsAlive;
 };
 
+// Entry of CalcTextSize() memoization table
+// Layout code often measures the same text more than once per frame (e.g. item size, then alignment or ellipsis), and again on next frames.
+// Entries stay valid until glyphs advances change (font atlas calls ClearTextSizeMemo() when discarding baked fonts).
+#define IM_TEXTSIZEMEMO_MAX_COUNT       16384   // When the table holds that many entries, clear it.
+#define IM_TEXTSIZEMEMO_CLEAR_FRAMES    60      // Clear at most once every 60 frames. Until then, new text is measured but not memoized.
+struct ImGuiTextSizeMemoEntry
+{
+    ImU64       Key;            // Hash of displayed text + font + font size + density + wrap width. 0: empty slot.
+    ImVec2      Size;
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Popup support
 //-----------------------------------------------------------------------------
@@ -1525,6 +1664,29 @@ struct ImGuiInputEvent
     ImGuiInputEvent() { memset(this, 0, sizeof(*this)); }
 };
 
+// Input event posted from any thread by io.PostXXX() functions, passed to io.AddXXX() functions by NewFrame()
+struct ImGuiInputEventPosted
+{
+    ImU32                           Sequence;       // Slot state, see ImGuiInputEventsPostQueue
+    ImGuiInputEventType             Type;           // ImGuiInputEventType_None for io.PostMouseSourceEvent()
+    int                             Arg;            // Key, mouse button, character or mouse source
+    bool                            Down;           // Key or mouse button down, app focused
+    float                           X, Y;           // Mouse position, mouse wheel, or key analog value in X
+};
+
+// Bounded multiple-producers single-consumer lock-free queue storing events posted by io.PostXXX() functions.
+// - Each slot has a sequence number: producers reserve a position by incrementing EnqueuePos, write the event
+//   then publish it by setting its Sequence to position+1. NewFrame() reads published events in order.
+// - Allocated by first io.PostXXX() call and never resized, so a full queue drops events (and counts them).
+#define IMGUI_INPUT_EVENTS_POSTED_CAPACITY  4096    // Power of two
+struct ImGuiInputEventsPostQueue
+{
+    ImU32                           EnqueuePos;     // Atomic
+    ImU32                           DequeuePos;     // Only accessed by NewFrame()
+    ImU32                           DroppedCount;   // Atomic
+    ImGuiInputEventPosted           Slots[IMGUI_INPUT_EVENTS_POSTED_CAPACITY];
+};
+
 // Input function taking an 'ImGuiID owner_id' argument defaults to (ImGuiKeyOwner_Any == 0) aka don't test ownership, which matches legacy behavior.
 #define ImGuiKeyOwner_Any           ((ImGuiID)0)    // Accept key that have an owner, UNLESS a call to SetKeyOwner() explicitly used ImGuiInputFlags_LockThisFrame or ImGuiInputFlags_LockUntilRelease.
 #define ImGuiKeyOwner_NoOwner       ((ImGuiID)-1)   // Require key to have no owner.
@@ -1731,6 +1893,59 @@ struct ImGuiNavItemData
     void Clear()        { Window = NULL; ID = FocusScopeId = 0; ItemFlags = 0; SelectionUserData = -1; DistBox = DistCenter = DistAxial = FLT_MAX; }
 };
 
+// Distances between a candidate and g.NavScoringRect, as computed by NavScoreItem()
+struct ImGuiNavItemDistances
+{
+    float               DeltaBoxX, DeltaBoxY;       // Distance between boxes on each axis (0.0f when overlapping), DeltaBoxX is biased when both are non-zero
+    float               DeltaCenterX, DeltaCenterY; // Distance between centers on each axis (x2)
+    float               DeltaAxialX, DeltaAxialY;   // Either of the above, depending on which was used to determine Quadrant
+    float               DistBox;
+    float               DistCenter;
+    float               DistAxial;
+    ImGuiDir            Quadrant;                   // Quadrant of g.NavScoringRect the candidate lies in
+};
+
+// Storage for one item scored by a directional move request in g.NavWindow, see ImGuiNavMoveCandidates
+struct ImGuiNavMoveCandidate
+{
+    ImGuiID             ID;
+    ImGuiID             FocusScopeId;
+    ImGuiItemFlags      ItemFlags;
+    ImRect              Rect;           // Rectangle passed to NavScoreItem() (absolute coordinates, at the time of recording)
+    ImRect              NavRect;        // == g.LastItemData.NavRect
+    ImGuiSelectionUserData SelectionUserData;
+};
+
+// Spatial acceleration for directional navigation in windows with many items (e.g. 10k+ items lists without clipping).
+// - Items scored by a directional move request in g.NavWindow and g.NavLayer are recorded in submission order.
+// - On the next frame doing a directional move request, before scoring the first item, we find which of those candidates would win
+//   using a query on candidates sorted by Y, stopping when the vertical gap alone exceeds the best distance found. Scrolling is accounted for.
+// - While items are submitted with an unchanged ID, rectangle and data, we skip calling NavScoreItem() except for the predicted winner:
+//   all other candidates would lose against it. On the first mismatch (or if the frame ends without reaching the predicted winner),
+//   skipped candidates are scored from their recorded data, and the rest of the frame is scored and recorded normally.
+// - Not used for tabbing, PageUp/PageDown and menu layer requests.
+struct ImGuiNavMoveCandidates
+{
+    ImVector<ImGuiNavMoveCandidate> Items;          // Candidates of last move request, in submission order
+    ImVector<ImGuiNavMoveCandidate> ItemsNext;      // Candidates being recorded this frame
+    ImVector<int>       SortedByMinY;               // Indices into Items[] sorted by Rect.Min.y. Empty when Items[] are already sorted.
+    float               MaxHeight;                  // Max height of Items[], to bound search of items above scoring rectangle
+    ImGuiID             WindowID;                   // Window of Items[]
+    ImGuiNavLayer       ItemsNavLayer;              // Layer of Items[]
+    ImVec2              Offset;                     // Window's DC.CursorStartPos when Items[] were recorded
+    ImVec2              OffsetNext;
+    int                 State;                      // 0: none, 1: skipping (Items[] are being matched), 2: recording (into ItemsNext[]), 3: disabled for this frame
+    ImGuiWindow*        Window;                     // Window being processed this frame
+    ImGuiNavLayer       NavLayer;                   // Copy of g.NavLayer at the time of query
+    ImGuiID             NavId;                      // Copy of g.NavId at the time of query
+    ImVec2              Delta;                      // Offset to apply to Items[] rectangles this frame (scrolling)
+    int                 Cursor;                     // Number of Items[] matched this frame
+    int                 BestIndex;                  // Index of predicted best candidate in Items[], -1 if none
+    bool                BestReached;
+
+    ImGuiNavMoveCandidates() { memset(this, 0, sizeof(*this)); BestIndex = -1; }
+};
+
 // Storage for PushFocusScope(), g.FocusScopeStack[], g.NavFocusRoute[]
 struct ImGuiFocusScopeData
 {
@@ -1926,6 +2141,7 @@ struct ImGuiViewportP : public ImGuiViewport
     ImDrawList*         BgFgDrawLists[2];       // Convenience background (0) and foreground (1) draw lists. We use them to draw software mouser cursor when io.MouseDrawCursor is set and to draw most debug overlays.
     ImDrawData          DrawDataP;
     ImDrawDataBuilder   DrawDataBuilder;        // Temporary data while building final ImDrawData
+    ImDrawDamageTracker DamageTracker;          // Last frame data to compute DrawDataP.DamageRects[] when io.ConfigDamageTracking is enabled
 
     // Per-viewport work area
     // - Insets are >= 0.0f values, distance from viewport corners to work area.
@@ -2068,6 +2284,7 @@ struct ImGuiDebugAllocInfo
     int         TotalFreeCount;
     ImS16       LastEntriesIdx;             // Current index in buffer
     ImGuiDebugAllocEntry LastEntriesBuf[6]; // Track last 6 frames that had allocations
+    const void* OwnerThread;                // Thread calling NewFrame(), with IMGUI_DEBUG_ALLOC_OWNER_THREAD_ONLY. Allocations made on other threads (e.g. growing standalone ImDrawList on worker threads) are not recorded.
 
     ImGuiDebugAllocInfo() { memset(this, 0, sizeof(*this)); }
 };
@@ -2115,6 +2332,46 @@ struct ImGuiIDStackTool
     ImGuiIDStackTool()      { memset(this, 0, sizeof(*this)); CopyToClipboardLastTime = -FLT_MAX; }
 };
 
+#ifdef IMGUI_ENABLE_PROFILER
+
+// A zone recorded by the built-in profiler.
+// Zones of a frame are stored in the order they were opened, so descendants of a zone are contiguous: [idx + 1, SubtreeEnd)
+struct ImGuiProfilerZone
+{
+    const char*             Name;                       // Literal string for code zones, window name for window zones.
+    ImGuiWindow*            Window;                     // Window zones (time between Begin() and End(), including user code): window being submitted. NULL for other zones.
+    ImU64                   TimeBegin;                  // Nanoseconds, arbitrary origin.
+    ImU64                   TimeEnd;
+    int                     ParentIdx;                  // Index of parent zone in the same frame, -1 if none.
+    int                     SubtreeEnd;                 // Index past the last descendant zone.
+    int                     FrameCount;
+};
+
+// Storage for the built-in frame profiler (IMGUI_ENABLE_PROFILER)
+struct ImGuiProfiler
+{
+    bool                    Enabled;                    // Record zones. Changes are applied at the beginning of next frame so zones are always balanced.
+    bool                    EnabledThisFrame;
+    int                     CaptureFramesLeft;          // > 0: capture in progress, accumulating zones into CaptureZones[].
+    int                     CaptureFramesRequest;       // Number of frames to capture when using the 'Capture' button in Metrics.
+    ImVector<ImGuiProfilerZone> Zones;                  // Zones of the frame in progress.
+    ImVector<ImGuiProfilerZone> ZonesLastFrame;         // Zones of the last completed frame (displayed in Metrics).
+    ImVector<ImGuiProfilerZone> CaptureZones;           // Zones accumulated over multiple frames for export.
+    ImVector<int>           ZonesStack;                 // Indices of currently open zones.
+
+    ImGuiProfiler()         { Enabled = EnabledThisFrame = false; CaptureFramesLeft = 0; CaptureFramesRequest = 60; }
+};
+
+// Helper to record a zone until end of scope. Use with IMGUI_PROFILER_SCOPE() macro.
+struct ImGuiProfilerScope
+{
+    const char*             Name;
+    ImGuiProfilerScope(const char* name);
+    ~ImGuiProfilerScope();
+};
+
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
 //-----------------------------------------------------------------------------
 // [SECTION] Generic context hooks
 //-----------------------------------------------------------------------------
@@ -2143,6 +2400,7 @@ struct ImGuiContext
     ImGuiIO                 IO;
     ImGuiPlatformIO         PlatformIO;
     ImGuiStyle              Style;
+    ImGuiID                 StyleHash;                          // Hash of Style contents, updated by NewFrame(). Used by ImGuiWindowFlags_Retained windows (along with current ColorStack/StyleVarStack values).
     ImVector<ImFontAtlas*>  FontAtlases;                        // List of font atlases used by the context (generally only contains g.IO.Fonts aka the main font atlas)
     ImFont*                 Font;                               // Currently bound font. (== FontStack.back().Font)
     ImFontBaked*            FontBaked;                          // Currently bound font at currently bound size. (== Font->GetFontBaked(FontSize))
@@ -2169,6 +2427,7 @@ struct ImGuiContext
     ImVector<ImGuiInputEvent> InputEventsTrail;                 // Past input events processed in NewFrame(). This is to allow domain-specific application to access e.g mouse/pen trail.
     ImGuiMouseSource        InputEventsNextMouseSource;
     ImU32                   InputEventsNextEventId;
+    ImGuiInputEventsPostQueue* InputEventsPostQueue;            // Events posted from any thread by io.PostXXX() functions. Allocated by first call, atomic pointer.
 
     // Windows state
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
@@ -2178,6 +2437,12 @@ struct ImGuiContext
     ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
     int                     WindowsActiveCount;                 // Number of unique windows submitted by frame
     float                   WindowsBorderHoverPadding;          // Padding around resizable windows for which hovering on counts as hovering the window == ImMax(style.TouchExtraPadding, style.WindowBorderHoverPadding). This isn't so multi-dpi friendly.
+    ImVector<ImGuiWindowHoverGridEntry> WindowsHoverGridCells[IM_WINDOWS_HOVER_GRID_CELLS * IM_WINDOWS_HOVER_GRID_CELLS]; // Windows bucketed by position, see ImGuiWindowHoverGridEntry. Used by FindHoveredWindowEx().
+    ImRect                  WindowsHoverGridRect;               // Area covered by the grid (main viewport)
+    ImVec2                  WindowsHoverGridPadding;            // Hit padding added to windows rectangles when inserted
+    int                     WindowsHoverGridGeneration;         // Incremented when clearing the grid, so windows know they need to be added again.
+    int                     WindowsHoverGridValidFrame;         // First frame where every window submitted in previous frame is guaranteed to be in the grid.
+    bool                    WindowsHoverGridReady;              // Set by NewFrame() while looking for hovered window, when grid is valid and ImGuiWindow::DisplayOrder are up to date.
     ImGuiID                 DebugBreakInWindow;                 // Set to break in Begin() call.
     ImGuiWindow*            CurrentWindow;                      // Window being drawn into
     ImGuiWindow*            HoveredWindow;                      // Window the mouse is hovering. Will typically catch mouse inputs.
@@ -2311,6 +2576,7 @@ struct ImGuiContext
     ImGuiNavItemData        NavMoveResultLocalVisible;          // Best move request candidate within NavWindow that are mostly visible (when using ImGuiNavMoveFlags_AlsoScoreVisibleSet flag)
     ImGuiNavItemData        NavMoveResultOther;                 // Best move request candidate within NavWindow's flattened hierarchy (when using ImGuiWindowFlags_NavFlattened flag)
     ImGuiNavItemData        NavTabbingResultFirst;              // First tabbing request candidate within NavWindow and flattened hierarchy
+    ImGuiNavMoveCandidates  NavMoveCandidates;                  // Candidates of last directional move request in NavWindow, used to skip scoring most items.
 
     // Navigation: record of last move request
     ImGuiID                 NavJustMovedFromFocusScopeId;       // Just navigated from this focus scope id (result of a successfully MoveRequest).
@@ -2400,8 +2666,8 @@ struct ImGuiContext
     // Widget state
     ImGuiInputTextState     InputTextState;
     ImGuiInputTextDeactivatedState InputTextDeactivatedState;
-    ImFontBaked             InputTextPasswordFontBackupBaked;
-    ImFontFlags             InputTextPasswordFontBackupFlags;
+    ImFont                  InputTextPasswordFont;              // Per-context substitute font drawing '*' glyphs of current font (see PushPasswordFont())
+    ImFontBaked             InputTextPasswordFontBaked;
     ImGuiID                 TempInputId;                        // Temporary text input when CTRL+clicking on a slider, etc.
     ImGuiDataTypeStorage    DataTypeZeroValue;                  // 0 for all data types
     int                     BeginMenuDepth;
@@ -2497,6 +2763,9 @@ struct ImGuiContext
     ImGuiMetricsConfig      DebugMetricsConfig;
     ImGuiIDStackTool        DebugIDStackTool;
     ImGuiDebugAllocInfo     DebugAllocInfo;
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiProfiler           Profiler;
+#endif
 #if defined(IMGUI_DEBUG_HIGHLIGHT_ALL_ID_CONFLICTS) && !defined(IMGUI_DISABLE_DEBUG_TOOLS)
     ImGuiStorage            DebugDrawIdConflictsAliveCount;
     ImGuiStorage            DebugDrawIdConflictsHighlightSet;
@@ -2512,6 +2781,19 @@ struct ImGuiContext
     int                     WantTextInputNextFrame;             // Copied in EndFrame() from g.PlatformImeData.WantTextInput. Needs to be set for some backends (SDL3) to emit character inputs.
     ImVector<char>          TempBuffer;                         // Temporary text buffer
     char                    TempKeychordName[64];
+    float                   WantRedrawDelay;                    // Smallest delay passed to RequestRedraw() during the current frame, FLT_MAX if none. Output to io.WantRedraw/io.WantRedrawTimeout in EndFrame().
+    const char*             WantRedrawDebugReason;              // Reason for the smallest delay (for Metrics/Debugger).
+    const char*             WantRedrawDebugReasonLastFrame;     // Copy of WantRedrawDebugReason as output by last EndFrame().
+    int                     WantRedrawFramesAfterInputs;        // Number of frames to keep running after processing inputs, so that layout changes they cause can settle.
+
+    // Text size memoization (CalcTextSize)
+    ImVector<ImGuiTextSizeMemoEntry> TextSizeMemo;              // Open addressing hash table. Size is a power of two larger than twice TextSizeMemoCount.
+    int                     TextSizeMemoCount;
+    int                     TextSizeMemoLastClearFrame;
+    int                     TextSizeMemoHits;                   // Stats for current frame
+    int                     TextSizeMemoMisses;
+    int                     TextSizeMemoHitsLastFrame;          // Stats for last frame, displayed in Metrics
+    int                     TextSizeMemoMissesLastFrame;
 
     ImGuiContext(ImFontAtlas* shared_font_atlas);
 };
@@ -2616,7 +2898,7 @@ struct IMGUI_API ImGuiWindow
     bool                    Collapsed;                          // Set when collapsing window to become only title-bar
     bool                    WantCollapseToggle;
     bool                    SkipItems;                          // Set when items can safely be all clipped (e.g. window not visible or collapsed)
-    bool                    SkipRefresh;                        // [EXPERIMENTAL] Reuse previous frame drawn contents, Begin() returns false.
+    bool                    SkipRefresh;                        // Reuse previous frame drawn contents, Begin() returns false. (ImGuiWindowFlags_Retained or [EXPERIMENTAL] SetNextWindowRefreshPolicy())
     bool                    Appearing;                          // Set during the frame where the window is appearing (or re-appearing)
     bool                    Hidden;                             // Do not display (== HiddenFrames*** > 0)
     bool                    IsFallbackWindow;                   // Set on the "Debug##Default" window.
@@ -2629,6 +2911,8 @@ struct IMGUI_API ImGuiWindow
     short                   BeginOrderWithinParent;             // Begin() order within immediate parent window, if we are a child window. Otherwise 0.
     short                   BeginOrderWithinContext;            // Begin() order within entire imgui context. This is mostly used for debugging submission order related issues.
     short                   FocusOrder;                         // Order within WindowsFocusOrder[], altered when windows are focused.
+    int                     DisplayOrder;                       // Order within g.Windows[] as of last NewFrame(). Used by FindHoveredWindowEx(), not updated when windows are brought to front.
+    int                     HoverGridGeneration;                // Value of g.WindowsHoverGridGeneration when added to hover grid.
     ImS8                    AutoFitFramesX, AutoFitFramesY;
     bool                    AutoFitOnlyGrows;
     ImGuiDir                AutoPosLastDirection;
@@ -2636,6 +2920,7 @@ struct IMGUI_API ImGuiWindow
     ImS8                    HiddenFramesCannotSkipItems;        // Hide the window for N frames while allowing items to be submitted so we can measure their size
     ImS8                    HiddenFramesForRenderOnly;          // Hide the window until frame N at Render() time only
     ImS8                    DisableInputsFrames;                // Disable window interactions for N frames
+    ImS8                    RefreshFramesRequested;             // ImGuiWindowFlags_Retained: refresh contents for N frames (e.g. after SetWindowDirty())
     ImGuiCond               SetWindowPosAllowFlags : 8;         // store acceptable condition flags for SetNextWindowPos() use.
     ImGuiCond               SetWindowSizeAllowFlags : 8;        // store acceptable condition flags for SetNextWindowSize() use.
     ImGuiCond               SetWindowCollapsedAllowFlags : 8;   // store acceptable condition flags for SetNextWindowCollapsed() use.
@@ -2648,6 +2933,7 @@ struct IMGUI_API ImGuiWindow
     // The best way to understand what those rectangles are is to use the 'Metrics->Tools->Show Windows Rectangles' viewer.
     // The main 'OuterRect', omitted as a field, is window->Rect().
     ImRect                  OuterRectClipped;                   // == Window->Rect() just after setup in Begin(). == window->Rect() for root window.
+    ImRect                  HoverGridRect;                      // OuterRectClipped + hit padding, as last added to g.WindowsHoverGridCells[]
     ImRect                  InnerRect;                          // Inner rectangle (omit title bar, menu bar, scroll bar)
     ImRect                  InnerClipRect;                      // == InnerRect shrunk by WindowPadding*0.5f on each side, clipped within viewport or parent clip rect.
     ImRect                  WorkRect;                           // Initially covers the whole scrolling region. Reduced by containers e.g columns/tables when active. Shrunk by WindowPadding*1.0f on each side. This is meant to replace ContentRegionRect over time (from 1.71+ onward).
@@ -2657,6 +2943,7 @@ struct IMGUI_API ImGuiWindow
     ImVec2ih                HitTestHoleSize;                    // Define an optional rectangular hole where mouse will pass-through the window.
     ImVec2ih                HitTestHoleOffset;
 
+    ImGuiID                 RetainedStateHash;                  // ImGuiWindowFlags_Retained: hash of state used to build contents, at the time of last refresh.
     int                     LastFrameActive;                    // Last frame number the window was Active.
     float                   LastTimeActive;                     // Last timestamp the window was Active (using float as we don't need high precision there)
     float                   ItemWidthDefault;
@@ -3107,6 +3394,7 @@ namespace ImGui
     IMGUI_API void          SetWindowSize(ImGuiWindow* window, const ImVec2& size, ImGuiCond cond = 0);
     IMGUI_API void          SetWindowCollapsed(ImGuiWindow* window, bool collapsed, ImGuiCond cond = 0);
     IMGUI_API void          SetWindowHitTestHole(ImGuiWindow* window, const ImVec2& pos, const ImVec2& size);
+    IMGUI_API void          SetWindowDirty(ImGuiWindow* window);
     IMGUI_API void          SetWindowHiddenAndSkipItemsForCurrentFrame(ImGuiWindow* window);
     inline void             SetWindowParentWindowForFocusRoute(ImGuiWindow* window, ImGuiWindow* parent_window) { window->ParentWindowForFocusRoute = parent_window; }
     inline ImRect           WindowRectAbsToRel(ImGuiWindow* window, const ImRect& r) { ImVec2 off = window->DC.CursorStartPos; return ImRect(r.Min.x - off.x, r.Min.y - off.y, r.Max.x - off.x, r.Max.y - off.y); }
@@ -3126,6 +3414,7 @@ namespace ImGui
 
     // Windows: Idle, Refresh Policies [EXPERIMENTAL]
     IMGUI_API void          SetNextWindowRefreshPolicy(ImGuiWindowRefreshFlags flags);
+    IMGUI_API void          RequestRedrawEx(float delay, const char* debug_reason); // Request a new frame within 'delay' seconds, see io.WantRedraw.
 
     // Fonts, drawing
     IMGUI_API void          RegisterUserTexture(ImTextureData* tex); // Register external texture. EXPERIMENTAL: DO NOT USE YET.
@@ -3137,6 +3426,7 @@ namespace ImGui
     IMGUI_API void          SetFontRasterizerDensity(float rasterizer_density);
     inline float            GetFontRasterizerDensity() { return GImGui->FontRasterizerDensity; }
     inline float            GetRoundedFontSize(float size) { return IM_ROUND(size); }
+    IMGUI_API void          ClearTextSizeMemo(ImGuiContext* ctx);
     IMGUI_API ImFont*       GetDefaultFont();
     IMGUI_API void          PushPasswordFont();
     IMGUI_API void          PopPasswordFont();
@@ -3150,6 +3440,7 @@ namespace ImGui
     IMGUI_API void          Shutdown();    // Since 1.60 this is a _private_ function. You can call DestroyContext() to destroy the context created by CreateContext().
 
     // NewFrame
+    IMGUI_API void          UpdateInputEventsPosted();
     IMGUI_API void          UpdateInputEvents(bool trickle_fast_inputs);
     IMGUI_API void          UpdateHoveredWindowAndCaptureFlags(const ImVec2& mouse_pos);
     IMGUI_API void          FindHoveredWindowEx(const ImVec2& pos, bool find_first_and_in_any_viewport, ImGuiWindow** out_hovered_window, ImGuiWindow** out_hovered_window_under_moving_window);
@@ -3670,6 +3961,18 @@ namespace ImGui
     IMGUI_API void          DebugRenderKeyboardPreview(ImDrawList* draw_list);
     IMGUI_API void          DebugRenderViewportThumbnail(ImDrawList* draw_list, ImGuiViewportP* viewport, const ImRect& bb);
 
+    // Profiler (see IMGUI_ENABLE_PROFILER and IMGUI_PROFILER_XXX macros)
+#ifdef IMGUI_ENABLE_PROFILER
+    IMGUI_API ImU64         ProfilerGetTime();                                      // Nanoseconds, arbitrary origin.
+    IMGUI_API void          ProfilerNewFrame();
+    IMGUI_API void          ProfilerZoneBegin(const char* name, ImGuiWindow* window = NULL);
+    IMGUI_API void          ProfilerZoneEnd(const char* name);
+    IMGUI_API void          ProfilerStartCapture(int frames_count);
+    IMGUI_API void          ProfilerExportChromeTrace(ImGuiTextBuffer* buf);        // Export capture (or last frame if there is no capture) to Chrome trace JSON format.
+    IMGUI_API bool          ProfilerExportChromeTraceToFile(const char* filename);
+    IMGUI_API void          DebugNodeProfiler(ImGuiProfiler* profiler);
+#endif
+
     // Obsolete functions
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     //inline void   SetItemUsingMouseWheel()                                            { SetItemKeyOwner(ImGuiKey_MouseWheelY); }      // Changed in 1.89
@@ -3691,6 +3994,15 @@ namespace ImGui
 // [SECTION] ImFontLoader
 //-----------------------------------------------------------------------------
 
+// Glyph bitmap output for ImFontLoader::FontBakedRasterizeGlyph()
+struct ImFontAtlasGlyphBitmap
+{
+    int                 Width;
+    int                 Height;
+    ImTextureFormat     Format;             // ImTextureFormat_Alpha8 or ImTextureFormat_RGBA32
+    unsigned char*      Pixels;             // NULL when querying. Otherwise cleared storage for Width * Height pixels, with no padding.
+};
+
 // Hooks and storage for a given font backend.
 // This structure is likely to evolve as we add support for incremental atlas updates.
 // Conceptually this could be public, but API is still going to be evolve.
@@ -3706,6 +4018,17 @@ struct ImFontLoader
     void            (*FontBakedDestroy)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src);
     bool            (*FontBakedLoadGlyph)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x);
 
+    // (Optional) Same as FontBakedLoadGlyph() but without packing into the atlas, used by ImFontBaked::PreloadGlyphs() to rasterize multiple glyphs at once.
+    // - First call has out_bitmap->Pixels == NULL: fill 'out_glyph' (X0/Y0/X1/Y1 relative to pen position, AdvanceX, Visible, Colored) and out_bitmap's Width/Height/Format. Return false if glyph is missing.
+    // - Second call has out_bitmap->Pixels set and must render pixels without modifying 'out_glyph'.
+    // - When FontBakedRasterizeGlyphThreadSafe is set, second call may happen later from any thread, concurrently with other glyphs of the same font. Otherwise it always immediately follows the first call.
+    bool            (*FontBakedRasterizeGlyph)(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, ImFontAtlasGlyphBitmap* out_bitmap);
+    bool            FontBakedRasterizeGlyphThreadSafe;
+
+    // (Optional) Set if loader rasterizes signed distance fields for baked fonts with ImFontBaked::UseSDF set (ImFontFlags_SDF).
+    // Bitmaps are then padded by IM_FONTGLYPH_SDF_PADDING pixels on each side and encoded as described below. Oversampling is disabled.
+    bool            FontBakedSupportsSDF;
+
     // Size of backend data, Per Baked * Per Source. Buffers are managed by core to avoid excessive allocations.
     // FIXME: At this point the two other types of buffers may be managed by core to be consistent?
     size_t          FontBakedSrcLoaderDataSize;
@@ -3727,6 +4050,13 @@ typedef ImFontLoader ImFontBuilderIO; // [renamed/changed in 1.92] The types are
 #define IMGUI_FONT_SIZE_MAX                                     (512.0f)
 #define IMGUI_FONT_SIZE_THRESHOLD_FOR_LOADADVANCEXONLYMODE      (128.0f)
 
+// Signed distance field glyphs (ImFontFlags_SDF): 8-bit distance to the outline, IM_FONTGLYPH_SDF_ONEDGE_VALUE on the outline and increasing inside,
+// saturating at IM_FONTGLYPH_SDF_PADDING pixels from it. Same encoding as stbtt_GetGlyphSDF() and FreeType's FT_RENDER_MODE_SDF with default 'spread'.
+#define IM_FONTGLYPH_SDF_PADDING                                8
+#define IM_FONTGLYPH_SDF_ONEDGE_VALUE                           128
+#define IM_FONTGLYPH_SDF_PIXEL_DIST_SCALE                       (128.0f / IM_FONTGLYPH_SDF_PADDING)
+#define IM_FONTGLYPH_SDF_DEFAULT_SIZE                           (48.0f)
+
 // Helpers: ImTextureRef ==/!= operators provided as convenience
 // (note that _TexID and _TexData are never set simultaneously)
 inline bool operator==(const ImTextureRef& lhs, const ImTextureRef& rhs)    { return lhs._TexID == rhs._TexID && lhs._TexData == rhs._TexData; }
@@ -3750,6 +4080,7 @@ struct ImFontAtlasRectEntry
     int                 TargetIndex : 20;   // When Used: ImFontAtlasRectId -> into Rects[]. When unused: index to next unused RectsIndex[] slot to consume free-list.
     int                 Generation : 10;    // Increased each time the entry is reused for a new rectangle.
     unsigned int        IsUsed : 1;
+    unsigned int        PageIdx : 5;        // Texture page storing the rectangle (ImFontAtlasFlags_TexturePages). 0: ImFontAtlas->TexData.
 };
 
 // Data available to potential texture post-processing functions
@@ -3779,6 +4110,102 @@ typedef stbrp_node stbrp_node_im;
 #endif
 struct stbrp_context_opaque { char data[80]; };
 
+// Additional texture storing glyphs (ImFontAtlasFlags_TexturePages). Signed distance field glyphs (ImFontFlags_SDF) are always stored in their own pages.
+// Pages are never resized nor repacked: they are destroyed when all their rectangles have been discarded.
+// Glyphs from sparsely used pages are moved to the next new page, so that a few long-lived glyphs don't keep them alive.
+#define IM_FONTATLAS_PAGES_MAX      32      // Limited by ImFontGlyph::PageIdx. Page 0 is the main texture (ImFontAtlas::TexData).
+struct ImFontAtlasPage
+{
+    ImTextureData*              Tex;
+    stbrp_context_opaque        PackContext;            // Actually 'stbrp_context' but we don't want to define this in the header file.
+    ImVector<stbrp_node_im>     PackNodes;
+    int                         RectsCount;             // Number of rectangles currently stored in this page.
+    int                         RectsSurface;           // Number of pixels used by those rectangles (including padding).
+};
+
+// Glyph being loaded by ImFontBaked::PreloadGlyphs() or asynchronously (ImFontAtlasFlags_AsyncGlyphLoading)
+struct ImFontAtlasGlyphJob
+{
+    ImFontBaked*            Baked;
+    ImFontConfig*           Src;
+    void*                   LoaderData;
+    ImFontGlyph             Glyph;
+    ImGuiID                 BakedId;            // Async: ImFontBaked pointers don't cross frames, so we resolve Baked/Src/LoaderData when starting.
+    int                     GlyphIdx;           // Async: index of placeholder glyph in Baked->Glyphs[]. -1 for PreloadGlyphs().
+    ImWchar                 Codepoint;          // Codepoint after remapping (Glyph.Codepoint is the requested one)
+    bool                    Rasterized;
+    int                     PixelsOffset;       // Offset of our pixels in a shared buffer
+    ImFontAtlasGlyphBitmap  Bitmap;
+
+    ImFontAtlasGlyphJob()   { memset((void*)this, 0, sizeof(*this)); Glyph.PackId = ImFontAtlasRectId_Invalid; GlyphIdx = -1; }
+};
+
+// Text layout cache (ImFontAtlasFlags_TextLayoutCache)
+// - ImFont::RenderText() stores glyph quads of text drawn on multiple calls, keyed on text contents, baked font, size and wrap width.
+//   Cached quads are relative to text position: reusing them only needs a translation and a color.
+// - Text seen for the first time only registers an entry, so text changing every frame doesn't fill the cache.
+// - Runs are only used for text which is entirely inside the clipping rectangle. Other text takes the regular path.
+// - Runs get rebuilt when glyphs were moved in the atlas (TextRunsGeneration) or their baked font got discarded, and are discarded when unused.
+// - Text and quads of all runs are stored in shared buffers: building a run appends to them, and NewFrame() compacts them when mostly unused.
+// - Unwrapped printable ASCII text is not cached: the regular path is already as fast as reusing quads.
+#define IM_FONTATLAS_TEXTRUN_MAX_LENGTH 256     // Longer text is not cached
+#define IM_FONTATLAS_TEXTRUN_MAX_AGE    60      // Discard runs unused for this many frames
+struct ImFontTextRunQuad
+{
+    ImVec2                  P0, P1;             // Relative to text position (after truncation)
+    ImVec2                  Uv0, Uv1;
+    ImU8                    PageIdx;            // Texture page (ImFontAtlasFlags_TexturePages). Quads are sorted in rendering order of their pages.
+    bool                    Colored;
+};
+struct ImFontTextRun
+{
+    ImGuiID                 Key;
+    ImGuiID                 BakedId;
+    int                     LastUsedFrame;
+    int                     Generation;         // ImFontAtlasBuilder::TextRunsGeneration when built. -1: not built (seen once).
+    ImVec2                  BoundsMin, BoundsMax; // Bounding box of quads and of their line tops, relative to text position
+    int                     TextOffset;         // Copy of text in ImFontAtlasBuilder::TextRunsText[], to detect hash collisions
+    int                     TextLen;
+    int                     QuadsOffset;        // Quads in ImFontAtlasBuilder::TextRunsQuads[]
+    int                     QuadsCount;
+
+    ImFontTextRun()         { memset((void*)this, 0, sizeof(*this)); Generation = -1; }
+};
+
+// Persistent glyph cache (ImFontAtlas::SaveGlyphCacheToMemory(), ImFontAtlas::LoadGlyphCacheFromMemory())
+// - Layout: ImFontGlyphCacheHeader, ImFontGlyphCacheBaked[BakedCount], ImFontGlyphCacheGlyph[] (sorted by codepoint for each baked font), pixels.
+// - Offsets are in bytes from the start of data. Values are stored in native endianness.
+#define IM_FONTGLYPHCACHE_VERSION   1
+struct ImFontGlyphCacheHeader
+{
+    char                    Magic[4];           // "IMGC"
+    ImU32                   Version;            // IM_FONTGLYPHCACHE_VERSION
+    ImU32                   ImGuiVersion;       // IMGUI_VERSION_NUM (glyph output may change between versions)
+    ImU32                   BakedCount;
+};
+
+struct ImFontGlyphCacheBaked
+{
+    ImGuiID                 Key;                // See ImFontAtlasGlyphCacheCalcBakedKey()
+    float                   Size;
+    float                   RasterizerDensity;
+    ImU32                   GlyphsCount;
+    ImU32                   GlyphsOffset;
+};
+
+struct ImFontGlyphCacheGlyph
+{
+    ImU32                   Codepoint;
+    ImU16                   Width, Height;      // Size of pixel data, 0 if none
+    ImU8                    SourceIdx;
+    ImU8                    Colored;
+    ImU8                    Visible;
+    ImU8                    Format;             // ImTextureFormat of pixel data
+    float                   AdvanceX;
+    float                   X0, Y0, X1, Y1;
+    ImU32                   PixelsOffset;
+};
+
 // Internal storage for incrementally packing and building a ImFontAtlas
 struct ImFontAtlasBuilder
 {
@@ -3802,11 +4229,41 @@ struct ImFontAtlasBuilder
     ImStableVector<ImFontBaked,32> BakedPool;
     ImGuiStorage                BakedMap;               // BakedId --> ImFontBaked*
     int                         BakedDiscardedCount;
+    int                         BakedMemoryUsage;       // Memory used by baked fonts, in bytes. Updated by ImFontAtlasUpdateNewFrame().
+    int                         BakedEvictedCount;      // Number of baked fonts discarded to honor BakedMemoryBudget.
 
     // Custom rectangle identifiers
     ImFontAtlasRectId           PackIdMouseCursors;     // White pixel + mouse cursors. Also happen to be fallback in case of packing failure.
     ImFontAtlasRectId           PackIdLinesTexData;
 
+    // Additional texture pages (ImFontAtlasFlags_TexturePages, ImFontFlags_SDF)
+    ImFontAtlasPage*            Pages[IM_FONTATLAS_PAGES_MAX]; // [0] is unused (main texture), NULL for free slots.
+    int                         PagesCurrent;           // Page receiving new glyphs. 0: main texture.
+    int                         PagesCurrentSDF;        // Page receiving new signed distance field glyphs. 0: none.
+    int                         PagesCount;             // Number of allocated pages (excluding main texture).
+    int                         PagesReleasedCount;     // Incremented when a page is destroyed (used to refresh retained windows)
+    int                         RectsDiscardedInPagesCount;
+
+    // Asynchronous glyph loading (ImFontAtlasFlags_AsyncGlyphLoading)
+    ImVector<ImFontAtlasGlyphJob> AsyncGlyphsQueued;    // Placeholder glyphs waiting to be rasterized
+    ImVector<ImFontAtlasGlyphJob> AsyncGlyphsRunning;   // Glyphs rasterized by background task, committed on next frame
+    ImVector<unsigned char>     AsyncGlyphsPixels;      // Output of background task
+    bool                        AsyncTaskRunning;
+    int                         AsyncGlyphsCommitCount; // Incremented when placeholder glyphs got their pixels (used to refresh retained windows)
+
+    // Deferred loading (ImFontAtlasFlags_SharedAcrossThreads)
+    int                         DeferredLoadsDisabled;  // >0 while the atlas may be modified: committing deferred loads, preloading glyphs.
+    int                         DeferredLoadsCommitted; // Number of glyphs and baked fonts loaded from deferred requests.
+
+    // Text layout cache (ImFontAtlasFlags_TextLayoutCache)
+    ImVector<ImFontTextRun>     TextRuns;
+    ImVector<int>               TextRunsTable;          // Open addressing hash table: Key --> index into TextRuns[], -1 for empty slots. Size is a power of two, larger than twice TextRuns.Size.
+    ImVector<char>              TextRunsText;           // Text of all runs (see ImFontTextRun::TextOffset)
+    ImVector<ImFontTextRunQuad> TextRunsQuads;          // Quads of all runs (see ImFontTextRun::QuadsOffset)
+    ImVector<char>              TextRunsTextCompact;    // Compaction target, swapped with TextRunsText[] so both keep their capacity
+    ImVector<ImFontTextRunQuad> TextRunsQuadsCompact;
+    int                         TextRunsGeneration;     // Incremented when glyphs UV or texture page changed: invalidates all runs.
+
     ImFontAtlasBuilder()        { memset(this, 0, sizeof(*this)); FrameCount = -1; RectsIndexFreeListStart = -1; PackIdMouseCursors = PackIdLinesTexData = -1; }
 };
 
@@ -3829,6 +4286,7 @@ IMGUI_API void              ImFontAtlasBuildSetupFontSpecialGlyphs(ImFontAtlas*
 IMGUI_API void              ImFontAtlasBuildLegacyPreloadAllGlyphRanges(ImFontAtlas* atlas); // Legacy
 IMGUI_API void              ImFontAtlasBuildGetOversampleFactors(ImFontConfig* src, ImFontBaked* baked, int* out_oversample_h, int* out_oversample_v);
 IMGUI_API void              ImFontAtlasBuildDiscardBakes(ImFontAtlas* atlas, int unused_frames);
+IMGUI_API void              ImFontAtlasBuildDiscardBakesOverBudget(ImFontAtlas* atlas, int budget);
 
 IMGUI_API bool              ImFontAtlasFontSourceInit(ImFontAtlas* atlas, ImFontConfig* src);
 IMGUI_API void              ImFontAtlasFontSourceAddToFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* src);
@@ -3836,21 +4294,34 @@ IMGUI_API void              ImFontAtlasFontDestroySourceData(ImFontAtlas* atlas,
 IMGUI_API bool              ImFontAtlasFontInitOutput(ImFontAtlas* atlas, ImFont* font); // Using FontDestroyOutput/FontInitOutput sequence useful notably if font loader params have changed
 IMGUI_API void              ImFontAtlasFontDestroyOutput(ImFontAtlas* atlas, ImFont* font);
 IMGUI_API void              ImFontAtlasFontDiscardBakes(ImFontAtlas* atlas, ImFont* font, int unused_frames);
+IMGUI_API void              ImFontInitSubstitute(ImFont* dst_font, ImFontBaked* dst_baked, ImFont* src_font, ImFontBaked* src_baked, ImWchar c); // Font not added to atlas, drawing every character with glyph 'c' (e.g. InputText() password font)
 
 IMGUI_API ImGuiID           ImFontAtlasBakedGetId(ImGuiID font_id, float baked_size, float rasterizer_density);
 IMGUI_API ImFontBaked*      ImFontAtlasBakedGetOrAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density);
 IMGUI_API ImFontBaked*      ImFontAtlasBakedGetClosestMatch(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density);
 IMGUI_API ImFontBaked*      ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density, ImGuiID baked_id);
 IMGUI_API void              ImFontAtlasBakedDiscard(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked);
+IMGUI_API int               ImFontAtlasBakedGetMemoryUsage(ImFontAtlas* atlas, ImFontBaked* baked);
 IMGUI_API ImFontGlyph*      ImFontAtlasBakedAddFontGlyph(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, const ImFontGlyph* in_glyph);
 IMGUI_API void              ImFontAtlasBakedAddFontGlyphAdvancedX(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImWchar codepoint, float advance_x);
 IMGUI_API void              ImFontAtlasBakedDiscardFontGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked, ImFontGlyph* glyph);
+IMGUI_API void              ImFontAtlasBakedPreloadGlyphs(ImFontAtlas* atlas, ImFontBaked* baked, const ImWchar* codepoints, int codepoints_count);
+IMGUI_API void              ImFontAtlasAsyncGlyphsStart(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasAsyncGlyphsFlush(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasAsyncGlyphsCancel(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasDeferredLoadsCommit(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasTextRunsDiscardUnused(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasTextRunsClear(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasTextRunsInvalidateBaked(ImFontAtlas* atlas, ImFontBaked* baked);
 IMGUI_API void              ImFontAtlasBakedSetFontGlyphBitmap(ImFontAtlas* atlas, ImFontBaked* baked, ImFontConfig* src, ImFontGlyph* glyph, ImTextureRect* r, const unsigned char* src_pixels, ImTextureFormat src_fmt, int src_pitch);
 
 IMGUI_API void              ImFontAtlasPackInit(ImFontAtlas* atlas);
 IMGUI_API ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFontAtlasRectEntry* overwrite_entry = NULL);
 IMGUI_API ImTextureRect*    ImFontAtlasPackGetRect(ImFontAtlas* atlas, ImFontAtlasRectId id);
 IMGUI_API ImTextureRect*    ImFontAtlasPackGetRectSafe(ImFontAtlas* atlas, ImFontAtlasRectId id);
+IMGUI_API ImTextureData*    ImFontAtlasPackGetRectTexture(ImFontAtlas* atlas, ImFontAtlasRectId id);
+IMGUI_API ImFontAtlasRectId ImFontAtlasPackAddGlyphRect(ImFontAtlas* atlas, int w, int h, bool sdf = false);
+IMGUI_API ImTextureData*    ImFontAtlasPageGetTexture(ImFontAtlas* atlas, int page_idx);
 IMGUI_API void              ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id);
 
 IMGUI_API void              ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool renderer_has_textures);
@@ -454,6 +454,9 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
         table->InnerWindow->DC.TreeDepth++; // This is designed to always linking ImGuiTreeNodeFlags_DrawLines linking accross a table
     }
 
+    // Profiler: zone starts after the optional scrolling child window was created, as its Begin() is measured separately.
+    IMGUI_PROFILER_SCOPE("BeginTable");
+
     // Push a standardized ID for both child-using and not-child-using tables
     PushOverrideID(id);
     if (instance_no > 0)
@@ -1180,6 +1183,8 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         {
             column->AutoFitQueue >>= 1;
             column->CannotSkipItemsQueue >>= 1;
+            if (column->AutoFitQueue != 0x00 || column->CannotSkipItemsQueue != 0x00)
+                RequestRedrawEx(0.0f, "Table column auto-fit");
         }
 
         if (visible_n < table->FreezeColumnsCount)
@@ -1352,6 +1357,7 @@ void    ImGui::EndTable()
         IM_ASSERT_USER_ERROR(table != NULL, "EndTable() call should only be done while in BeginTable() scope!");
         return;
     }
+    IMGUI_PROFILER_ZONE_BEGIN("EndTable", NULL);
 
     // This assert would be very useful to catch a common error... unfortunately it would probably trigger in some
     // cases, and for consistency user may sometimes output empty tables (and still benefit from e.g. outer border)
@@ -1500,6 +1506,7 @@ void    ImGui::EndTable()
     // Layout in outer window
     // (FIXME: To allow auto-fit and allow desirable effect of SameLine() we dissociate 'used' vs 'ideal' size by overriding
     // CursorPosPrevLine and CursorMaxPos manually. That should be a more general layout feature, see same problem e.g. #3414)
+    IMGUI_PROFILER_ZONE_END("EndTable"); // Before EndChild() which closes the scrolling child window zone.
     if (inner_window != outer_window)
     {
         short backup_nav_layers_active_mask = inner_window->DC.NavLayersActiveMask;
@@ -1889,6 +1896,7 @@ int ImGui::TableGetRowIndex()
 // [Public] Starts into the first cell of a new row
 void ImGui::TableNextRow(ImGuiTableRowFlags row_flags, float row_min_height)
 {
+    IMGUI_PROFILER_SCOPE("TableNextRow"); // Includes TableUpdateLayout() on first row
     ImGuiContext& g = *GImGui;
     ImGuiTable* table = g.CurrentTable;
 
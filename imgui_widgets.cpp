@@ -540,6 +540,7 @@ void ImGui::BulletTextV(const char* fmt, va_list args)
 //    or (2) surrounding those calls with PushItemFlag(ImGuiItemFlags_AllowDuplicateId, true); ... PopItemFlag()
 bool ImGui::ButtonBehavior(const ImRect& bb, ImGuiID id, bool* out_hovered, bool* out_held, ImGuiButtonFlags flags)
 {
+    IMGUI_PROFILER_SCOPE("ButtonBehavior");
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = GetCurrentWindow();
 
@@ -4320,32 +4321,26 @@ void ImGuiInputTextCallbackData::InsertChars(int pos, const char* new_text, cons
     BufTextLen += new_text_len;
 }
 
+// Bind a per-context font drawing every character with the '*' glyph of current font, at current size.
+// (current font is left untouched, as it may be used by contexts on other threads: ImFontAtlasFlags_SharedAcrossThreads)
 void ImGui::PushPasswordFont()
 {
     ImGuiContext& g = *GImGui;
-    ImFontBaked* backup = &g.InputTextPasswordFontBackupBaked;
-    IM_ASSERT(backup->IndexAdvanceX.Size == 0 && backup->IndexLookup.Size == 0);
-    ImFontGlyph* glyph = g.FontBaked->FindGlyph('*');
-    g.InputTextPasswordFontBackupFlags = g.Font->Flags;
-    backup->FallbackGlyphIndex = g.FontBaked->FallbackGlyphIndex;
-    backup->FallbackAdvanceX = g.FontBaked->FallbackAdvanceX;
-    backup->IndexLookup.swap(g.FontBaked->IndexLookup);
-    backup->IndexAdvanceX.swap(g.FontBaked->IndexAdvanceX);
-    g.Font->Flags |= ImFontFlags_NoLoadGlyphs;
-    g.FontBaked->FallbackGlyphIndex = g.FontBaked->Glyphs.index_from_ptr(glyph);
-    g.FontBaked->FallbackAdvanceX = glyph->AdvanceX;
+    ImFont* font = &g.InputTextPasswordFont;
+    IM_ASSERT(g.Font != font && font->ContainerAtlas == NULL);
+    ImFontInitSubstitute(font, &g.InputTextPasswordFontBaked, g.Font, g.FontBaked, '*');
+    g.FontStack.push_back({ g.Font, g.FontSizeBase, g.FontSize });
+    SetCurrentFont(font, g.FontSizeBase, g.FontSize);
 }
 
 void ImGui::PopPasswordFont()
 {
     ImGuiContext& g = *GImGui;
-    ImFontBaked* backup = &g.InputTextPasswordFontBackupBaked;
-    g.Font->Flags = g.InputTextPasswordFontBackupFlags;
-    g.FontBaked->FallbackGlyphIndex = backup->FallbackGlyphIndex;
-    g.FontBaked->FallbackAdvanceX = backup->FallbackAdvanceX;
-    g.FontBaked->IndexLookup.swap(backup->IndexLookup);
-    g.FontBaked->IndexAdvanceX.swap(backup->IndexAdvanceX);
-    IM_ASSERT(backup->IndexAdvanceX.Size == 0 && backup->IndexLookup.Size == 0);
+    ImFont* font = &g.InputTextPasswordFont;
+    IM_ASSERT(g.Font == font);
+    PopFont();
+    font->ContainerAtlas = NULL; // Don't keep a reference to the atlas (which may be destroyed before this context)
+    font->LastBaked = NULL;
 }
 
 // Return false to discard a character.
@@ -4519,6 +4514,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
         return false;
+    IMGUI_PROFILER_SCOPE("InputTextEx"); // Multi-line child window zones are nested inside.
 
     IM_ASSERT(buf != NULL && buf_size >= 0);
     IM_ASSERT(!((flags & ImGuiInputTextFlags_CallbackHistory) && (flags & ImGuiInputTextFlags_Multiline)));        // Can't use both together (they both use up/down keys)
@@ -5396,6 +5392,12 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         {
             state->CursorAnim += io.DeltaTime;
             bool cursor_is_visible = (!g.IO.ConfigInputTextCursorBlink) || (state->CursorAnim <= 0.0f) || ImFmod(state->CursorAnim, 1.20f) <= 0.80f;
+            if (g.IO.ConfigInputTextCursorBlink)
+            {
+                // Request a frame when cursor visibility next toggles (see io.WantRedraw)
+                const float cursor_anim_phase = (state->CursorAnim <= 0.0f) ? state->CursorAnim : ImFmod(state->CursorAnim, 1.20f);
+                RequestRedrawEx((cursor_anim_phase <= 0.80f ? 0.80f : 1.20f) - cursor_anim_phase, "InputText cursor blink");
+            }
             ImVec2 cursor_screen_pos = ImTrunc(draw_pos + cursor_offset - draw_scroll);
             ImRect cursor_screen_rect(cursor_screen_pos.x, cursor_screen_pos.y - g.FontSize + 0.5f, cursor_screen_pos.x + 1.0f, cursor_screen_pos.y - 1.5f);
             if (cursor_is_visible && cursor_screen_rect.Overlaps(clip_rect))
@@ -6641,6 +6643,7 @@ bool ImGui::TreeNodeBehavior(ImGuiID id, ImGuiTreeNodeFlags flags, const char* l
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
         return false;
+    IMGUI_PROFILER_SCOPE("TreeNodeBehavior");
 
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
@@ -8262,7 +8265,7 @@ void ImGuiSelectionBasicStorage::Clear()
 {
     Size = 0;
     _SelectionOrder = 1; // Always >0
-    _Storage.Data.resize(0);
+    _Storage.Clear();
 }
 
 void ImGuiSelectionBasicStorage::Swap(ImGuiSelectionBasicStorage& r)
@@ -8270,6 +8273,10 @@ void ImGuiSelectionBasicStorage::Swap(ImGuiSelectionBasicStorage& r)
     ImSwap(Size, r.Size);
     ImSwap(_SelectionOrder, r._SelectionOrder);
     _Storage.Data.swap(r._Storage.Data);
+#ifdef IMGUI_ENABLE_STORAGE_HASHMAP
+    _Storage.HashIndex.swap(r._Storage.HashIndex);
+    ImSwap(_Storage.HashIndexCount, r._Storage.HashIndexCount);
+#endif
 }
 
 bool ImGuiSelectionBasicStorage::Contains(ImGuiID id) const
@@ -8291,7 +8298,12 @@ bool ImGuiSelectionBasicStorage::GetNextSelectedItem(void** opaque_it, ImGuiID*
     ImGuiStoragePair* it = (ImGuiStoragePair*)*opaque_it;
     ImGuiStoragePair* it_end = _Storage.Data.Data + _Storage.Data.Size;
     if (PreserveOrder && it == NULL && it_end != NULL)
+    {
         ImQsort(_Storage.Data.Data, (size_t)_Storage.Data.Size, sizeof(ImGuiStoragePair), PairComparerByValueInt); // ~ImGuiStorage::BuildSortByValueInt()
+#ifdef IMGUI_ENABLE_STORAGE_HASHMAP
+        _Storage.HashIndexCount = -1; // Pairs moved without changing Data.Size: invalidate index so lookups during iteration don't use stale slots.
+#endif
+    }
     if (it == NULL)
         it = _Storage.Data.Data;
     IM_ASSERT(it >= _Storage.Data.Data && it <= it_end);
@@ -8317,6 +8329,14 @@ void ImGuiSelectionBasicStorage::SetItemSelected(ImGuiID id, bool selected)
 static void ImGuiSelectionBasicStorage_BatchSetItemSelected(ImGuiSelectionBasicStorage* selection, ImGuiID id, bool selected, int size_before_amends, int selection_order)
 {
     ImGuiStorage* storage = &selection->_Storage;
+#ifdef IMGUI_ENABLE_STORAGE_HASHMAP
+    // Hashed storage: insertion is cheap, no need to append unsorted and do a binary search over the sorted part.
+    IM_UNUSED(size_before_amends);
+    int* p_int = storage->GetIntRef(id, 0);
+    if (selected == (*p_int != 0))
+        return;
+    *p_int = selected ? selection_order : 0;
+#else
     ImGuiStoragePair* it = ImLowerBound(storage->Data.Data, storage->Data.Data + size_before_amends, id);
     const bool is_contained = (it != storage->Data.Data + size_before_amends) && (it->key == id);
     if (selected == (is_contained && it->val_i != 0))
@@ -8325,6 +8345,7 @@ static void ImGuiSelectionBasicStorage_BatchSetItemSelected(ImGuiSelectionBasicS
         storage->Data.push_back(ImGuiStoragePair(id, selection_order)); // Push unsorted at end of vector, will be sorted in SelectionMultiAmendsFinish()
     else if (is_contained)
         it->val_i = selected ? selection_order : 0; // Modify in-place.
+#endif
     selection->Size += selected ? +1 : -1;
 }
 
@@ -9536,6 +9557,10 @@ void    ImGui::EndTabBar()
     if (tab_bar->BeginCount > 1)
         window->DC.CursorPos = tab_bar->BackupCursorPos;
 
+    // Request another frame while scrolling, selection or layout changes are pending (see io.WantRedraw)
+    if (tab_bar->ScrollingAnim != tab_bar->ScrollingTarget || tab_bar->NextSelectedTabId != 0 || tab_bar->ReorderRequestTabId != 0 || tab_bar->TabsAddedNew)
+        RequestRedrawEx(0.0f, "Tab bar");
+
     tab_bar->LastTabItemIdx = -1;
     if ((tab_bar->Flags & ImGuiTabBarFlags_DockNode) == 0)
         PopID();
@@ -7,6 +7,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2025/08/27: implemented FontBakedRasterizeGlyph() for batched loading with ImFontBaked::PreloadGlyphs().
 //  2025/06/11: refactored for the new ImFontLoader architecture, and ImGuiBackendFlags_RendererHasTextures support.
 //  2024/10/17: added plutosvg support for SVG Fonts (seems faster/better than lunasvg). Enable by using '#define IMGUI_ENABLE_FREETYPE_PLUTOSVG'. (#7927)
 //  2023/11/13: added support for ImFontConfig::RasterizationDensity field for scaling render density without scaling metrics.
@@ -66,6 +67,9 @@
 #error IMGUI_ENABLE_FREETYPE_PLUTOSVG or IMGUI_ENABLE_FREETYPE_LUNASVG requires FreeType version >= 2.12
 #endif
 #endif
+#if (FREETYPE_MAJOR > 2) || ((FREETYPE_MAJOR == 2) && (FREETYPE_MINOR >= 11))
+#define IMGUI_FREETYPE_HAS_RENDER_MODE_SDF  // FT_RENDER_MODE_SDF was added in FreeType 2.11, required for ImFontFlags_SDF
+#endif
 
 #ifdef _MSC_VER
 #pragma warning (push)
@@ -378,6 +382,14 @@ static bool ImGui_ImplFreeType_LoaderInit(ImFontAtlas* atlas)
     FT_Property_Set(bd->Library, "ot-svg", "svg-hooks", plutosvg_ft_svg_hooks());
 #endif // IMGUI_ENABLE_FREETYPE_PLUTOSVG
 
+#ifdef IMGUI_FREETYPE_HAS_RENDER_MODE_SDF
+    // Match our encoding of signed distance fields (ImFontFlags_SDF). 'bsdf' is used for bitmap glyphs.
+    // https://freetype.org/freetype2/docs/reference/ft2-properties.html#spread
+    FT_Int sdf_spread = IM_FONTGLYPH_SDF_PADDING;
+    FT_Property_Set(bd->Library, "sdf", "spread", &sdf_spread);
+    FT_Property_Set(bd->Library, "bsdf", "spread", &sdf_spread);
+#endif
+
     // Store our data
     atlas->FontLoaderData = (void*)bd;
 
@@ -475,10 +487,22 @@ static void ImGui_ImplFreeType_FontBakedDestroy(ImFontAtlas* atlas, ImFontConfig
     bd_baked_data->~ImGui_ImplFreeType_FontSrcBakedData(); // ~IM_PLACEMENT_DELETE()
 }
 
-static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
+static bool ImGui_ImplFreeType_FontBakedRasterizeGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, ImFontAtlasGlyphBitmap* out_bitmap)
 {
+    IM_UNUSED(atlas);
     ImGui_ImplFreeType_FontSrcData* bd_font_data = (ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
-    uint32_t glyph_index = FT_Get_Char_Index(bd_font_data->FtFace, codepoint);
+    FT_Face face = bd_font_data->FtFace;
+    FT_GlyphSlot slot = face->glyph;
+
+    // Copy pixels of the glyph we just rendered (FontBakedRasterizeGlyphThreadSafe is false so this always immediately follows the first call)
+    if (out_bitmap->Pixels != nullptr)
+    {
+        IM_ASSERT((int)slot->bitmap.width == out_bitmap->Width && (int)slot->bitmap.rows == out_bitmap->Height);
+        ImGui_ImplFreeType_BlitGlyph(&slot->bitmap, (uint32_t*)(void*)out_bitmap->Pixels, out_bitmap->Width);
+        return true;
+    }
+
+    uint32_t glyph_index = FT_Get_Char_Index(face, codepoint);
     if (glyph_index == 0)
         return false;
 
@@ -494,25 +518,19 @@ static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConf
     if (metrics == nullptr)
         return false;
 
-    FT_Face face = bd_font_data->FtFace;
-    FT_GlyphSlot slot = face->glyph;
-    const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
-
-    // Load metrics only mode
-    const float advance_x = (slot->advance.x / FT_SCALEFACTOR) / rasterizer_density;
-    if (out_advance_x != NULL)
-    {
-        IM_ASSERT(out_glyph == NULL);
-        *out_advance_x = advance_x;
-        return true;
-    }
-
     // Render glyph into a bitmap (currently held by FreeType)
+    const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
     FT_Render_Mode render_mode = (bd_font_data->UserFlags & ImGuiFreeTypeLoaderFlags_Monochrome) ? FT_RENDER_MODE_MONO : FT_RENDER_MODE_NORMAL;
+#ifdef IMGUI_FREETYPE_HAS_RENDER_MODE_SDF
+    if (baked->UseSDF)
+        render_mode = FT_RENDER_MODE_SDF; // Padded by 'spread' pixels on each side
+#endif
     FT_Error error = FT_Render_Glyph(slot, render_mode);
     const FT_Bitmap* ft_bitmap = &slot->bitmap;
     if (error != 0 || ft_bitmap == nullptr)
         return false;
+    if (baked->UseSDF && ft_bitmap->pixel_mode != FT_PIXEL_MODE_GRAY)
+        return false; // Colored glyphs can't be stored as distance fields
 
     const int w = (int)ft_bitmap->width;
     const int h = (int)ft_bitmap->rows;
@@ -520,25 +538,10 @@ static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConf
 
     // Prepare glyph
     out_glyph->Codepoint = codepoint;
-    out_glyph->AdvanceX = advance_x;
+    out_glyph->AdvanceX = (slot->advance.x / FT_SCALEFACTOR) / rasterizer_density;
 
-    // Pack and retrieve position inside texture atlas
     if (is_visible)
     {
-        ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
-        if (pack_id == ImFontAtlasRectId_Invalid)
-        {
-            // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
-            IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
-            return false;
-        }
-        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
-
-        // Render pixels to our temporary buffer
-        atlas->Builder->TempBuffer.resize(w * h * 4);
-        uint32_t* temp_buffer = (uint32_t*)atlas->Builder->TempBuffer.Data;
-        ImGui_ImplFreeType_BlitGlyph(ft_bitmap, temp_buffer, w);
-
         const float ref_size = baked->ContainerFont->Sources[0]->SizePixels;
         const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
         float font_off_x = (src->GlyphOffset.x * offsets_scale);
@@ -559,8 +562,65 @@ static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConf
         out_glyph->Y1 = (glyph_off_y + h) * recip_v + font_off_y;
         out_glyph->Visible = true;
         out_glyph->Colored = (ft_bitmap->pixel_mode == FT_PIXEL_MODE_BGRA);
+        out_bitmap->Width = w;
+        out_bitmap->Height = h;
+        out_bitmap->Format = ImTextureFormat_RGBA32;
+    }
+
+    return true;
+}
+
+static bool ImGui_ImplFreeType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loader_data_for_baked_src, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
+{
+    // Load metrics only mode
+    if (out_advance_x != NULL)
+    {
+        IM_ASSERT(out_glyph == NULL);
+        ImGui_ImplFreeType_FontSrcData* bd_font_data = (ImGui_ImplFreeType_FontSrcData*)src->FontLoaderData;
+        uint32_t glyph_index = FT_Get_Char_Index(bd_font_data->FtFace, codepoint);
+        if (glyph_index == 0)
+            return false;
+
+        if (bd_font_data->BakedLastActivated != baked) // <-- could use id
+        {
+            // Activate current size
+            ImGui_ImplFreeType_FontSrcBakedData* bd_baked_data = (ImGui_ImplFreeType_FontSrcBakedData*)loader_data_for_baked_src;
+            FT_Activate_Size(bd_baked_data->FtSize);
+            bd_font_data->BakedLastActivated = baked;
+        }
+
+        if (ImGui_ImplFreeType_LoadGlyph(bd_font_data, codepoint) == nullptr)
+            return false;
+        const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
+        *out_advance_x = (bd_font_data->FtFace->glyph->advance.x / FT_SCALEFACTOR) / rasterizer_density;
+        return true;
+    }
+
+    ImFontAtlasGlyphBitmap bitmap = {};
+    if (!ImGui_ImplFreeType_FontBakedRasterizeGlyph(atlas, src, baked, loader_data_for_baked_src, codepoint, out_glyph, &bitmap))
+        return false;
+
+    // Pack and retrieve position inside texture atlas
+    if (out_glyph->Visible)
+    {
+        const int w = bitmap.Width;
+        const int h = bitmap.Height;
+        ImFontAtlasRectId pack_id = ImFontAtlasPackAddGlyphRect(atlas, w, h, baked->UseSDF);
+        if (pack_id == ImFontAtlasRectId_Invalid)
+        {
+            // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
+            IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
+            return false;
+        }
+        ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
+
+        // Render pixels to our temporary buffer
+        atlas->Builder->TempBuffer.resize(w * h * 4);
+        bitmap.Pixels = atlas->Builder->TempBuffer.Data;
+        ImGui_ImplFreeType_FontBakedRasterizeGlyph(atlas, src, baked, loader_data_for_baked_src, codepoint, out_glyph, &bitmap);
+
         out_glyph->PackId = pack_id;
-        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, (const unsigned char*)temp_buffer, ImTextureFormat_RGBA32, w * 4);
+        ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, bitmap.Pixels, ImTextureFormat_RGBA32, w * 4);
     }
 
     return true;
@@ -586,6 +646,11 @@ const ImFontLoader* ImGuiFreeType::GetFontLoader()
     loader.FontBakedInit = ImGui_ImplFreeType_FontBakedInit;
     loader.FontBakedDestroy = ImGui_ImplFreeType_FontBakedDestroy;
     loader.FontBakedLoadGlyph = ImGui_ImplFreeType_FontBakedLoadGlyph;
+    loader.FontBakedRasterizeGlyph = ImGui_ImplFreeType_FontBakedRasterizeGlyph;
+    loader.FontBakedRasterizeGlyphThreadSafe = false; // FT_Face is not thread-safe
+#ifdef IMGUI_FREETYPE_HAS_RENDER_MODE_SDF
+    loader.FontBakedSupportsSDF = true;
+#endif
     loader.FontBakedSrcLoaderDataSize = sizeof(ImGui_ImplFreeType_FontSrcBakedData);
     return &loader;
 }